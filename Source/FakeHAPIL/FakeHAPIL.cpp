@@ -0,0 +1,1611 @@
+/*
+* Copyright (c) <2023> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "FakeHAPIL.h"
+
+#include "HoudiniEngineBgeo.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+// Environment configuration, see FakeHAPIL.h
+struct FakeConfig
+{
+    int pointCount = 10000;
+    int faceCount = -1;
+    int attributeCount = 0;
+    int cookMilliseconds = 0;
+    int latencyMicroseconds = 0;
+    double bandwidthMBps = 0.0;
+};
+
+// An attribute of a part, stored by its storage type
+struct FakeAttribute
+{
+    HAPI_AttributeInfo info;
+    std::vector<float> floats;
+    std::vector<int> ints;
+    std::vector<HAPI_StringHandle> strings;
+};
+
+// The single part of a node's geometry
+struct FakeGeometry
+{
+    HAPI_PartInfo part;
+    std::vector<int> faceCounts;
+    std::vector<int> vertexList;
+
+    // Keyed by owner then name, kept in insertion order for GetAttributeNames. A deque keeps
+    // references to earlier attributes valid while new ones are added.
+    std::deque<std::pair<std::pair<int, std::string>, FakeAttribute>> attributes;
+
+    FakeAttribute* find(HAPI_AttributeOwner owner, const std::string& name)
+    {
+        for (auto& attribute : attributes)
+        {
+            if (attribute.first.first == owner && attribute.first.second == name)
+                return &attribute.second;
+        }
+        return nullptr;
+    }
+};
+
+struct FakeNode
+{
+    std::string operatorName;
+    std::string label;
+    bool isObject = false;
+    int cookCount = 0;
+    std::map<int, HAPI_NodeId> inputs;
+
+    // The node's only parameter, the float3 "size", carried by its presets
+    float size[3] = { 1.0f, 1.0f, 1.0f };
+
+    // Geometry uploaded to an input node, nullptr for nodes that cook synthetic geometry
+    std::shared_ptr<FakeGeometry> geometry;
+};
+
+struct FakeState
+{
+    std::mutex mutex;
+    FakeConfig config;
+
+    std::set<HAPI_SessionId> sessions;
+    HAPI_SessionId nextSessionId = 1;
+    bool initialized = false;
+    bool useCookingThread = false;
+    std::chrono::steady_clock::time_point cookReadyTime;
+
+    std::vector<std::string> strings{ "" };
+    std::unordered_map<std::string, HAPI_StringHandle> stringHandles{ { "", 0 } };
+    std::string stringBatch;
+    std::string lastError;
+
+    std::map<HAPI_AssetLibraryId, std::string> assetLibraries;
+    std::map<HAPI_NodeId, FakeNode> nodes;
+    HAPI_NodeId nextNodeId = 1;
+    int nextProfileId = 1;
+
+    std::shared_ptr<FakeGeometry> syntheticGeometry;
+
+    // .bgeo blobs serialized by GetGeoSize, until SaveGeoToMemory copies them out
+    std::map<HAPI_NodeId, std::vector<char>> savedGeometry;
+};
+
+static int
+getEnvInt(const char* name, int default_value)
+{
+    const char* value = std::getenv(name);
+    return value && *value ? std::atoi(value) : default_value;
+}
+
+static FakeState&
+getState()
+{
+    static FakeState state;
+    static std::once_flag configured;
+    std::call_once(configured, []()
+    {
+        FakeConfig& config = state.config;
+        config.pointCount = std::max(0, getEnvInt("FAKE_HAPIL_POINTS", config.pointCount));
+        config.faceCount = getEnvInt("FAKE_HAPIL_FACES", config.faceCount);
+        config.attributeCount = std::max(0, getEnvInt("FAKE_HAPIL_ATTRIBUTES", config.attributeCount));
+        config.cookMilliseconds = std::max(0, getEnvInt("FAKE_HAPIL_COOK_MS", config.cookMilliseconds));
+        config.latencyMicroseconds = std::max(0, getEnvInt("FAKE_HAPIL_LATENCY_US", config.latencyMicroseconds));
+        config.bandwidthMBps = std::max(0, getEnvInt("FAKE_HAPIL_BANDWIDTH_MBPS", 0));
+    });
+    return state;
+}
+
+// Emulate the cost of a call over a Thrift transport: a fixed latency plus the time to move its data
+static void
+simulateTransport(const HAPI_Session* session, size_t bytes = 0)
+{
+    if (!session || session->type == HAPI_SESSION_INPROCESS)
+        return;
+
+    const FakeConfig& config = getState().config;
+    double seconds = config.latencyMicroseconds * 1e-6;
+    if (config.bandwidthMBps > 0.0)
+        seconds += bytes / (config.bandwidthMBps * 1024.0 * 1024.0);
+
+    if (seconds > 0.0)
+        std::this_thread::sleep_for(std::chrono::duration<double>(seconds));
+}
+
+static HAPI_Result
+fail(FakeState& state, const std::string& error, HAPI_Result result = HAPI_RESULT_FAILURE)
+{
+    state.lastError = error;
+    return result;
+}
+
+static HAPI_StringHandle
+makeString(FakeState& state, const std::string& value)
+{
+    auto handle = state.stringHandles.find(value);
+    if (handle != state.stringHandles.end())
+        return handle->second;
+
+    HAPI_StringHandle new_handle = (HAPI_StringHandle)state.strings.size();
+    state.strings.push_back(value);
+    state.stringHandles.emplace(value, new_handle);
+    return new_handle;
+}
+
+static bool
+isValidSession(FakeState& state, const HAPI_Session* session)
+{
+    return session && state.sessions.count(session->id) != 0;
+}
+
+static FakeNode*
+findNode(FakeState& state, HAPI_NodeId node_id)
+{
+    auto node = state.nodes.find(node_id);
+    return node != state.nodes.end() ? &node->second : nullptr;
+}
+
+static FakeAttribute&
+addAttribute(FakeGeometry& geometry, const std::string& name, HAPI_AttributeOwner owner, HAPI_StorageType storage,
+             int count, int tuple_size)
+{
+    FakeAttribute* attribute = geometry.find(owner, name);
+    if (!attribute)
+    {
+        geometry.attributes.push_back({ { owner, name }, FakeAttribute() });
+        attribute = &geometry.attributes.back().second;
+        geometry.part.attributeCounts[owner]++;
+    }
+
+    HAPI_AttributeInfo& info = attribute->info;
+    info = HAPI_AttributeInfo();
+    info.exists = true;
+    info.owner = owner;
+    info.originalOwner = owner;
+    info.storage = storage;
+    info.count = count;
+    info.tupleSize = tuple_size;
+
+    const size_t value_count = (size_t)count * tuple_size;
+    if (storage == HAPI_STORAGETYPE_STRING)
+        attribute->strings.assign(value_count, 0);
+    else if (storage == HAPI_STORAGETYPE_INT)
+        attribute->ints.assign(value_count, 0);
+    else
+        attribute->floats.assign(value_count, 0.0f);
+
+    return *attribute;
+}
+
+// A grid of points triangulated row by row, with the attributes the sample reads
+static std::shared_ptr<FakeGeometry>
+buildSyntheticGeometry(FakeState& state)
+{
+    const FakeConfig& config = state.config;
+    std::shared_ptr<FakeGeometry> geometry = std::make_shared<FakeGeometry>();
+
+    const int point_count = config.pointCount;
+    const int width = std::max(1, (int)std::ceil(std::sqrt((double)point_count)));
+    const int rows = point_count / width;
+    const int cell_count = width > 1 && rows > 1 ? (width - 1) * (rows - 1) : 0;
+    const int face_count = cell_count ? (config.faceCount >= 0 ? config.faceCount : cell_count * 2) : 0;
+
+    HAPI_PartInfo& part = geometry->part;
+    part = HAPI_PartInfo();
+    part.type = HAPI_PARTTYPE_MESH;
+    part.nameSH = makeString(state, "fake");
+    part.pointCount = point_count;
+    part.faceCount = face_count;
+    part.vertexCount = face_count * 3;
+
+    geometry->faceCounts.assign(face_count, 3);
+    geometry->vertexList.resize((size_t)face_count * 3);
+    for (int face = 0; face < face_count; ++face)
+    {
+        int cell = (face / 2) % cell_count;
+        int corner = (cell / (width - 1)) * width + cell % (width - 1);
+        int* vertices = &geometry->vertexList[(size_t)face * 3];
+        vertices[0] = corner;
+        vertices[1] = face % 2 ? corner + width + 1 : corner + 1;
+        vertices[2] = face % 2 ? corner + 1 : corner + width;
+        if (face % 2)
+            std::swap(vertices[0], vertices[1]);
+    }
+
+    FakeAttribute& positions = addAttribute(*geometry, "P", HAPI_ATTROWNER_POINT, HAPI_STORAGETYPE_FLOAT, point_count, 3);
+    FakeAttribute& colors = addAttribute(*geometry, "Cd", HAPI_ATTROWNER_POINT, HAPI_STORAGETYPE_FLOAT, point_count, 3);
+    for (int i = 0; i < point_count; ++i)
+    {
+        float x = (float)(i % width);
+        float z = (float)(i / width);
+        positions.floats[i * 3 + 0] = x;
+        positions.floats[i * 3 + 1] = std::sin(x * 0.1f) * std::cos(z * 0.1f);
+        positions.floats[i * 3 + 2] = z;
+        colors.floats[i * 3 + 0] = x / width;
+        colors.floats[i * 3 + 1] = 0.5f;
+        colors.floats[i * 3 + 2] = z / std::max(1, rows);
+    }
+
+    for (int k = 0; k < config.attributeCount; ++k)
+    {
+        FakeAttribute& extra = addAttribute(
+            *geometry, "attrib" + std::to_string(k), HAPI_ATTROWNER_POINT, HAPI_STORAGETYPE_FLOAT, point_count, 3);
+        for (size_t i = 0; i < extra.floats.size(); ++i)
+            extra.floats[i] = (float)((i + k) % 97) / 97.0f;
+    }
+
+    const int vertex_count = part.vertexCount;
+    FakeAttribute& normals = addAttribute(*geometry, "N", HAPI_ATTROWNER_VERTEX, HAPI_STORAGETYPE_FLOAT, vertex_count, 3);
+    FakeAttribute& uvs = addAttribute(*geometry, "uv", HAPI_ATTROWNER_VERTEX, HAPI_STORAGETYPE_FLOAT, vertex_count, 3);
+    for (int i = 0; i < vertex_count; ++i)
+    {
+        int point = geometry->vertexList[i];
+        normals.floats[i * 3 + 1] = 1.0f;
+        uvs.floats[i * 3 + 0] = (float)(point % width) / width;
+        uvs.floats[i * 3 + 1] = (float)(point / width) / std::max(1, rows);
+    }
+
+    FakeAttribute& names = addAttribute(*geometry, "name", HAPI_ATTROWNER_PRIM, HAPI_STORAGETYPE_STRING, face_count, 1);
+    names.strings.assign(face_count, makeString(state, "fake_grid"));
+
+    return geometry;
+}
+
+// The geometry a node cooks to: uploaded data for input nodes, passed through SOP chains,
+// and the synthetic grid for anything else
+static std::shared_ptr<FakeGeometry>
+resolveGeometry(FakeState& state, HAPI_NodeId node_id)
+{
+    for (int depth = 0; depth < 1024; ++depth)
+    {
+        FakeNode* node = findNode(state, node_id);
+        if (!node)
+            break;
+        if (node->geometry)
+            return node->geometry;
+
+        auto input = node->inputs.find(0);
+        if (input == node->inputs.end())
+            break;
+        node_id = input->second;
+    }
+
+    if (!state.syntheticGeometry)
+        state.syntheticGeometry = buildSyntheticGeometry(state);
+    return state.syntheticGeometry;
+}
+
+HAPI_Result
+fakeHAPILUnimplemented(const char* function_name)
+{
+    FakeState& state = getState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+
+    static std::set<std::string> reported;
+    if (reported.insert(function_name).second)
+        std::cerr << "FakeHAPIL: " << function_name << " is not emulated." << std::endl;
+
+    return fail(state, std::string(function_name) + " is not emulated by FakeHAPIL.");
+}
+
+// Sessions
+
+static HAPI_Result
+openSession(HAPI_Session* session, HAPI_SessionType type)
+{
+    FakeState& state = getState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    if (!session)
+        return fail(state, "Invalid session argument.", HAPI_RESULT_INVALID_ARGUMENT);
+
+    session->type = type;
+    session->id = state.nextSessionId++;
+    state.sessions.insert(session->id);
+    return HAPI_RESULT_SUCCESS;
+}
+
+FAKE_HAPI_DECL HAPI_CreateInProcessSession(HAPI_Session * session, const HAPI_SessionInfo * session_info)
+{
+    return openSession(session, HAPI_SESSION_INPROCESS);
+}
+
+FAKE_HAPI_DECL HAPI_StartThriftSocketServer(const HAPI_ThriftServerOptions * options, int port, HAPI_ProcessId * process_id, const char * log_file)
+{
+    if (process_id)
+        *process_id = 0;
+    return HAPI_RESULT_SUCCESS;
+}
+
+FAKE_HAPI_DECL HAPI_StartThriftNamedPipeServer(const HAPI_ThriftServerOptions * options, const char * pipe_name, HAPI_ProcessId * process_id, const char * log_file)
+{
+    if (process_id)
+        *process_id = 0;
+    return HAPI_RESULT_SUCCESS;
+}
+
+FAKE_HAPI_DECL HAPI_StartThriftSharedMemoryServer(const HAPI_ThriftServerOptions * options, const char * shared_mem_name, HAPI_ProcessId * process_id, const char * log_file)
+{
+    if (process_id)
+        *process_id = 0;
+    return HAPI_RESULT_SUCCESS;
+}
+
+FAKE_HAPI_DECL HAPI_CreateThriftSocketSession(HAPI_Session * session, const char * host_name, int port, const HAPI_SessionInfo * session_info)
+{
+    return openSession(session, HAPI_SESSION_THRIFT);
+}
+
+FAKE_HAPI_DECL HAPI_CreateThriftNamedPipeSession(HAPI_Session * session, const char * pipe_name, const HAPI_SessionInfo * session_info)
+{
+    return openSession(session, HAPI_SESSION_THRIFT);
+}
+
+FAKE_HAPI_DECL HAPI_CreateThriftSharedMemorySession(HAPI_Session * session, const char * shared_mem_name, const HAPI_SessionInfo * session_info)
+{
+    return openSession(session, HAPI_SESSION_THRIFT);
+}
+
+FAKE_HAPI_DECL HAPI_IsSessionValid(const HAPI_Session * session)
+{
+    simulateTransport(session);
+    FakeState& state = getState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    return isValidSession(state, session) ? HAPI_RESULT_SUCCESS : HAPI_RESULT_INVALID_SESSION;
+}
+
+FAKE_HAPI_DECL HAPI_CloseSession(const HAPI_Session * session)
+{
+    FakeState& state = getState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    if (session)
+        state.sessions.erase(session->id);
+    return HAPI_RESULT_SUCCESS;
+}
+
+FAKE_HAPI_DECL HAPI_Initialize(const HAPI_Session * session, const HAPI_CookOptions * cook_options, HAPI_Bool use_cooking_thread, int cooking_thread_stack_size, const char * houdini_environment_files, const char * otl_search_path, const char * dso_search_path, const char * image_dso_search_path, const char * audio_dso_search_path)
+{
+    simulateTransport(session);
+    FakeState& state = getState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    if (!isValidSession(state, session))
+        return fail(state, "Invalid session.", HAPI_RESULT_INVALID_SESSION);
+    if (state.initialized)
+        return HAPI_RESULT_ALREADY_INITIALIZED;
+
+    state.initialized = true;
+    state.useCookingThread = use_cooking_thread != 0;
+    return HAPI_RESULT_SUCCESS;
+}
+
+FAKE_HAPI_DECL HAPI_IsInitialized(const HAPI_Session * session)
+{
+    simulateTransport(session);
+    FakeState& state = getState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    return state.initialized ? HAPI_RESULT_SUCCESS : HAPI_RESULT_NOT_INITIALIZED;
+}
+
+FAKE_HAPI_DECL HAPI_Cleanup(const HAPI_Session * session)
+{
+    simulateTransport(session);
+    FakeState& state = getState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    state.initialized = false;
+    state.nodes.clear();
+    state.assetLibraries.clear();
+    return HAPI_RESULT_SUCCESS;
+}
+
+FAKE_HAPI_DECL HAPI_Shutdown(const HAPI_Session * session)
+{
+    return HAPI_RESULT_SUCCESS;
+}
+
+FAKE_HAPI_DECL HAPI_ClearConnectionError()
+{
+    return HAPI_RESULT_SUCCESS;
+}
+
+FAKE_HAPI_DECL HAPI_GetConnectionErrorLength(int * buffer_length)
+{
+    if (buffer_length)
+        *buffer_length = 1;
+    return HAPI_RESULT_SUCCESS;
+}
+
+FAKE_HAPI_DECL HAPI_GetConnectionError(char * string_value, int length, HAPI_Bool clear)
+{
+    if (string_value && length > 0)
+        string_value[0] = '\0';
+    return HAPI_RESULT_SUCCESS;
+}
+
+FAKE_HAPI_DECL HAPI_GetStatus(const HAPI_Session * session, HAPI_StatusType status_type, int * status)
+{
+    simulateTransport(session);
+    FakeState& state = getState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    if (!status)
+        return fail(state, "Invalid status argument.", HAPI_RESULT_INVALID_ARGUMENT);
+
+    if (status_type == HAPI_STATUS_COOK_STATE)
+        *status = std::chrono::steady_clock::now() < state.cookReadyTime ? HAPI_STATE_COOKING : HAPI_STATE_READY;
+    else if (status_type == HAPI_STATUS_COOK_RESULT)
+        *status = HAPI_STATE_READY;
+    else
+        *status = state.lastError.empty() ? HAPI_RESULT_SUCCESS : HAPI_RESULT_FAILURE;
+    return HAPI_RESULT_SUCCESS;
+}
+
+FAKE_HAPI_DECL HAPI_GetStatusStringBufLength(const HAPI_Session * session, HAPI_StatusType status_type, HAPI_StatusVerbosity verbosity, int * buffer_length)
+{
+    simulateTransport(session);
+    FakeState& state = getState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    if (buffer_length)
+        *buffer_length = (int)state.lastError.size() + 1;
+    return HAPI_RESULT_SUCCESS;
+}
+
+FAKE_HAPI_DECL HAPI_GetStatusString(const HAPI_Session * session, HAPI_StatusType status_type, char * string_value, int length)
+{
+    simulateTransport(session);
+    FakeState& state = getState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    if (string_value && length > 0)
+    {
+        std::strncpy(string_value, state.lastError.c_str(), length - 1);
+        string_value[length - 1] = '\0';
+    }
+    return HAPI_RESULT_SUCCESS;
+}
+
+// Strings
+
+FAKE_HAPI_DECL HAPI_GetStringBufLength(const HAPI_Session * session, HAPI_StringHandle string_handle, int * buffer_length)
+{
+    simulateTransport(session);
+    FakeState& state = getState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    if (string_handle < 0 || string_handle >= (int)state.strings.size() || !buffer_length)
+        return fail(state, "Invalid string handle.", HAPI_RESULT_INVALID_ARGUMENT);
+
+    *buffer_length = (int)state.strings[string_handle].size() + 1;
+    return HAPI_RESULT_SUCCESS;
+}
+
+FAKE_HAPI_DECL HAPI_GetString(const HAPI_Session * session, HAPI_StringHandle string_handle, char * string_value, int length)
+{
+    simulateTransport(session, length);
+    FakeState& state = getState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    if (string_handle < 0 || string_handle >= (int)state.strings.size() || !string_value || length <= 0)
+        return fail(state, "Invalid string handle.", HAPI_RESULT_INVALID_ARGUMENT);
+
+    std::strncpy(string_value, state.strings[string_handle].c_str(), length - 1);
+    string_value[length - 1] = '\0';
+    return HAPI_RESULT_SUCCESS;
+}
+
+FAKE_HAPI_DECL HAPI_GetStringBatchSize(const HAPI_Session * session, const int * string_handle_array, int string_handle_count, int * string_buffer_size)
+{
+    simulateTransport(session, string_handle_count * sizeof(int));
+    FakeState& state = getState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    if (!string_buffer_size || (string_handle_count > 0 && !string_handle_array))
+        return fail(state, "Invalid string batch argument.", HAPI_RESULT_INVALID_ARGUMENT);
+
+    state.stringBatch.clear();
+    for (int i = 0; i < string_handle_count; ++i)
+    {
+        HAPI_StringHandle handle = string_handle_array[i];
+        if (handle < 0 || handle >= (int)state.strings.size())
+            return fail(state, "Invalid string handle.", HAPI_RESULT_INVALID_ARGUMENT);
+        state.stringBatch.append(state.strings[handle]);
+        state.stringBatch.push_back('\0');
+    }
+
+    *string_buffer_size = (int)state.stringBatch.size();
+    return HAPI_RESULT_SUCCESS;
+}
+
+FAKE_HAPI_DECL HAPI_GetStringBatch(const HAPI_Session * session, char * char_buffer, int char_array_length)
+{
+    simulateTransport(session, char_array_length);
+    FakeState& state = getState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    if (!char_buffer || char_array_length < (int)state.stringBatch.size())
+        return fail(state, "String batch buffer too small.", HAPI_RESULT_INVALID_ARGUMENT);
+
+    std::memcpy(char_buffer, state.stringBatch.data(), state.stringBatch.size());
+    return HAPI_RESULT_SUCCESS;
+}
+
+// Assets and nodes
+
+FAKE_HAPI_DECL HAPI_LoadAssetLibraryFromFile(const HAPI_Session * session, const char * file_path, HAPI_Bool allow_overwrite, HAPI_AssetLibraryId * library_id)
+{
+    simulateTransport(session);
+    FakeState& state = getState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    if (!isValidSession(state, session))
+        return fail(state, "Invalid session.", HAPI_RESULT_INVALID_SESSION);
+    if (!file_path || !library_id)
+        return fail(state, "Invalid asset library argument.", HAPI_RESULT_INVALID_ARGUMENT);
+
+    // The asset is named after the library file
+    std::string name(file_path);
+    name = name.substr(name.find_last_of("/\\") + 1);
+    name = name.substr(0, name.find('.'));
+
+    *library_id = (HAPI_AssetLibraryId)state.assetLibraries.size() + 1;
+    state.assetLibraries[*library_id] = "Object/" + name;
+    return HAPI_RESULT_SUCCESS;
+}
+
+FAKE_HAPI_DECL HAPI_GetAvailableAssetCount(const HAPI_Session * session, HAPI_AssetLibraryId library_id, int * asset_count)
+{
+    simulateTransport(session);
+    FakeState& state = getState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    if (!state.assetLibraries.count(library_id) || !asset_count)
+        return fail(state, "Invalid asset library.", HAPI_RESULT_INVALID_ARGUMENT);
+
+    *asset_count = 1;
+    return HAPI_RESULT_SUCCESS;
+}
+
+FAKE_HAPI_DECL HAPI_GetAvailableAssets(const HAPI_Session * session, HAPI_AssetLibraryId library_id, HAPI_StringHandle * asset_names_array, int asset_count)
+{
+    simulateTransport(session);
+    FakeState& state = getState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    auto library = state.assetLibraries.find(library_id);
+    if (library == state.assetLibraries.end() || !asset_names_array || asset_count < 1)
+        return fail(state, "Invalid asset library.", HAPI_RESULT_INVALID_ARGUMENT);
+
+    asset_names_array[0] = makeString(state, library->second);
+    return HAPI_RESULT_SUCCESS;
+}
+
+// Count a cook of the node, blocking for its duration without a cooking thread
+static void
+cookNode(FakeState& state, std::unique_lock<std::mutex>& lock, FakeNode& node)
+{
+    node.cookCount++;
+
+    auto duration = std::chrono::milliseconds(state.config.cookMilliseconds);
+    if (state.useCookingThread)
+    {
+        state.cookReadyTime = std::max(state.cookReadyTime, std::chrono::steady_clock::now()) + duration;
+    }
+    else
+    {
+        lock.unlock();
+        std::this_thread::sleep_for(duration);
+        lock.lock();
+    }
+}
+
+FAKE_HAPI_DECL HAPI_CreateNode(const HAPI_Session * session, HAPI_NodeId parent_node_id, const char * operator_name, const char * node_label, HAPI_Bool cook_on_creation, HAPI_NodeId * new_node_id)
+{
+    simulateTransport(session);
+    FakeState& state = getState();
+    std::unique_lock<std::mutex> lock(state.mutex);
+    if (!isValidSession(state, session))
+        return fail(state, "Invalid session.", HAPI_RESULT_INVALID_SESSION);
+    if (!operator_name || !new_node_id)
+        return fail(state, "Invalid node argument.", HAPI_RESULT_INVALID_ARGUMENT);
+
+    HAPI_NodeId node_id = state.nextNodeId++;
+    FakeNode& node = state.nodes[node_id];
+    node.operatorName = operator_name;
+    node.label = node_label ? node_label : operator_name;
+    node.isObject = node.operatorName.compare(0, 7, "Object/") == 0;
+    *new_node_id = node_id;
+
+    if (cook_on_creation)
+        cookNode(state, lock, node);
+    return HAPI_RESULT_SUCCESS;
+}
+
+FAKE_HAPI_DECL HAPI_CreateInputNode(const HAPI_Session * session, HAPI_NodeId parent_node_id, HAPI_NodeId * node_id, const char * name)
+{
+    simulateTransport(session);
+    FakeState& state = getState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    if (!isValidSession(state, session))
+        return fail(state, "Invalid session.", HAPI_RESULT_INVALID_SESSION);
+    if (!node_id)
+        return fail(state, "Invalid node argument.", HAPI_RESULT_INVALID_ARGUMENT);
+
+    *node_id = state.nextNodeId++;
+    FakeNode& node = state.nodes[*node_id];
+    node.operatorName = "Sop/null";
+    node.label = name ? name : "input";
+    node.geometry = std::make_shared<FakeGeometry>();
+    node.geometry->part = HAPI_PartInfo();
+    return HAPI_RESULT_SUCCESS;
+}
+
+FAKE_HAPI_DECL HAPI_DeleteNode(const HAPI_Session * session, HAPI_NodeId node_id)
+{
+    simulateTransport(session);
+    FakeState& state = getState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    if (!state.nodes.erase(node_id))
+        return fail(state, "Invalid node id.", HAPI_RESULT_INVALID_ARGUMENT);
+    return HAPI_RESULT_SUCCESS;
+}
+
+FAKE_HAPI_DECL HAPI_ConnectNodeInput(const HAPI_Session * session, HAPI_NodeId node_id, int input_index, HAPI_NodeId node_id_to_connect, int output_index)
+{
+    simulateTransport(session);
+    FakeState& state = getState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    FakeNode* node = findNode(state, node_id);
+    if (!node || !findNode(state, node_id_to_connect))
+        return fail(state, "Invalid node id.", HAPI_RESULT_INVALID_ARGUMENT);
+
+    node->inputs[input_index] = node_id_to_connect;
+    return HAPI_RESULT_SUCCESS;
+}
+
+FAKE_HAPI_DECL HAPI_QueryNodeInput(const HAPI_Session * session, HAPI_NodeId node_to_query, int input_index, HAPI_NodeId * connected_node_id)
+{
+    simulateTransport(session);
+    FakeState& state = getState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    FakeNode* node = findNode(state, node_to_query);
+    if (!node || !connected_node_id)
+        return fail(state, "Invalid node id.", HAPI_RESULT_INVALID_ARGUMENT);
+
+    auto input = node->inputs.find(input_index);
+    *connected_node_id = input != node->inputs.end() ? input->second : -1;
+    return HAPI_RESULT_SUCCESS;
+}
+
+FAKE_HAPI_DECL HAPI_SetNodeDisplay(const HAPI_Session * session, HAPI_NodeId node_id, int onOff)
+{
+    simulateTransport(session);
+    return HAPI_RESULT_SUCCESS;
+}
+
+FAKE_HAPI_DECL HAPI_GetNodeFromPath(const HAPI_Session * session, const HAPI_NodeId parent_node_id, const char * path, HAPI_NodeId * node_id)
+{
+    simulateTransport(session);
+    FakeState& state = getState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    if (!path || !node_id)
+        return fail(state, "Invalid path argument.", HAPI_RESULT_INVALID_ARGUMENT);
+
+    // Match on the last path component against the node labels
+    std::string name(path);
+    name = name.substr(name.find_last_of('/') + 1);
+    for (const auto& node : state.nodes)
+    {
+        if (node.second.label == name)
+        {
+            *node_id = node.first;
+            return HAPI_RESULT_SUCCESS;
+        }
+    }
+    return fail(state, "No node at " + std::string(path) + ".");
+}
+
+FAKE_HAPI_DECL HAPI_GetNodeInfo(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_NodeInfo * node_info)
+{
+    simulateTransport(session, sizeof(HAPI_NodeInfo));
+    FakeState& state = getState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    FakeNode* node = findNode(state, node_id);
+    if (!node || !node_info)
+        return fail(state, "Invalid node id.", HAPI_RESULT_INVALID_ARGUMENT);
+
+    *node_info = HAPI_NodeInfo();
+    node_info->id = node_id;
+    node_info->parentId = -1;
+    node_info->nameSH = makeString(state, node->label);
+    node_info->type = node->isObject ? HAPI_NODETYPE_OBJ : HAPI_NODETYPE_SOP;
+    node_info->isValid = true;
+    node_info->totalCookCount = node->cookCount;
+    node_info->uniqueHoudiniNodeId = node_id;
+    node_info->inputCount = (int)node->inputs.size();
+    node_info->parmCount = 1;
+    node_info->parmFloatValueCount = 3;
+    return HAPI_RESULT_SUCCESS;
+}
+
+FAKE_HAPI_DECL HAPI_GetAssetInfo(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_AssetInfo * asset_info)
+{
+    simulateTransport(session, sizeof(HAPI_AssetInfo));
+    FakeState& state = getState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    FakeNode* node = findNode(state, node_id);
+    if (!node || node->geometry || !asset_info)
+        return fail(state, "Node is not an asset.", HAPI_RESULT_INVALID_ARGUMENT);
+
+    *asset_info = HAPI_AssetInfo();
+    asset_info->nodeId = node_id;
+    asset_info->objectNodeId = node_id;
+    asset_info->nameSH = makeString(state, node->label);
+    asset_info->fullOpNameSH = makeString(state, node->operatorName);
+    return HAPI_RESULT_SUCCESS;
+}
+
+FAKE_HAPI_DECL HAPI_IsNodeValid(const HAPI_Session * session, HAPI_NodeId node_id, int unique_node_id, HAPI_Bool * answer)
+{
+    simulateTransport(session);
+    FakeState& state = getState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    if (!answer)
+        return fail(state, "Invalid answer argument.", HAPI_RESULT_INVALID_ARGUMENT);
+
+    // Node ids double as unique ids
+    *answer = findNode(state, node_id) != nullptr && unique_node_id == node_id;
+    return HAPI_RESULT_SUCCESS;
+}
+
+FAKE_HAPI_DECL HAPI_CookNode(const HAPI_Session * session, HAPI_NodeId node_id, const HAPI_CookOptions * cook_options)
+{
+    simulateTransport(session);
+    FakeState& state = getState();
+    std::unique_lock<std::mutex> lock(state.mutex);
+    FakeNode* node = findNode(state, node_id);
+    if (!node)
+        return fail(state, "Invalid node id.", HAPI_RESULT_INVALID_ARGUMENT);
+
+    cookNode(state, lock, *node);
+    return HAPI_RESULT_SUCCESS;
+}
+
+// Presets are opaque to the caller; the stand-in stores the operator name then the "size" values
+static std::string
+makePreset(const FakeNode& node)
+{
+    std::string preset = node.operatorName;
+    preset.push_back('\0');
+    preset.append((const char*)node.size, sizeof(node.size));
+    return preset;
+}
+
+FAKE_HAPI_DECL HAPI_GetPresetBufLength(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PresetType preset_type, const char * preset_name, int * buffer_length)
+{
+    simulateTransport(session);
+    FakeState& state = getState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    FakeNode* node = findNode(state, node_id);
+    if (!node || !buffer_length)
+        return fail(state, "Invalid node id.", HAPI_RESULT_INVALID_ARGUMENT);
+
+    *buffer_length = (int)makePreset(*node).size();
+    return HAPI_RESULT_SUCCESS;
+}
+
+FAKE_HAPI_DECL HAPI_GetPreset(const HAPI_Session * session, HAPI_NodeId node_id, char * buffer, int buffer_length)
+{
+    simulateTransport(session, buffer_length);
+    FakeState& state = getState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    FakeNode* node = findNode(state, node_id);
+    if (!node || !buffer)
+        return fail(state, "Invalid preset argument.", HAPI_RESULT_INVALID_ARGUMENT);
+
+    std::string preset = makePreset(*node);
+    if (buffer_length < (int)preset.size())
+        return fail(state, "Invalid preset argument.", HAPI_RESULT_INVALID_ARGUMENT);
+
+    std::memcpy(buffer, preset.data(), preset.size());
+    return HAPI_RESULT_SUCCESS;
+}
+
+FAKE_HAPI_DECL HAPI_SetPreset(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PresetType preset_type, const char * preset_name, const char * buffer, int buffer_length)
+{
+    simulateTransport(session, buffer_length);
+    FakeState& state = getState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    FakeNode* node = findNode(state, node_id);
+    if (!node || !buffer)
+        return fail(state, "Invalid preset argument.", HAPI_RESULT_INVALID_ARGUMENT);
+
+    // Only a preset of the same operator carries values the node understands
+    size_t name_length = node->operatorName.size() + 1;
+    if ((size_t)buffer_length != name_length + sizeof(node->size) ||
+        std::memcmp(buffer, node->operatorName.c_str(), name_length) != 0)
+        return fail(state, "Invalid preset for " + node->operatorName + ".", HAPI_RESULT_INVALID_ARGUMENT);
+
+    std::memcpy(node->size, buffer + name_length, sizeof(node->size));
+    return HAPI_RESULT_SUCCESS;
+}
+
+// Fill in the info of a node's "size" parameter
+static void
+makeSizeParmInfo(FakeState& state, HAPI_ParmInfo* parm_info)
+{
+    *parm_info = HAPI_ParmInfo();
+    parm_info->id = 0;
+    parm_info->parentId = -1;
+    parm_info->type = HAPI_PARMTYPE_FLOAT;
+    parm_info->size = 3;
+    parm_info->nameSH = makeString(state, "size");
+    parm_info->intValuesIndex = -1;
+    parm_info->floatValuesIndex = 0;
+    parm_info->stringValuesIndex = -1;
+    parm_info->choiceIndex = -1;
+}
+
+FAKE_HAPI_DECL HAPI_GetParameters(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_ParmInfo * parm_infos_array, int start, int length)
+{
+    simulateTransport(session, length * sizeof(HAPI_ParmInfo));
+    FakeState& state = getState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    if (!findNode(state, node_id) || start < 0 || length < 0 || start + length > 1 || (length > 0 && !parm_infos_array))
+        return fail(state, "Invalid parameter range.", HAPI_RESULT_INVALID_ARGUMENT);
+
+    if (length > 0)
+        makeSizeParmInfo(state, parm_infos_array);
+    return HAPI_RESULT_SUCCESS;
+}
+
+FAKE_HAPI_DECL HAPI_GetParmInfoFromName(const HAPI_Session * session, HAPI_NodeId node_id, const char * parm_name, HAPI_ParmInfo * parm_info)
+{
+    simulateTransport(session);
+    FakeState& state = getState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    if (!findNode(state, node_id) || !parm_info)
+        return fail(state, "Invalid node id.", HAPI_RESULT_INVALID_ARGUMENT);
+    if (!parm_name || std::string(parm_name) != "size")
+        return fail(state, "No parameter named " + std::string(parm_name ? parm_name : "") + ".");
+
+    makeSizeParmInfo(state, parm_info);
+    return HAPI_RESULT_SUCCESS;
+}
+
+FAKE_HAPI_DECL HAPI_GetParmIdFromName(const HAPI_Session * session, HAPI_NodeId node_id, const char * parm_name, HAPI_ParmId * parm_id)
+{
+    simulateTransport(session);
+    if (parm_id)
+        *parm_id = parm_name && std::string(parm_name) == "size" ? 0 : -1;
+    return HAPI_RESULT_SUCCESS;
+}
+
+// Copy a [start, start + length) range of a node's float values out of, or into, the node
+static HAPI_Result
+copyFloatParmValues(const HAPI_Session* session, HAPI_NodeId node_id, float* out, const float* in, int start, int length)
+{
+    simulateTransport(session, length * sizeof(float));
+    FakeState& state = getState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    FakeNode* node = findNode(state, node_id);
+    if (!node)
+        return fail(state, "Invalid node id.", HAPI_RESULT_INVALID_ARGUMENT);
+    if (start < 0 || length < 0 || start + length > 3)
+        return fail(state, "Invalid range.", HAPI_RESULT_INVALID_ARGUMENT);
+
+    if (out)
+        std::copy(node->size + start, node->size + start + length, out);
+    if (in)
+        std::copy(in, in + length, node->size + start);
+    return HAPI_RESULT_SUCCESS;
+}
+
+FAKE_HAPI_DECL HAPI_GetParmFloatValues(const HAPI_Session * session, HAPI_NodeId node_id, float * values_array, int start, int length)
+{
+    return copyFloatParmValues(session, node_id, values_array, nullptr, start, length);
+}
+
+FAKE_HAPI_DECL HAPI_SetParmFloatValues(const HAPI_Session * session, HAPI_NodeId node_id, const float * values_array, int start, int length)
+{
+    return copyFloatParmValues(session, node_id, nullptr, values_array, start, length);
+}
+
+// Geometry
+
+FAKE_HAPI_DECL HAPI_GetGeoInfo(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_GeoInfo * geo_info)
+{
+    simulateTransport(session, sizeof(HAPI_GeoInfo));
+    FakeState& state = getState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    FakeNode* node = findNode(state, node_id);
+    if (!node || !geo_info)
+        return fail(state, "Invalid node id.", HAPI_RESULT_INVALID_ARGUMENT);
+
+    *geo_info = HAPI_GeoInfo();
+    geo_info->type = HAPI_GEOTYPE_DEFAULT;
+    geo_info->nameSH = makeString(state, node->label);
+    geo_info->nodeId = node_id;
+    geo_info->isEditable = node->geometry != nullptr;
+    geo_info->isDisplayGeo = true;
+    geo_info->hasGeoChanged = true;
+    geo_info->partCount = 1;
+    return HAPI_RESULT_SUCCESS;
+}
+
+FAKE_HAPI_DECL HAPI_GetDisplayGeoInfo(const HAPI_Session * session, HAPI_NodeId object_node_id, HAPI_GeoInfo * geo_info)
+{
+    return HAPI_GetGeoInfo(session, object_node_id, geo_info);
+}
+
+FAKE_HAPI_DECL HAPI_GetPartInfo(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, HAPI_PartInfo * part_info)
+{
+    simulateTransport(session, sizeof(HAPI_PartInfo));
+    FakeState& state = getState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    if (!findNode(state, node_id) || part_id != 0 || !part_info)
+        return fail(state, "Invalid part id.", HAPI_RESULT_INVALID_ARGUMENT);
+
+    *part_info = resolveGeometry(state, node_id)->part;
+    part_info->id = 0;
+    part_info->hasChanged = true;
+    return HAPI_RESULT_SUCCESS;
+}
+
+// Copy a [start, start + length) range of an int array out of, or into, a part
+static HAPI_Result
+copyIntRange(FakeState& state, std::vector<int>& values, int* out, const int* in, int start, int length)
+{
+    if (start < 0 || length < 0 || (size_t)start + length > values.size())
+        return fail(state, "Invalid range.", HAPI_RESULT_INVALID_ARGUMENT);
+    if (out)
+        std::copy(values.begin() + start, values.begin() + start + length, out);
+    if (in)
+        std::copy(in, in + length, values.begin() + start);
+    return HAPI_RESULT_SUCCESS;
+}
+
+FAKE_HAPI_DECL HAPI_GetFaceCounts(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, int * face_counts_array, int start, int length)
+{
+    simulateTransport(session, length * sizeof(int));
+    FakeState& state = getState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    if (!findNode(state, node_id))
+        return fail(state, "Invalid node id.", HAPI_RESULT_INVALID_ARGUMENT);
+    return copyIntRange(state, resolveGeometry(state, node_id)->faceCounts, face_counts_array, nullptr, start, length);
+}
+
+FAKE_HAPI_DECL HAPI_GetVertexList(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, int * vertex_list_array, int start, int length)
+{
+    simulateTransport(session, length * sizeof(int));
+    FakeState& state = getState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    if (!findNode(state, node_id))
+        return fail(state, "Invalid node id.", HAPI_RESULT_INVALID_ARGUMENT);
+    return copyIntRange(state, resolveGeometry(state, node_id)->vertexList, vertex_list_array, nullptr, start, length);
+}
+
+FAKE_HAPI_DECL HAPI_GetAttributeNames(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, HAPI_AttributeOwner owner, HAPI_StringHandle * attribute_names_array, int count)
+{
+    simulateTransport(session, count * sizeof(HAPI_StringHandle));
+    FakeState& state = getState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    if (!findNode(state, node_id))
+        return fail(state, "Invalid node id.", HAPI_RESULT_INVALID_ARGUMENT);
+
+    int index = 0;
+    for (const auto& attribute : resolveGeometry(state, node_id)->attributes)
+    {
+        if (attribute.first.first == owner && index < count)
+            attribute_names_array[index++] = makeString(state, attribute.first.second);
+    }
+    return HAPI_RESULT_SUCCESS;
+}
+
+FAKE_HAPI_DECL HAPI_GetAttributeInfo(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const char * name, HAPI_AttributeOwner owner, HAPI_AttributeInfo * attr_info)
+{
+    simulateTransport(session, sizeof(HAPI_AttributeInfo));
+    FakeState& state = getState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    if (!findNode(state, node_id) || !name || !attr_info)
+        return fail(state, "Invalid attribute argument.", HAPI_RESULT_INVALID_ARGUMENT);
+
+    // Missing attributes are reported through exists, not as an error
+    FakeAttribute* attribute = resolveGeometry(state, node_id)->find(owner, name);
+    if (attribute)
+    {
+        *attr_info = attribute->info;
+    }
+    else
+    {
+        *attr_info = HAPI_AttributeInfo();
+        attr_info->exists = false;
+        attr_info->owner = owner;
+        attr_info->storage = HAPI_STORAGETYPE_INVALID;
+    }
+    return HAPI_RESULT_SUCCESS;
+}
+
+// Find an attribute of the node's geometry with the expected storage, for reads or writes
+static FakeAttribute*
+findAttribute(FakeState& state, HAPI_NodeId node_id, const char* name, HAPI_AttributeOwner owner, bool writable)
+{
+    FakeNode* node = findNode(state, node_id);
+    if (!node || !name || (writable && !node->geometry))
+        return nullptr;
+
+    std::shared_ptr<FakeGeometry> geometry = writable ? node->geometry : resolveGeometry(state, node_id);
+    return geometry->find(owner, name);
+}
+
+template <typename T>
+static HAPI_Result
+copyTuples(FakeState& state, std::vector<T>& values, int tuple_size, T* out, const T* in, int start, int length)
+{
+    const size_t begin = (size_t)start * tuple_size;
+    const size_t count = (size_t)length * tuple_size;
+    if (start < 0 || length < 0 || begin + count > values.size())
+        return fail(state, "Invalid attribute range.", HAPI_RESULT_INVALID_ARGUMENT);
+    if (out)
+        std::copy(values.begin() + begin, values.begin() + begin + count, out);
+    if (in)
+        std::copy(in, in + count, values.begin() + begin);
+    return HAPI_RESULT_SUCCESS;
+}
+
+FAKE_HAPI_DECL HAPI_GetAttributeFloatData(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const char * name, HAPI_AttributeInfo * attr_info, int stride, float * data_array, int start, int length)
+{
+    simulateTransport(session, (size_t)length * std::max(1, attr_info ? attr_info->tupleSize : 1) * sizeof(float));
+    FakeState& state = getState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    FakeAttribute* attribute = attr_info ? findAttribute(state, node_id, name, attr_info->owner, false) : nullptr;
+    if (!attribute || attribute->info.storage != HAPI_STORAGETYPE_FLOAT)
+        return fail(state, "Invalid float attribute.", HAPI_RESULT_INVALID_ARGUMENT);
+    return copyTuples<float>(state, attribute->floats, attribute->info.tupleSize, data_array, nullptr, start, length);
+}
+
+FAKE_HAPI_DECL HAPI_GetAttributeIntData(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const char * name, HAPI_AttributeInfo * attr_info, int stride, int * data_array, int start, int length)
+{
+    simulateTransport(session, (size_t)length * std::max(1, attr_info ? attr_info->tupleSize : 1) * sizeof(int));
+    FakeState& state = getState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    FakeAttribute* attribute = attr_info ? findAttribute(state, node_id, name, attr_info->owner, false) : nullptr;
+    if (!attribute || attribute->info.storage != HAPI_STORAGETYPE_INT)
+        return fail(state, "Invalid int attribute.", HAPI_RESULT_INVALID_ARGUMENT);
+    return copyTuples<int>(state, attribute->ints, attribute->info.tupleSize, data_array, nullptr, start, length);
+}
+
+FAKE_HAPI_DECL HAPI_GetAttributeStringData(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const char * name, HAPI_AttributeInfo * attr_info, HAPI_StringHandle * data_array, int start, int length)
+{
+    simulateTransport(session, (size_t)length * sizeof(HAPI_StringHandle));
+    FakeState& state = getState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    FakeAttribute* attribute = attr_info ? findAttribute(state, node_id, name, attr_info->owner, false) : nullptr;
+    if (!attribute || attribute->info.storage != HAPI_STORAGETYPE_STRING)
+        return fail(state, "Invalid string attribute.", HAPI_RESULT_INVALID_ARGUMENT);
+    return copyTuples<HAPI_StringHandle>(state, attribute->strings, attribute->info.tupleSize, data_array, nullptr, start, length);
+}
+
+FAKE_HAPI_DECL HAPI_GetMaterialNodeIdsOnFaces(const HAPI_Session * session, HAPI_NodeId geometry_node_id, HAPI_PartId part_id, HAPI_Bool * are_all_the_same, HAPI_NodeId * material_ids_array, int start, int length)
+{
+    simulateTransport(session, (size_t)length * sizeof(HAPI_NodeId));
+    if (are_all_the_same)
+        *are_all_the_same = true;
+    if (material_ids_array)
+        std::fill(material_ids_array, material_ids_array + std::max(0, length), -1);
+    return HAPI_RESULT_SUCCESS;
+}
+
+// Input geometry
+
+FAKE_HAPI_DECL HAPI_SetPartInfo(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const HAPI_PartInfo * part_info)
+{
+    simulateTransport(session, sizeof(HAPI_PartInfo));
+    FakeState& state = getState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    FakeNode* node = findNode(state, node_id);
+    if (!node || !node->geometry || !part_info)
+        return fail(state, "Not an input node.", HAPI_RESULT_INVALID_ARGUMENT);
+
+    // Setting the part info starts a new geometry
+    FakeGeometry& geometry = *node->geometry;
+    geometry = FakeGeometry();
+    geometry.part = *part_info;
+    std::fill(std::begin(geometry.part.attributeCounts), std::end(geometry.part.attributeCounts), 0);
+    geometry.faceCounts.assign(std::max(0, part_info->faceCount), 0);
+    geometry.vertexList.assign(std::max(0, part_info->vertexCount), 0);
+    return HAPI_RESULT_SUCCESS;
+}
+
+FAKE_HAPI_DECL HAPI_SetFaceCounts(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const int * face_counts_array, int start, int length)
+{
+    simulateTransport(session, (size_t)length * sizeof(int));
+    FakeState& state = getState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    FakeNode* node = findNode(state, node_id);
+    if (!node || !node->geometry)
+        return fail(state, "Not an input node.", HAPI_RESULT_INVALID_ARGUMENT);
+    return copyIntRange(state, node->geometry->faceCounts, nullptr, face_counts_array, start, length);
+}
+
+FAKE_HAPI_DECL HAPI_SetVertexList(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const int * vertex_list_array, int start, int length)
+{
+    simulateTransport(session, (size_t)length * sizeof(int));
+    FakeState& state = getState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    FakeNode* node = findNode(state, node_id);
+    if (!node || !node->geometry)
+        return fail(state, "Not an input node.", HAPI_RESULT_INVALID_ARGUMENT);
+    return copyIntRange(state, node->geometry->vertexList, nullptr, vertex_list_array, start, length);
+}
+
+FAKE_HAPI_DECL HAPI_AddAttribute(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const char * name, const HAPI_AttributeInfo * attr_info)
+{
+    simulateTransport(session, sizeof(HAPI_AttributeInfo));
+    FakeState& state = getState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    FakeNode* node = findNode(state, node_id);
+    if (!node || !node->geometry || !name || !attr_info)
+        return fail(state, "Not an input node.", HAPI_RESULT_INVALID_ARGUMENT);
+
+    addAttribute(*node->geometry, name, attr_info->owner, attr_info->storage, attr_info->count, std::max(1, attr_info->tupleSize));
+    return HAPI_RESULT_SUCCESS;
+}
+
+FAKE_HAPI_DECL HAPI_SetAttributeFloatData(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const char * name, const HAPI_AttributeInfo * attr_info, const float * data_array, int start, int length)
+{
+    simulateTransport(session, (size_t)length * std::max(1, attr_info ? attr_info->tupleSize : 1) * sizeof(float));
+    FakeState& state = getState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    FakeAttribute* attribute = attr_info ? findAttribute(state, node_id, name, attr_info->owner, true) : nullptr;
+    if (!attribute || attribute->info.storage != HAPI_STORAGETYPE_FLOAT)
+        return fail(state, "Invalid float attribute.", HAPI_RESULT_INVALID_ARGUMENT);
+    return copyTuples<float>(state, attribute->floats, attribute->info.tupleSize, nullptr, data_array, start, length);
+}
+
+FAKE_HAPI_DECL HAPI_SetAttributeIntData(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const char * name, const HAPI_AttributeInfo * attr_info, const int * data_array, int start, int length)
+{
+    simulateTransport(session, (size_t)length * std::max(1, attr_info ? attr_info->tupleSize : 1) * sizeof(int));
+    FakeState& state = getState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    FakeAttribute* attribute = attr_info ? findAttribute(state, node_id, name, attr_info->owner, true) : nullptr;
+    if (!attribute || attribute->info.storage != HAPI_STORAGETYPE_INT)
+        return fail(state, "Invalid int attribute.", HAPI_RESULT_INVALID_ARGUMENT);
+    return copyTuples<int>(state, attribute->ints, attribute->info.tupleSize, nullptr, data_array, start, length);
+}
+
+// Replicate a single tuple over [start_index, start_index + num_indices)
+template <typename T>
+static HAPI_Result
+fillTuples(FakeState& state, std::vector<T>& values, int tuple_size, const T* tuple, int data_length, int start_index, int num_indices)
+{
+    if (!tuple || data_length < tuple_size || start_index < 0 || num_indices < 0 ||
+        (size_t)(start_index + num_indices) * tuple_size > values.size())
+        return fail(state, "Invalid attribute range.", HAPI_RESULT_INVALID_ARGUMENT);
+
+    for (int i = start_index; i < start_index + num_indices; ++i)
+        std::copy(tuple, tuple + tuple_size, values.begin() + (size_t)i * tuple_size);
+    return HAPI_RESULT_SUCCESS;
+}
+
+FAKE_HAPI_DECL HAPI_SetAttributeFloatUniqueData(const HAPI_Session* session, HAPI_NodeId node_id, HAPI_PartId part_id, const char* name, const HAPI_AttributeInfo* attr_info, const float* data_array, int data_length, int start_index, int num_indices)
+{
+    simulateTransport(session, (size_t)data_length * sizeof(float));
+    FakeState& state = getState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    FakeAttribute* attribute = attr_info ? findAttribute(state, node_id, name, attr_info->owner, true) : nullptr;
+    if (!attribute || attribute->info.storage != HAPI_STORAGETYPE_FLOAT)
+        return fail(state, "Invalid float attribute.", HAPI_RESULT_INVALID_ARGUMENT);
+    return fillTuples<float>(state, attribute->floats, attribute->info.tupleSize, data_array, data_length, start_index, num_indices);
+}
+
+FAKE_HAPI_DECL HAPI_SetAttributeIntUniqueData(const HAPI_Session* session, HAPI_NodeId node_id, HAPI_PartId part_id, const char* name, const HAPI_AttributeInfo* attr_info, const int* data_array, int data_length, int start_index, int num_indices)
+{
+    simulateTransport(session, (size_t)data_length * sizeof(int));
+    FakeState& state = getState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    FakeAttribute* attribute = attr_info ? findAttribute(state, node_id, name, attr_info->owner, true) : nullptr;
+    if (!attribute || attribute->info.storage != HAPI_STORAGETYPE_INT)
+        return fail(state, "Invalid int attribute.", HAPI_RESULT_INVALID_ARGUMENT);
+    return fillTuples<int>(state, attribute->ints, attribute->info.tupleSize, data_array, data_length, start_index, num_indices);
+}
+
+FAKE_HAPI_DECL HAPI_SetAttributeStringData(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const char * name, const HAPI_AttributeInfo * attr_info, const char ** data_array, int start, int length)
+{
+    simulateTransport(session, (size_t)length * sizeof(char*));
+    FakeState& state = getState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    FakeAttribute* attribute = attr_info ? findAttribute(state, node_id, name, attr_info->owner, true) : nullptr;
+    if (!attribute || attribute->info.storage != HAPI_STORAGETYPE_STRING || !data_array)
+        return fail(state, "Invalid string attribute.", HAPI_RESULT_INVALID_ARGUMENT);
+
+    std::vector<HAPI_StringHandle> handles(length * attribute->info.tupleSize);
+    for (size_t i = 0; i < handles.size(); ++i)
+        handles[i] = makeString(state, data_array[i] ? data_array[i] : "");
+    return copyTuples<HAPI_StringHandle>(state, attribute->strings, attribute->info.tupleSize, nullptr, handles.data(), start, length);
+}
+
+FAKE_HAPI_DECL HAPI_SetAttributeStringUniqueData(const HAPI_Session* session, HAPI_NodeId node_id, HAPI_PartId part_id, const char* name, const HAPI_AttributeInfo* attr_info, const char* data_array, int data_length, int start_index, int num_indices)
+{
+    simulateTransport(session, data_array ? std::strlen(data_array) : 0);
+    FakeState& state = getState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    FakeAttribute* attribute = attr_info ? findAttribute(state, node_id, name, attr_info->owner, true) : nullptr;
+    if (!attribute || attribute->info.storage != HAPI_STORAGETYPE_STRING || !data_array)
+        return fail(state, "Invalid string attribute.", HAPI_RESULT_INVALID_ARGUMENT);
+
+    std::vector<HAPI_StringHandle> tuple(attribute->info.tupleSize, makeString(state, data_array));
+    return fillTuples<HAPI_StringHandle>(state, attribute->strings, attribute->info.tupleSize, tuple.data(),
+                                         (int)tuple.size(), start_index, num_indices);
+}
+
+FAKE_HAPI_DECL HAPI_SetAttributeIndexedStringData(const HAPI_Session* session, HAPI_NodeId node_id, HAPI_PartId part_id, const char* name, const HAPI_AttributeInfo* attr_info, const char** string_array, int string_count, const int* indices_array, int indices_start, int indices_length)
+{
+    simulateTransport(session, (size_t)indices_length * sizeof(int));
+    FakeState& state = getState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    FakeAttribute* attribute = attr_info ? findAttribute(state, node_id, name, attr_info->owner, true) : nullptr;
+    if (!attribute || attribute->info.storage != HAPI_STORAGETYPE_STRING || !string_array || !indices_array)
+        return fail(state, "Invalid string attribute.", HAPI_RESULT_INVALID_ARGUMENT);
+
+    std::vector<HAPI_StringHandle> dictionary(string_count);
+    for (int i = 0; i < string_count; ++i)
+        dictionary[i] = makeString(state, string_array[i] ? string_array[i] : "");
+
+    const int tuple_size = attribute->info.tupleSize;
+    std::vector<HAPI_StringHandle> handles((size_t)indices_length * tuple_size);
+    for (size_t i = 0; i < handles.size(); ++i)
+    {
+        int index = indices_array[i];
+        if (index < 0 || index >= string_count)
+            return fail(state, "Invalid string index.", HAPI_RESULT_INVALID_ARGUMENT);
+        handles[i] = dictionary[index];
+    }
+    return copyTuples<HAPI_StringHandle>(state, attribute->strings, tuple_size, nullptr, handles.data(), indices_start, indices_length);
+}
+
+FAKE_HAPI_DECL HAPI_CommitGeo(const HAPI_Session * session, HAPI_NodeId node_id)
+{
+    simulateTransport(session);
+    FakeState& state = getState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    FakeNode* node = findNode(state, node_id);
+    if (!node || !node->geometry)
+        return fail(state, "Not an input node.", HAPI_RESULT_INVALID_ARGUMENT);
+
+    node->cookCount++;
+    return HAPI_RESULT_SUCCESS;
+}
+
+// Geometry blobs, serialized with the sample's own .bgeo codec
+
+static void
+geometryToMesh(FakeState& state, const FakeGeometry& geometry, HoudiniEngineMesh& mesh)
+{
+    mesh.pointCount = geometry.part.pointCount;
+    mesh.faceCounts = geometry.faceCounts;
+    mesh.vertexList = geometry.vertexList;
+
+    for (const auto& entry : geometry.attributes)
+    {
+        const FakeAttribute& source = entry.second;
+        HoudiniEngineMeshAttribute attribute;
+        attribute.name = entry.first.second;
+        attribute.owner = (HAPI_AttributeOwner)entry.first.first;
+        attribute.tupleSize = source.info.tupleSize;
+
+        if (source.info.storage == HAPI_STORAGETYPE_STRING)
+        {
+            attribute.isString = true;
+            std::unordered_map<HAPI_StringHandle, int> indices;
+            attribute.indices.resize(source.strings.size());
+            for (size_t i = 0; i < source.strings.size(); ++i)
+            {
+                auto index = indices.emplace(source.strings[i], (int)attribute.strings.size());
+                if (index.second)
+                    attribute.strings.push_back(state.strings[source.strings[i]]);
+                attribute.indices[i] = index.first->second;
+            }
+        }
+        else if (source.info.storage == HAPI_STORAGETYPE_INT)
+        {
+            attribute.isInt = true;
+            attribute.intValues = source.ints;
+        }
+        else
+            attribute.values = source.floats;
+
+        mesh.attributes.push_back(std::move(attribute));
+    }
+}
+
+static void
+meshToGeometry(FakeState& state, const HoudiniEngineMesh& mesh, FakeGeometry& geometry)
+{
+    geometry = FakeGeometry();
+    geometry.part.type = HAPI_PARTTYPE_MESH;
+    geometry.part.pointCount = mesh.pointCount;
+    geometry.part.faceCount = (int)mesh.faceCounts.size();
+    geometry.part.vertexCount = (int)mesh.vertexList.size();
+    geometry.faceCounts = mesh.faceCounts;
+    geometry.vertexList = mesh.vertexList;
+
+    for (const HoudiniEngineMeshAttribute& source : mesh.attributes)
+    {
+        const int count =
+            source.owner == HAPI_ATTROWNER_VERTEX ? geometry.part.vertexCount :
+            source.owner == HAPI_ATTROWNER_PRIM ? geometry.part.faceCount : geometry.part.pointCount;
+        FakeAttribute& attribute = addAttribute(
+            geometry, source.name, source.owner,
+            source.isString ? HAPI_STORAGETYPE_STRING : source.isInt ? HAPI_STORAGETYPE_INT : HAPI_STORAGETYPE_FLOAT,
+            count, source.tupleSize);
+
+        if (source.isString)
+        {
+            std::vector<HAPI_StringHandle> handles;
+            for (const std::string& string : source.strings)
+                handles.push_back(makeString(state, string));
+            for (size_t i = 0; i < source.indices.size() && i < attribute.strings.size(); ++i)
+                attribute.strings[i] = source.indices[i] >= 0 ? handles[source.indices[i]] : 0;
+        }
+        else if (source.isInt)
+            attribute.ints = source.intValues;
+        else
+            attribute.floats = source.values;
+    }
+}
+
+FAKE_HAPI_DECL HAPI_GetGeoSize(const HAPI_Session * session, HAPI_NodeId node_id, const char * format, int * size)
+{
+    simulateTransport(session);
+    FakeState& state = getState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    if (!findNode(state, node_id) || !size)
+        return fail(state, "Invalid node id.", HAPI_RESULT_INVALID_ARGUMENT);
+    if (!format || std::string(format) != ".bgeo")
+        return fail(state, "FakeHAPIL only serializes .bgeo geometry.", HAPI_RESULT_INVALID_ARGUMENT);
+
+    HoudiniEngineMesh mesh;
+    geometryToMesh(state, *resolveGeometry(state, node_id), mesh);
+
+    std::vector<char>& blob = state.savedGeometry[node_id];
+    HoudiniEngineBgeo::encode(mesh, blob);
+    *size = (int)blob.size();
+    return HAPI_RESULT_SUCCESS;
+}
+
+FAKE_HAPI_DECL HAPI_SaveGeoToMemory(const HAPI_Session * session, HAPI_NodeId node_id, char * buffer, int length)
+{
+    simulateTransport(session, std::max(0, length));
+    FakeState& state = getState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    auto blob = state.savedGeometry.find(node_id);
+    if (blob == state.savedGeometry.end() || !buffer || length != (int)blob->second.size())
+        return fail(state, "Call GetGeoSize before SaveGeoToMemory.", HAPI_RESULT_INVALID_ARGUMENT);
+
+    std::copy(blob->second.begin(), blob->second.end(), buffer);
+    state.savedGeometry.erase(blob);
+    return HAPI_RESULT_SUCCESS;
+}
+
+FAKE_HAPI_DECL HAPI_LoadGeoFromMemory(const HAPI_Session * session, HAPI_NodeId node_id, const char * format, const char * buffer, int length)
+{
+    simulateTransport(session, std::max(0, length));
+    if (!format || std::string(format) != ".bgeo" || !buffer || length < 0)
+    {
+        FakeState& state = getState();
+        std::lock_guard<std::mutex> lock(state.mutex);
+        return fail(state, "FakeHAPIL only loads .bgeo geometry.", HAPI_RESULT_INVALID_ARGUMENT);
+    }
+
+    // Decode before locking, as the host does
+    HoudiniEngineMesh mesh;
+    std::string error;
+    bool decoded = HoudiniEngineBgeo::decode(buffer, (size_t)length, mesh, error);
+
+    FakeState& state = getState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    FakeNode* node = findNode(state, node_id);
+    if (!node || !node->geometry)
+        return fail(state, "Not an input node.", HAPI_RESULT_INVALID_ARGUMENT);
+    if (!decoded)
+        return fail(state, "Invalid .bgeo geometry: " + error);
+
+    meshToGeometry(state, mesh, *node->geometry);
+    node->cookCount++;
+    return HAPI_RESULT_SUCCESS;
+}
+
+// Files and profiling, accepted without writing anything
+
+FAKE_HAPI_DECL HAPI_SaveHIPFile(const HAPI_Session * session, const char * file_path, HAPI_Bool lock_nodes)
+{
+    simulateTransport(session);
+    return HAPI_RESULT_SUCCESS;
+}
+
+FAKE_HAPI_DECL HAPI_SaveGeoToFile(const HAPI_Session * session, HAPI_NodeId node_id, const char * file_name)
+{
+    simulateTransport(session);
+    return HAPI_RESULT_SUCCESS;
+}
+
+FAKE_HAPI_DECL HAPI_StartPerformanceMonitorProfile(const HAPI_Session * session, const char * title, int * profile_id)
+{
+    simulateTransport(session);
+    FakeState& state = getState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    if (profile_id)
+        *profile_id = state.nextProfileId++;
+    return HAPI_RESULT_SUCCESS;
+}
+
+FAKE_HAPI_DECL HAPI_StopPerformanceMonitorProfile(const HAPI_Session *session, int profile_id, const char * file_path)
+{
+    simulateTransport(session);
+    return HAPI_RESULT_SUCCESS;
+}
+
+// Struct helpers
+
+FAKE_HAPI_DECL_RETURN(void) HAPI_CookOptions_Init(HAPI_CookOptions * in)
+{
+    *in = HAPI_CookOptions();
+    in->maxVerticesPerPrimitive = -1;
+    in->refineCurveToLinear = true;
+    in->curveRefineLOD = 8.0f;
+    in->clearErrorsAndWarnings = false;
+    in->splitGroupSH = 0;
+    in->splitAttrSH = 0;
+    in->packedPrimInstancingMode = HAPI_PACKEDPRIM_INSTANCING_MODE_DISABLED;
+    in->checkPartChanges = false;
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_CookOptions) HAPI_CookOptions_Create()
+{
+    HAPI_CookOptions cook_options;
+    HAPI_CookOptions_Init(&cook_options);
+    return cook_options;
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Bool) HAPI_CookOptions_AreEqual(const HAPI_CookOptions * left, const HAPI_CookOptions * right)
+{
+    return left->splitGeosByGroup == right->splitGeosByGroup &&
+           left->splitGroupSH == right->splitGroupSH &&
+           left->splitGeosByAttribute == right->splitGeosByAttribute &&
+           left->splitAttrSH == right->splitAttrSH &&
+           left->maxVerticesPerPrimitive == right->maxVerticesPerPrimitive &&
+           left->refineCurveToLinear == right->refineCurveToLinear &&
+           left->curveRefineLOD == right->curveRefineLOD &&
+           left->cookTemplatedGeos == right->cookTemplatedGeos &&
+           left->splitPointsByVertexAttributes == right->splitPointsByVertexAttributes &&
+           left->packedPrimInstancingMode == right->packedPrimInstancingMode &&
+           left->handleBoxPartTypes == right->handleBoxPartTypes &&
+           left->handleSpherePartTypes == right->handleSpherePartTypes &&
+           left->checkPartChanges == right->checkPartChanges &&
+           left->cacheMeshTopology == right->cacheMeshTopology &&
+           left->preferOutputNodes == right->preferOutputNodes &&
+           left->extraFlags == right->extraFlags;
+}
+
+FAKE_HAPI_DECL_RETURN(void) HAPI_AttributeInfo_Init(HAPI_AttributeInfo * in)
+{
+    *in = HAPI_AttributeInfo();
+    in->owner = HAPI_ATTROWNER_INVALID;
+    in->storage = HAPI_STORAGETYPE_INVALID;
+    in->originalOwner = HAPI_ATTROWNER_INVALID;
+    in->typeInfo = HAPI_ATTRIBUTE_TYPE_INVALID;
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_AttributeInfo) HAPI_AttributeInfo_Create()
+{
+    HAPI_AttributeInfo attribute_info;
+    HAPI_AttributeInfo_Init(&attribute_info);
+    return attribute_info;
+}
+
+FAKE_HAPI_DECL_RETURN(void) HAPI_PartInfo_Init(HAPI_PartInfo * in)
+{
+    *in = HAPI_PartInfo();
+    in->type = HAPI_PARTTYPE_INVALID;
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_PartInfo) HAPI_PartInfo_Create()
+{
+    HAPI_PartInfo part_info;
+    HAPI_PartInfo_Init(&part_info);
+    return part_info;
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Bool) HAPI_ParmInfo_IsInt(const HAPI_ParmInfo * in)
+{
+    return in->type >= HAPI_PARMTYPE_INT_START && in->type <= HAPI_PARMTYPE_INT_END;
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Bool) HAPI_ParmInfo_IsFloat(const HAPI_ParmInfo * in)
+{
+    return in->type >= HAPI_PARMTYPE_FLOAT_START && in->type <= HAPI_PARMTYPE_FLOAT_END;
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Bool) HAPI_ParmInfo_IsString(const HAPI_ParmInfo * in)
+{
+    return in->type >= HAPI_PARMTYPE_STRING_START && in->type <= HAPI_PARMTYPE_STRING_END;
+}
+
+FAKE_HAPI_DECL_RETURN(int) HAPI_ParmInfo_GetIntValueCount(const HAPI_ParmInfo * in)
+{
+    return HAPI_ParmInfo_IsInt(in) ? in->size : 0;
+}
+
+FAKE_HAPI_DECL_RETURN(int) HAPI_ParmInfo_GetFloatValueCount(const HAPI_ParmInfo * in)
+{
+    return HAPI_ParmInfo_IsFloat(in) ? in->size : 0;
+}
+
+FAKE_HAPI_DECL_RETURN(int) HAPI_ParmInfo_GetStringValueCount(const HAPI_ParmInfo* in)
+{
+    return HAPI_ParmInfo_IsString(in) ? in->size : 0;
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_SessionInfo) HAPI_SessionInfo_Create()
+{
+    HAPI_SessionInfo session_info = HAPI_SessionInfo();
+    session_info.sharedMemoryBufferType = HAPI_THRIFT_SHARED_MEMORY_FIXED_LENGTH_BUFFER;
+    session_info.sharedMemoryBufferSize = 100;
+    return session_info;
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_ThriftServerOptions) HAPI_ThriftServerOptions_Create()
+{
+    HAPI_ThriftServerOptions server_options = HAPI_ThriftServerOptions();
+    server_options.autoClose = true;
+    server_options.timeoutMs = 3000.0f;
+    server_options.sharedMemoryBufferType = HAPI_THRIFT_SHARED_MEMORY_FIXED_LENGTH_BUFFER;
+    server_options.sharedMemoryBufferSize = 100;
+    return server_options;
+}
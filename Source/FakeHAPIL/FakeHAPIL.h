@@ -0,0 +1,53 @@
+/*
+* Copyright (c) <2023> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#pragma once
+
+#include <HAPI/HAPI_Common.h>
+
+// Stand-in for libHAPIL exporting the HAPI_* entry points resolved by HoudiniApi::InitializeHAPI.
+// It needs no Houdini install or license: nodes cook to synthetic geometry, input nodes keep
+// what was uploaded to them, every node has one float3 "size" parameter carried by its presets,
+// and remote sessions are emulated by injecting latency per call.
+//
+// Configured from the environment when the library is loaded:
+//   FAKE_HAPIL_POINTS          points of the synthetic grid (default 10000)
+//   FAKE_HAPIL_FACES           triangles of the synthetic grid (default: the whole grid)
+//   FAKE_HAPIL_ATTRIBUTES      extra float point attributes attrib0 .. attribK-1 (default 0)
+//   FAKE_HAPIL_COOK_MS         simulated duration of each cook (default 0)
+//   FAKE_HAPIL_LATENCY_US      latency added to each call on a Thrift session (default 0)
+//   FAKE_HAPIL_BANDWIDTH_MBPS  bandwidth of Thrift sessions for bulk data, 0 for unlimited (default 0)
+
+#if defined(WIN32) || defined(_WIN32)
+    #define FAKE_HAPI_DECL_RETURN( RETURN_TYPE ) extern "C" __declspec(dllexport) RETURN_TYPE
+#else
+    #define FAKE_HAPI_DECL_RETURN( RETURN_TYPE ) extern "C" __attribute__((visibility("default"))) RETURN_TYPE
+#endif
+
+#define FAKE_HAPI_DECL FAKE_HAPI_DECL_RETURN( HAPI_Result )
+
+// Result of an entry point the stand-in does not emulate, logged once per function
+HAPI_Result fakeHAPILUnimplemented(const char* function_name);
@@ -0,0 +1,1760 @@
+/*
+ * Copyright (c) <2024> Side Effects Software Inc. *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *
+ * COMMENTS:
+ *      This file is generated. Do not modify directly.
+ */
+
+// This file is generated by GenerateStubs.py. Do not modify directly.
+
+#include "FakeHAPIL.h"
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_AddGroup(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, HAPI_GroupType group_type, const char * group_name)
+{
+    return fakeHAPILUnimplemented("HAPI_AddGroup");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_AssetInfo) HAPI_AssetInfo_Create()
+{
+    return HAPI_AssetInfo();
+}
+
+FAKE_HAPI_DECL_RETURN(void) HAPI_AssetInfo_Init(HAPI_AssetInfo * in)
+{
+    if (in)
+        *in = HAPI_AssetInfo();
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_BindCustomImplementation(HAPI_SessionType session_type, const char * dll_path)
+{
+    return fakeHAPILUnimplemented("HAPI_BindCustomImplementation");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_CancelPDGCook(const HAPI_Session * session, HAPI_PDG_GraphContextId graph_context_id)
+{
+    return fakeHAPILUnimplemented("HAPI_CancelPDGCook");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_CheckForSpecificErrors(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_ErrorCodeBits errors_to_look_for, HAPI_ErrorCodeBits * errors_found)
+{
+    return fakeHAPILUnimplemented("HAPI_CheckForSpecificErrors");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_CommitWorkItems(const HAPI_Session * session, HAPI_NodeId node_id)
+{
+    return fakeHAPILUnimplemented("HAPI_CommitWorkItems");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_CommitWorkitems(const HAPI_Session * session, HAPI_NodeId node_id)
+{
+    return fakeHAPILUnimplemented("HAPI_CommitWorkitems");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_ComposeChildNodeList(const HAPI_Session * session, HAPI_NodeId parent_node_id, HAPI_NodeTypeBits node_type_filter, HAPI_NodeFlagsBits node_flags_filter, HAPI_Bool recursive, int * count)
+{
+    return fakeHAPILUnimplemented("HAPI_ComposeChildNodeList");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_ComposeNodeCookResult(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_StatusVerbosity verbosity, int * buffer_length)
+{
+    return fakeHAPILUnimplemented("HAPI_ComposeNodeCookResult");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_ComposeObjectList(const HAPI_Session * session, HAPI_NodeId parent_node_id, const char * categories, int * object_count)
+{
+    return fakeHAPILUnimplemented("HAPI_ComposeObjectList");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_CompositorOptions) HAPI_CompositorOptions_Create()
+{
+    return HAPI_CompositorOptions();
+}
+
+FAKE_HAPI_DECL_RETURN(void) HAPI_CompositorOptions_Init(HAPI_CompositorOptions * in)
+{
+    if (in)
+        *in = HAPI_CompositorOptions();
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_ConvertMatrixToEuler(const HAPI_Session * session, const float * matrix, HAPI_RSTOrder rst_order, HAPI_XYZOrder rot_order, HAPI_TransformEuler * transform_out)
+{
+    return fakeHAPILUnimplemented("HAPI_ConvertMatrixToEuler");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_ConvertMatrixToQuat(const HAPI_Session * session, const float * matrix, HAPI_RSTOrder rst_order, HAPI_Transform * transform_out)
+{
+    return fakeHAPILUnimplemented("HAPI_ConvertMatrixToQuat");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_ConvertTransform(const HAPI_Session * session, const HAPI_TransformEuler * transform_in, HAPI_RSTOrder rst_order, HAPI_XYZOrder rot_order, HAPI_TransformEuler * transform_out)
+{
+    return fakeHAPILUnimplemented("HAPI_ConvertTransform");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_ConvertTransformEulerToMatrix(const HAPI_Session * session, const HAPI_TransformEuler * transform, float * matrix)
+{
+    return fakeHAPILUnimplemented("HAPI_ConvertTransformEulerToMatrix");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_ConvertTransformQuatToMatrix(const HAPI_Session * session, const HAPI_Transform * transform, float * matrix)
+{
+    return fakeHAPILUnimplemented("HAPI_ConvertTransformQuatToMatrix");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_CookPDG(const HAPI_Session * session, HAPI_NodeId cook_node_id, int generate_only, int blocking)
+{
+    return fakeHAPILUnimplemented("HAPI_CookPDG");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_CookPDGAllOutputs(const HAPI_Session* session, HAPI_NodeId cook_node_id, int generate_only, int blocking)
+{
+    return fakeHAPILUnimplemented("HAPI_CookPDGAllOutputs");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_CreateCustomSession(HAPI_SessionType session_type, void * session_info, HAPI_Session * session)
+{
+    return fakeHAPILUnimplemented("HAPI_CreateCustomSession");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_CreateHeightFieldInput(const HAPI_Session * session, HAPI_NodeId parent_node_id, const char * name, int xsize, int ysize, float voxelsize, HAPI_HeightFieldSampling sampling, HAPI_NodeId * heightfield_node_id, HAPI_NodeId * height_node_id, HAPI_NodeId * mask_node_id, HAPI_NodeId * merge_node_id)
+{
+    return fakeHAPILUnimplemented("HAPI_CreateHeightFieldInput");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_CreateHeightfieldInputVolumeNode(const HAPI_Session * session, HAPI_NodeId parent_node_id, HAPI_NodeId * new_node_id, const char * name, int xsize, int ysize, float voxelsize)
+{
+    return fakeHAPILUnimplemented("HAPI_CreateHeightfieldInputVolumeNode");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_CreateInputCurveNode(const HAPI_Session * session, HAPI_NodeId parent_node_id, HAPI_NodeId * node_id, const char * name)
+{
+    return fakeHAPILUnimplemented("HAPI_CreateInputCurveNode");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_CreateWorkItem(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PDG_WorkItemId * work_item_id, const char * name, int index)
+{
+    return fakeHAPILUnimplemented("HAPI_CreateWorkItem");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_CreateWorkitem(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PDG_WorkItemId * workitem_id, const char * name, int index)
+{
+    return fakeHAPILUnimplemented("HAPI_CreateWorkitem");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_CurveInfo) HAPI_CurveInfo_Create()
+{
+    return HAPI_CurveInfo();
+}
+
+FAKE_HAPI_DECL_RETURN(void) HAPI_CurveInfo_Init(HAPI_CurveInfo * in)
+{
+    if (in)
+        *in = HAPI_CurveInfo();
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_DeleteAttribute(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const char * name, const HAPI_AttributeInfo * attr_info)
+{
+    return fakeHAPILUnimplemented("HAPI_DeleteAttribute");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_DeleteGroup(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, HAPI_GroupType group_type, const char * group_name)
+{
+    return fakeHAPILUnimplemented("HAPI_DeleteGroup");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_DirtyPDGNode(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_Bool clean_results)
+{
+    return fakeHAPILUnimplemented("HAPI_DirtyPDGNode");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_DisconnectNodeInput(const HAPI_Session * session, HAPI_NodeId node_id, int input_index)
+{
+    return fakeHAPILUnimplemented("HAPI_DisconnectNodeInput");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_DisconnectNodeOutputsAt(const HAPI_Session * session, HAPI_NodeId node_id, int output_index)
+{
+    return fakeHAPILUnimplemented("HAPI_DisconnectNodeOutputsAt");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_ExtractImageToFile(const HAPI_Session * session, HAPI_NodeId material_node_id, const char * image_file_format_name, const char * image_planes, const char * destination_folder_path, const char * destination_file_name, int * destination_file_path)
+{
+    return fakeHAPILUnimplemented("HAPI_ExtractImageToFile");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_ExtractImageToMemory(const HAPI_Session * session, HAPI_NodeId material_node_id, const char * image_file_format_name, const char * image_planes, int * buffer_size)
+{
+    return fakeHAPILUnimplemented("HAPI_ExtractImageToMemory");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_GeoInfo) HAPI_GeoInfo_Create()
+{
+    return HAPI_GeoInfo();
+}
+
+FAKE_HAPI_DECL_RETURN(int) HAPI_GeoInfo_GetGroupCountByType(HAPI_GeoInfo * in, HAPI_GroupType type)
+{
+    return 0;
+}
+
+FAKE_HAPI_DECL_RETURN(void) HAPI_GeoInfo_Init(HAPI_GeoInfo * in)
+{
+    if (in)
+        *in = HAPI_GeoInfo();
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_GetActiveCacheCount(const HAPI_Session * session, int * active_cache_count)
+{
+    return fakeHAPILUnimplemented("HAPI_GetActiveCacheCount");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_GetActiveCacheNames(const HAPI_Session * session, HAPI_StringHandle * cache_names_array, int active_cache_count)
+{
+    return fakeHAPILUnimplemented("HAPI_GetActiveCacheNames");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_GetAssetDefinitionParmCounts(const HAPI_Session * session, HAPI_AssetLibraryId library_id, const char * asset_name, int * parm_count, int * int_value_count, int * float_value_count, int * string_value_count, int * choice_value_count)
+{
+    return fakeHAPILUnimplemented("HAPI_GetAssetDefinitionParmCounts");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_GetAssetDefinitionParmInfos(const HAPI_Session * session, HAPI_AssetLibraryId library_id, const char * asset_name, HAPI_ParmInfo * parm_infos_array, int start, int length)
+{
+    return fakeHAPILUnimplemented("HAPI_GetAssetDefinitionParmInfos");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_GetAssetDefinitionParmValues(const HAPI_Session * session, HAPI_AssetLibraryId library_id, const char * asset_name, int * int_values_array, int int_start, int int_length, float * float_values_array, int float_start, int float_length, HAPI_Bool string_evaluate, HAPI_StringHandle * string_values_array, int string_start, int string_length, HAPI_ParmChoiceInfo * choice_values_array, int choice_start, int choice_length)
+{
+    return fakeHAPILUnimplemented("HAPI_GetAssetDefinitionParmValues");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_GetAssetLibraryFilePath(const HAPI_Session * session, HAPI_AssetLibraryId asset_library_id, HAPI_StringHandle * file_path_sh)
+{
+    return fakeHAPILUnimplemented("HAPI_GetAssetLibraryFilePath");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_GetAssetLibraryIds(const HAPI_Session * session, HAPI_AssetLibraryId * asset_library_ids_array, int start, int length)
+{
+    return fakeHAPILUnimplemented("HAPI_GetAssetLibraryIds");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_GetAttributeDictionaryArrayData(const HAPI_Session* session, HAPI_NodeId node_id, HAPI_PartId part_id, const char* name, HAPI_AttributeInfo* attr_info, HAPI_StringHandle* data_fixed_array, int data_fixed_length, int* sizes_fixed_array, int start, int sizes_fixed_length)
+{
+    return fakeHAPILUnimplemented("HAPI_GetAttributeDictionaryArrayData");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_GetAttributeDictionaryArrayDataAsync(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const char * attr_name, HAPI_AttributeInfo * attr_info, HAPI_StringHandle * data_fixed_array, int data_fixed_length, int * sizes_fixed_array, int start, int sizes_fixed_length, int * job_id)
+{
+    return fakeHAPILUnimplemented("HAPI_GetAttributeDictionaryArrayDataAsync");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_GetAttributeDictionaryData(const HAPI_Session* session, HAPI_NodeId node_id, HAPI_PartId part_id, const char* name, HAPI_AttributeInfo* attr_info, HAPI_StringHandle* data_array, int start, int length)
+{
+    return fakeHAPILUnimplemented("HAPI_GetAttributeDictionaryData");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_GetAttributeDictionaryDataAsync(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const char * name, HAPI_AttributeInfo * attr_info, HAPI_StringHandle * data_array, int start, int length, int * job_id)
+{
+    return fakeHAPILUnimplemented("HAPI_GetAttributeDictionaryDataAsync");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_GetAttributeFloat64ArrayData(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const char * name, HAPI_AttributeInfo * attr_info, double * data_fixed_array, int data_fixed_length, int * sizes_fixed_array, int start, int sizes_fixed_length)
+{
+    return fakeHAPILUnimplemented("HAPI_GetAttributeFloat64ArrayData");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_GetAttributeFloat64ArrayDataAsync(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const char * attr_name, HAPI_AttributeInfo * attr_info, double * data_fixed_array, int data_fixed_length, int * sizes_fixed_array, int start, int sizes_fixed_length, int * job_id)
+{
+    return fakeHAPILUnimplemented("HAPI_GetAttributeFloat64ArrayDataAsync");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_GetAttributeFloat64Data(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const char * name, HAPI_AttributeInfo * attr_info, int stride, double * data_array, int start, int length)
+{
+    return fakeHAPILUnimplemented("HAPI_GetAttributeFloat64Data");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_GetAttributeFloat64DataAsync(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const char * name, HAPI_AttributeInfo * attr_info, int stride, double * data_array, int start, int length, int * job_id)
+{
+    return fakeHAPILUnimplemented("HAPI_GetAttributeFloat64DataAsync");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_GetAttributeFloatArrayData(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const char * name, HAPI_AttributeInfo * attr_info, float * data_fixed_array, int data_fixed_length, int * sizes_fixed_array, int start, int sizes_fixed_length)
+{
+    return fakeHAPILUnimplemented("HAPI_GetAttributeFloatArrayData");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_GetAttributeFloatArrayDataAsync(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const char * attr_name, HAPI_AttributeInfo * attr_info, float * data_fixed_array, int data_fixed_length, int * sizes_fixed_array, int start, int sizes_fixed_length, int * job_id)
+{
+    return fakeHAPILUnimplemented("HAPI_GetAttributeFloatArrayDataAsync");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_GetAttributeFloatDataAsync(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const char * name, HAPI_AttributeInfo * attr_info, int stride, float * data_array, int start, int length, int * job_id)
+{
+    return fakeHAPILUnimplemented("HAPI_GetAttributeFloatDataAsync");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_GetAttributeInt16ArrayData(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const char * name, HAPI_AttributeInfo * attr_info, HAPI_Int16 * data_fixed_array, int data_fixed_length, int * sizes_fixed_array, int start, int sizes_fixed_length)
+{
+    return fakeHAPILUnimplemented("HAPI_GetAttributeInt16ArrayData");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_GetAttributeInt16ArrayDataAsync(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const char * attr_name, HAPI_AttributeInfo * attr_info, HAPI_Int16 * data_fixed_array, int data_fixed_length, int * sizes_fixed_array, int start, int sizes_fixed_length, int * job_id)
+{
+    return fakeHAPILUnimplemented("HAPI_GetAttributeInt16ArrayDataAsync");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_GetAttributeInt16Data(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const char * name, HAPI_AttributeInfo * attr_info, int stride, HAPI_Int16 * data_array, int start, int length)
+{
+    return fakeHAPILUnimplemented("HAPI_GetAttributeInt16Data");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_GetAttributeInt16DataAsync(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const char * name, HAPI_AttributeInfo * attr_info, int stride, HAPI_Int16 * data_array, int start, int length, int * job_id)
+{
+    return fakeHAPILUnimplemented("HAPI_GetAttributeInt16DataAsync");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_GetAttributeInt64ArrayData(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const char * name, HAPI_AttributeInfo * attr_info, HAPI_Int64 * data_fixed_array, int data_fixed_length, int * sizes_fixed_array, int start, int sizes_fixed_length)
+{
+    return fakeHAPILUnimplemented("HAPI_GetAttributeInt64ArrayData");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_GetAttributeInt64ArrayDataAsync(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const char * attr_name, HAPI_AttributeInfo * attr_info, HAPI_Int64 * data_fixed_array, int data_fixed_length, int * sizes_fixed_array, int start, int sizes_fixed_length, int * job_id)
+{
+    return fakeHAPILUnimplemented("HAPI_GetAttributeInt64ArrayDataAsync");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_GetAttributeInt64Data(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const char * name, HAPI_AttributeInfo * attr_info, int stride, HAPI_Int64 * data_array, int start, int length)
+{
+    return fakeHAPILUnimplemented("HAPI_GetAttributeInt64Data");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_GetAttributeInt64DataAsync(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const char * name, HAPI_AttributeInfo * attr_info, int stride, HAPI_Int64 * data_array, int start, int length, int * job_id)
+{
+    return fakeHAPILUnimplemented("HAPI_GetAttributeInt64DataAsync");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_GetAttributeInt8ArrayData(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const char * name, HAPI_AttributeInfo * attr_info, HAPI_Int8 * data_fixed_array, int data_fixed_length, int * sizes_fixed_array, int start, int sizes_fixed_length)
+{
+    return fakeHAPILUnimplemented("HAPI_GetAttributeInt8ArrayData");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_GetAttributeInt8ArrayDataAsync(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const char * attr_name, HAPI_AttributeInfo * attr_info, HAPI_Int8 * data_fixed_array, int data_fixed_length, int * sizes_fixed_array, int start, int sizes_fixed_length, int * job_id)
+{
+    return fakeHAPILUnimplemented("HAPI_GetAttributeInt8ArrayDataAsync");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_GetAttributeInt8Data(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const char * name, HAPI_AttributeInfo * attr_info, int stride, HAPI_Int8 * data_array, int start, int length)
+{
+    return fakeHAPILUnimplemented("HAPI_GetAttributeInt8Data");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_GetAttributeInt8DataAsync(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const char * name, HAPI_AttributeInfo * attr_info, int stride, HAPI_Int8 * data_array, int start, int length, int * job_id)
+{
+    return fakeHAPILUnimplemented("HAPI_GetAttributeInt8DataAsync");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_GetAttributeIntArrayData(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const char * name, HAPI_AttributeInfo * attr_info, int * data_fixed_array, int data_fixed_length, int * sizes_fixed_array, int start, int sizes_fixed_length)
+{
+    return fakeHAPILUnimplemented("HAPI_GetAttributeIntArrayData");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_GetAttributeIntArrayDataAsync(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const char * attr_name, HAPI_AttributeInfo * attr_info, int * data_fixed_array, int data_fixed_length, int * sizes_fixed_array, int start, int sizes_fixed_length, int * job_id)
+{
+    return fakeHAPILUnimplemented("HAPI_GetAttributeIntArrayDataAsync");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_GetAttributeIntDataAsync(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const char * name, HAPI_AttributeInfo * attr_info, int stride, int * data_array, int start, int length, int * job_id)
+{
+    return fakeHAPILUnimplemented("HAPI_GetAttributeIntDataAsync");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_GetAttributeStringArrayData(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const char * name, HAPI_AttributeInfo * attr_info, HAPI_StringHandle * data_fixed_array, int data_fixed_length, int * sizes_fixed_array, int start, int sizes_fixed_length)
+{
+    return fakeHAPILUnimplemented("HAPI_GetAttributeStringArrayData");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_GetAttributeStringArrayDataAsync(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const char * attr_name, HAPI_AttributeInfo * attr_info, HAPI_StringHandle * data_fixed_array, int data_fixed_length, int * sizes_fixed_array, int start, int sizes_fixed_length, int * job_id)
+{
+    return fakeHAPILUnimplemented("HAPI_GetAttributeStringArrayDataAsync");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_GetAttributeStringDataAsync(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const char * name, HAPI_AttributeInfo * attr_info, HAPI_StringHandle * data_array, int start, int length, int * job_id)
+{
+    return fakeHAPILUnimplemented("HAPI_GetAttributeStringDataAsync");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_GetAttributeUInt8ArrayData(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const char * name, HAPI_AttributeInfo * attr_info, HAPI_UInt8 * data_fixed_array, int data_fixed_length, int * sizes_fixed_array, int start, int sizes_fixed_length)
+{
+    return fakeHAPILUnimplemented("HAPI_GetAttributeUInt8ArrayData");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_GetAttributeUInt8ArrayDataAsync(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const char * attr_name, HAPI_AttributeInfo * attr_info, HAPI_UInt8 * data_fixed_array, int data_fixed_length, int * sizes_fixed_array, int start, int sizes_fixed_length, int * job_id)
+{
+    return fakeHAPILUnimplemented("HAPI_GetAttributeUInt8ArrayDataAsync");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_GetAttributeUInt8Data(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const char * name, HAPI_AttributeInfo * attr_info, int stride, HAPI_UInt8 * data_array, int start, int length)
+{
+    return fakeHAPILUnimplemented("HAPI_GetAttributeUInt8Data");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_GetAttributeUInt8DataAsync(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const char * name, HAPI_AttributeInfo * attr_info, int stride, HAPI_UInt8 * data_array, int start, int length, int * job_id)
+{
+    return fakeHAPILUnimplemented("HAPI_GetAttributeUInt8DataAsync");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_GetBoxInfo(const HAPI_Session * session, HAPI_NodeId geo_node_id, HAPI_PartId part_id, HAPI_BoxInfo * box_info)
+{
+    return fakeHAPILUnimplemented("HAPI_GetBoxInfo");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_GetCacheProperty(const HAPI_Session * session, const char * cache_name, HAPI_CacheProperty cache_property, int * property_value)
+{
+    return fakeHAPILUnimplemented("HAPI_GetCacheProperty");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_GetComposedChildNodeList(const HAPI_Session * session, HAPI_NodeId parent_node_id, HAPI_NodeId * child_node_ids_array, int count)
+{
+    return fakeHAPILUnimplemented("HAPI_GetComposedChildNodeList");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_GetComposedNodeCookResult(const HAPI_Session * session, char * string_value, int length)
+{
+    return fakeHAPILUnimplemented("HAPI_GetComposedNodeCookResult");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_GetComposedObjectList(const HAPI_Session * session, HAPI_NodeId parent_node_id, HAPI_ObjectInfo * object_infos_array, int start, int length)
+{
+    return fakeHAPILUnimplemented("HAPI_GetComposedObjectList");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_GetComposedObjectTransforms(const HAPI_Session * session, HAPI_NodeId parent_node_id, HAPI_RSTOrder rst_order, HAPI_Transform * transform_array, int start, int length)
+{
+    return fakeHAPILUnimplemented("HAPI_GetComposedObjectTransforms");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_GetCompositorOptions(const HAPI_Session * session, HAPI_CompositorOptions * compositor_options)
+{
+    return fakeHAPILUnimplemented("HAPI_GetCompositorOptions");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_GetCookingCurrentCount(const HAPI_Session * session, int * count)
+{
+    return fakeHAPILUnimplemented("HAPI_GetCookingCurrentCount");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_GetCookingTotalCount(const HAPI_Session * session, int * count)
+{
+    return fakeHAPILUnimplemented("HAPI_GetCookingTotalCount");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_GetCurveCounts(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, int * counts_array, int start, int length)
+{
+    return fakeHAPILUnimplemented("HAPI_GetCurveCounts");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_GetCurveInfo(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, HAPI_CurveInfo * info)
+{
+    return fakeHAPILUnimplemented("HAPI_GetCurveInfo");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_GetCurveKnots(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, float * knots_array, int start, int length)
+{
+    return fakeHAPILUnimplemented("HAPI_GetCurveKnots");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_GetCurveOrders(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, int * orders_array, int start, int length)
+{
+    return fakeHAPILUnimplemented("HAPI_GetCurveOrders");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_GetEdgeCountOfEdgeGroup(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const char * group_name, int * edge_count)
+{
+    return fakeHAPILUnimplemented("HAPI_GetEdgeCountOfEdgeGroup");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_GetEnvInt(HAPI_EnvIntType int_type, int * value)
+{
+    return fakeHAPILUnimplemented("HAPI_GetEnvInt");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_GetFirstVolumeTile(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, HAPI_VolumeTileInfo * tile)
+{
+    return fakeHAPILUnimplemented("HAPI_GetFirstVolumeTile");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_GetGroupCountOnPackedInstancePart(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, int * pointGroupCount, int * primitiveGroupCount)
+{
+    return fakeHAPILUnimplemented("HAPI_GetGroupCountOnPackedInstancePart");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_GetGroupMembership(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, HAPI_GroupType group_type, const char * group_name, HAPI_Bool * membership_array_all_equal, int * membership_array, int start, int length)
+{
+    return fakeHAPILUnimplemented("HAPI_GetGroupMembership");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_GetGroupMembershipOnPackedInstancePart(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, HAPI_GroupType group_type, const char * group_name, HAPI_Bool * membership_array_all_equal, int * membership_array, int start, int length)
+{
+    return fakeHAPILUnimplemented("HAPI_GetGroupMembershipOnPackedInstancePart");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_GetGroupNames(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_GroupType group_type, HAPI_StringHandle * group_names_array, int group_count)
+{
+    return fakeHAPILUnimplemented("HAPI_GetGroupNames");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_GetGroupNamesOnPackedInstancePart(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, HAPI_GroupType group_type, HAPI_StringHandle * group_names_array, int group_count)
+{
+    return fakeHAPILUnimplemented("HAPI_GetGroupNamesOnPackedInstancePart");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_GetHIPFileNodeCount(const HAPI_Session * session, HAPI_HIPFileId id, int * count)
+{
+    return fakeHAPILUnimplemented("HAPI_GetHIPFileNodeCount");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_GetHIPFileNodeIds(const HAPI_Session * session, HAPI_HIPFileId id, HAPI_NodeId * node_ids, int length)
+{
+    return fakeHAPILUnimplemented("HAPI_GetHIPFileNodeIds");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_GetHandleBindingInfo(const HAPI_Session * session, HAPI_NodeId node_id, int handle_index, HAPI_HandleBindingInfo * handle_binding_infos_array, int start, int length)
+{
+    return fakeHAPILUnimplemented("HAPI_GetHandleBindingInfo");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_GetHandleInfo(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_HandleInfo * handle_infos_array, int start, int length)
+{
+    return fakeHAPILUnimplemented("HAPI_GetHandleInfo");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_GetHeightFieldData(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, float * values_array, int start, int length)
+{
+    return fakeHAPILUnimplemented("HAPI_GetHeightFieldData");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_GetImageFilePath(const HAPI_Session * session, HAPI_NodeId material_node_id, const char * image_file_format_name, const char * image_planes, const char * destination_folder_path, const char * destination_file_name, HAPI_ParmId texture_parm_id, int * destination_file_path)
+{
+    return fakeHAPILUnimplemented("HAPI_GetImageFilePath");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_GetImageInfo(const HAPI_Session * session, HAPI_NodeId material_node_id, HAPI_ImageInfo * image_info)
+{
+    return fakeHAPILUnimplemented("HAPI_GetImageInfo");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_GetImageMemoryBuffer(const HAPI_Session * session, HAPI_NodeId material_node_id, char * buffer, int length)
+{
+    return fakeHAPILUnimplemented("HAPI_GetImageMemoryBuffer");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_GetImagePlaneCount(const HAPI_Session * session, HAPI_NodeId material_node_id, int * image_plane_count)
+{
+    return fakeHAPILUnimplemented("HAPI_GetImagePlaneCount");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_GetImagePlanes(const HAPI_Session * session, HAPI_NodeId material_node_id, HAPI_StringHandle * image_planes_array, int image_plane_count)
+{
+    return fakeHAPILUnimplemented("HAPI_GetImagePlanes");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_GetInputCurveInfo(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, HAPI_InputCurveInfo * info)
+{
+    return fakeHAPILUnimplemented("HAPI_GetInputCurveInfo");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_GetInstanceTransformsOnPart(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, HAPI_RSTOrder rst_order, HAPI_Transform * transforms_array, int start, int length)
+{
+    return fakeHAPILUnimplemented("HAPI_GetInstanceTransformsOnPart");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_GetInstancedObjectIds(const HAPI_Session * session, HAPI_NodeId object_node_id, HAPI_NodeId * instanced_node_id_array, int start, int length)
+{
+    return fakeHAPILUnimplemented("HAPI_GetInstancedObjectIds");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_GetInstancedPartIds(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, HAPI_PartId * instanced_parts_array, int start, int length)
+{
+    return fakeHAPILUnimplemented("HAPI_GetInstancedPartIds");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_GetInstancerPartTransforms(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, HAPI_RSTOrder rst_order, HAPI_Transform * transforms_array, int start, int length)
+{
+    return fakeHAPILUnimplemented("HAPI_GetInstancerPartTransforms");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_GetJobStatus(const HAPI_Session * session, int job_id, HAPI_JobStatus * job_status)
+{
+    return fakeHAPILUnimplemented("HAPI_GetJobStatus");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_GetLoadedAssetLibraryCount(const HAPI_Session * session, int * count)
+{
+    return fakeHAPILUnimplemented("HAPI_GetLoadedAssetLibraryCount");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_GetManagerNodeId(const HAPI_Session * session, HAPI_NodeType node_type, HAPI_NodeId * node_id)
+{
+    return fakeHAPILUnimplemented("HAPI_GetManagerNodeId");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_GetMaterialInfo(const HAPI_Session * session, HAPI_NodeId material_node_id, HAPI_MaterialInfo * material_info)
+{
+    return fakeHAPILUnimplemented("HAPI_GetMaterialInfo");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_GetMessageNodeCount(const HAPI_Session * session, HAPI_NodeId node_id, int * count)
+{
+    return fakeHAPILUnimplemented("HAPI_GetMessageNodeCount");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_GetMessageNodeIds(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_NodeId * message_node_ids_array, int count)
+{
+    return fakeHAPILUnimplemented("HAPI_GetMessageNodeIds");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_GetNextVolumeTile(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, HAPI_VolumeTileInfo * tile)
+{
+    return fakeHAPILUnimplemented("HAPI_GetNextVolumeTile");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_GetNodeCookResult(const HAPI_Session * session, char * string_value, int length)
+{
+    return fakeHAPILUnimplemented("HAPI_GetNodeCookResult");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_GetNodeCookResultLength(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_StatusVerbosity verbosity, int * buffer_length)
+{
+    return fakeHAPILUnimplemented("HAPI_GetNodeCookResultLength");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_GetNodeInputName(const HAPI_Session * session, HAPI_NodeId node_id, int input_idx, HAPI_StringHandle * name)
+{
+    return fakeHAPILUnimplemented("HAPI_GetNodeInputName");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_GetNodeOutputName(const HAPI_Session * session, HAPI_NodeId node_id, int output_idx, HAPI_StringHandle * name)
+{
+    return fakeHAPILUnimplemented("HAPI_GetNodeOutputName");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_GetNodePath(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_NodeId relative_to_node_id, HAPI_StringHandle * path)
+{
+    return fakeHAPILUnimplemented("HAPI_GetNodePath");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_GetNumWorkItems(const HAPI_Session * session, HAPI_NodeId node_id, int * num)
+{
+    return fakeHAPILUnimplemented("HAPI_GetNumWorkItems");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_GetNumWorkitems(const HAPI_Session * session, HAPI_NodeId node_id, int * num)
+{
+    return fakeHAPILUnimplemented("HAPI_GetNumWorkitems");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_GetObjectInfo(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_ObjectInfo * object_info)
+{
+    return fakeHAPILUnimplemented("HAPI_GetObjectInfo");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_GetObjectTransform(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_NodeId relative_to_node_id, HAPI_RSTOrder rst_order, HAPI_Transform * transform)
+{
+    return fakeHAPILUnimplemented("HAPI_GetObjectTransform");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_GetOutputGeoCount(const HAPI_Session* session, HAPI_NodeId node_id, int* count)
+{
+    return fakeHAPILUnimplemented("HAPI_GetOutputGeoCount");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_GetOutputGeoInfos(const HAPI_Session* session, HAPI_NodeId node_id, HAPI_GeoInfo* geo_infos_array, int count)
+{
+    return fakeHAPILUnimplemented("HAPI_GetOutputGeoInfos");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_GetOutputNodeId(const HAPI_Session * session, HAPI_NodeId node_id, int output, HAPI_NodeId * output_node_id)
+{
+    return fakeHAPILUnimplemented("HAPI_GetOutputNodeId");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_GetPDGEvents(const HAPI_Session * session, HAPI_PDG_GraphContextId graph_context_id, HAPI_PDG_EventInfo * event_array, int length, int * event_count, int * remaining_events)
+{
+    return fakeHAPILUnimplemented("HAPI_GetPDGEvents");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_GetPDGGraphContextId(const HAPI_Session * session, HAPI_NodeId top_node_id, HAPI_PDG_GraphContextId * context_id)
+{
+    return fakeHAPILUnimplemented("HAPI_GetPDGGraphContextId");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_GetPDGGraphContexts(const HAPI_Session * session, HAPI_StringHandle * context_names_array, HAPI_PDG_GraphContextId * context_id_array, int start, int length)
+{
+    return fakeHAPILUnimplemented("HAPI_GetPDGGraphContexts");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_GetPDGGraphContextsCount(const HAPI_Session* session, int* num_contexts)
+{
+    return fakeHAPILUnimplemented("HAPI_GetPDGGraphContextsCount");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_GetPDGState(const HAPI_Session * session, HAPI_PDG_GraphContextId graph_context_id, int * pdg_state)
+{
+    return fakeHAPILUnimplemented("HAPI_GetPDGState");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_GetParmChoiceLists(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_ParmChoiceInfo * parm_choices_array, int start, int length)
+{
+    return fakeHAPILUnimplemented("HAPI_GetParmChoiceLists");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_GetParmExpression(const HAPI_Session * session, HAPI_NodeId node_id, const char * parm_name, int index, HAPI_StringHandle * value)
+{
+    return fakeHAPILUnimplemented("HAPI_GetParmExpression");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_GetParmFile(const HAPI_Session * session, HAPI_NodeId node_id, const char * parm_name, const char * destination_directory, const char * destination_file_name)
+{
+    return fakeHAPILUnimplemented("HAPI_GetParmFile");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_GetParmFloatValue(const HAPI_Session * session, HAPI_NodeId node_id, const char * parm_name, int index, float * value)
+{
+    return fakeHAPILUnimplemented("HAPI_GetParmFloatValue");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_GetParmInfo(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_ParmId parm_id, HAPI_ParmInfo * parm_info)
+{
+    return fakeHAPILUnimplemented("HAPI_GetParmInfo");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_GetParmIntValue(const HAPI_Session * session, HAPI_NodeId node_id, const char * parm_name, int index, int * value)
+{
+    return fakeHAPILUnimplemented("HAPI_GetParmIntValue");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_GetParmIntValues(const HAPI_Session * session, HAPI_NodeId node_id, int * values_array, int start, int length)
+{
+    return fakeHAPILUnimplemented("HAPI_GetParmIntValues");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_GetParmNodeValue(const HAPI_Session * session, HAPI_NodeId node_id, const char * parm_name, HAPI_NodeId * value)
+{
+    return fakeHAPILUnimplemented("HAPI_GetParmNodeValue");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_GetParmStringValue(const HAPI_Session * session, HAPI_NodeId node_id, const char * parm_name, int index, HAPI_Bool evaluate, HAPI_StringHandle * value)
+{
+    return fakeHAPILUnimplemented("HAPI_GetParmStringValue");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_GetParmStringValues(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_Bool evaluate, HAPI_StringHandle * values_array, int start, int length)
+{
+    return fakeHAPILUnimplemented("HAPI_GetParmStringValues");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_GetParmTagName(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_ParmId parm_id, int tag_index, HAPI_StringHandle * tag_name)
+{
+    return fakeHAPILUnimplemented("HAPI_GetParmTagName");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_GetParmTagValue(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_ParmId parm_id, const char * tag_name, HAPI_StringHandle * tag_value)
+{
+    return fakeHAPILUnimplemented("HAPI_GetParmTagValue");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_GetParmWithTag(const HAPI_Session * session, HAPI_NodeId node_id, const char * tag_name, HAPI_ParmId * parm_id)
+{
+    return fakeHAPILUnimplemented("HAPI_GetParmWithTag");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_GetPresetCount(const HAPI_Session * session, const char * buffer, int buffer_length, int * count)
+{
+    return fakeHAPILUnimplemented("HAPI_GetPresetCount");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_GetPresetNames(const HAPI_Session * session, const char * buffer, int buffer_length, HAPI_StringHandle * preset_names_array, int count)
+{
+    return fakeHAPILUnimplemented("HAPI_GetPresetNames");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_GetServerEnvInt(const HAPI_Session * session, const char * variable_name, int * value)
+{
+    return fakeHAPILUnimplemented("HAPI_GetServerEnvInt");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_GetServerEnvString(const HAPI_Session * session, const char * variable_name, HAPI_StringHandle * value)
+{
+    return fakeHAPILUnimplemented("HAPI_GetServerEnvString");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_GetServerEnvVarCount(const HAPI_Session * session, int * env_count)
+{
+    return fakeHAPILUnimplemented("HAPI_GetServerEnvVarCount");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_GetServerEnvVarList(const HAPI_Session * session, HAPI_StringHandle * values_array, int start, int length)
+{
+    return fakeHAPILUnimplemented("HAPI_GetServerEnvVarList");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_GetSessionEnvInt(const HAPI_Session * session, HAPI_SessionEnvIntType int_type, int * value)
+{
+    return fakeHAPILUnimplemented("HAPI_GetSessionEnvInt");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_GetSessionSyncInfo(const HAPI_Session * session, HAPI_SessionSyncInfo * session_sync_info)
+{
+    return fakeHAPILUnimplemented("HAPI_GetSessionSyncInfo");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_GetSphereInfo(const HAPI_Session * session, HAPI_NodeId geo_node_id, HAPI_PartId part_id, HAPI_SphereInfo * sphere_info)
+{
+    return fakeHAPILUnimplemented("HAPI_GetSphereInfo");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_GetSupportedImageFileFormatCount(const HAPI_Session * session, int * file_format_count)
+{
+    return fakeHAPILUnimplemented("HAPI_GetSupportedImageFileFormatCount");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_GetSupportedImageFileFormats(const HAPI_Session * session, HAPI_ImageFileFormat * formats_array, int file_format_count)
+{
+    return fakeHAPILUnimplemented("HAPI_GetSupportedImageFileFormats");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_GetTime(const HAPI_Session * session, float * time)
+{
+    return fakeHAPILUnimplemented("HAPI_GetTime");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_GetTimelineOptions(const HAPI_Session * session, HAPI_TimelineOptions * timeline_options)
+{
+    return fakeHAPILUnimplemented("HAPI_GetTimelineOptions");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_GetTotalCookCount(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_NodeTypeBits node_type_filter, HAPI_NodeFlagsBits node_flags_filter, HAPI_Bool recursive, int * count)
+{
+    return fakeHAPILUnimplemented("HAPI_GetTotalCookCount");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_GetUseHoudiniTime(const HAPI_Session * session, HAPI_Bool * enabled)
+{
+    return fakeHAPILUnimplemented("HAPI_GetUseHoudiniTime");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_GetViewport(const HAPI_Session * session, HAPI_Viewport * viewport)
+{
+    return fakeHAPILUnimplemented("HAPI_GetViewport");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_GetVolumeBounds(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, float * x_min, float * y_min, float * z_min, float * x_max, float * y_max, float * z_max, float * x_center, float * y_center, float * z_center)
+{
+    return fakeHAPILUnimplemented("HAPI_GetVolumeBounds");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_GetVolumeInfo(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, HAPI_VolumeInfo * volume_info)
+{
+    return fakeHAPILUnimplemented("HAPI_GetVolumeInfo");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_GetVolumeTileFloatData(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, float fill_value, const HAPI_VolumeTileInfo * tile, float * values_array, int length)
+{
+    return fakeHAPILUnimplemented("HAPI_GetVolumeTileFloatData");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_GetVolumeTileIntData(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, int fill_value, const HAPI_VolumeTileInfo * tile, int * values_array, int length)
+{
+    return fakeHAPILUnimplemented("HAPI_GetVolumeTileIntData");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_GetVolumeVisualInfo(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, HAPI_VolumeVisualInfo * visual_info)
+{
+    return fakeHAPILUnimplemented("HAPI_GetVolumeVisualInfo");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_GetVolumeVoxelFloatData(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, int x_index, int y_index, int z_index, float * values_array, int value_count)
+{
+    return fakeHAPILUnimplemented("HAPI_GetVolumeVoxelFloatData");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_GetVolumeVoxelIntData(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, int x_index, int y_index, int z_index, int * values_array, int value_count)
+{
+    return fakeHAPILUnimplemented("HAPI_GetVolumeVoxelIntData");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_GetWorkItemAttributeSize(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PDG_WorkItemId work_item_id, const char * attribute_name, int * length)
+{
+    return fakeHAPILUnimplemented("HAPI_GetWorkItemAttributeSize");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_GetWorkItemFloatAttribute(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PDG_WorkItemId work_item_id, const char * attribute_name, float * data_array, int length)
+{
+    return fakeHAPILUnimplemented("HAPI_GetWorkItemFloatAttribute");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_GetWorkItemInfo(const HAPI_Session * session, HAPI_PDG_GraphContextId graph_context_id, HAPI_PDG_WorkItemId work_item_id, HAPI_PDG_WorkItemInfo * work_item_info)
+{
+    return fakeHAPILUnimplemented("HAPI_GetWorkItemInfo");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_GetWorkItemIntAttribute(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PDG_WorkItemId work_item_id, const char * attribute_name, int * data_array, int length)
+{
+    return fakeHAPILUnimplemented("HAPI_GetWorkItemIntAttribute");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_GetWorkItemOutputFiles(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PDG_WorkItemId work_item_id, HAPI_PDG_WorkItemOutputFile * resultinfo_array, int resultinfo_count)
+{
+    return fakeHAPILUnimplemented("HAPI_GetWorkItemOutputFiles");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_GetWorkItemStringAttribute(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PDG_WorkItemId work_item_id, const char * attribute_name, HAPI_StringHandle * data_array, int length)
+{
+    return fakeHAPILUnimplemented("HAPI_GetWorkItemStringAttribute");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_GetWorkItems(const HAPI_Session * session, HAPI_NodeId node_id, int * work_item_ids_array, int length)
+{
+    return fakeHAPILUnimplemented("HAPI_GetWorkItems");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_GetWorkitemDataLength(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PDG_WorkItemId workitem_id, const char * data_name, int * length)
+{
+    return fakeHAPILUnimplemented("HAPI_GetWorkitemDataLength");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_GetWorkitemFloatData(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PDG_WorkItemId workitem_id, const char * data_name, float * data_array, int length)
+{
+    return fakeHAPILUnimplemented("HAPI_GetWorkitemFloatData");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_GetWorkitemInfo(const HAPI_Session * session, HAPI_PDG_GraphContextId graph_context_id, HAPI_PDG_WorkItemId workitem_id, HAPI_PDG_WorkItemInfo * workitem_info)
+{
+    return fakeHAPILUnimplemented("HAPI_GetWorkitemInfo");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_GetWorkitemIntData(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PDG_WorkItemId workitem_id, const char * data_name, int * data_array, int length)
+{
+    return fakeHAPILUnimplemented("HAPI_GetWorkitemIntData");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_GetWorkitemResultInfo(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PDG_WorkItemId workitem_id, HAPI_PDG_WorkItemOutputFile * resultinfo_array, int resultinfo_count)
+{
+    return fakeHAPILUnimplemented("HAPI_GetWorkitemResultInfo");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_GetWorkitemStringData(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PDG_WorkItemId workitem_id, const char * data_name, HAPI_StringHandle * data_array, int length)
+{
+    return fakeHAPILUnimplemented("HAPI_GetWorkitemStringData");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_GetWorkitems(const HAPI_Session * session, HAPI_NodeId node_id, int * workitem_ids_array, int length)
+{
+    return fakeHAPILUnimplemented("HAPI_GetWorkitems");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_HandleBindingInfo) HAPI_HandleBindingInfo_Create()
+{
+    return HAPI_HandleBindingInfo();
+}
+
+FAKE_HAPI_DECL_RETURN(void) HAPI_HandleBindingInfo_Init(HAPI_HandleBindingInfo * in)
+{
+    if (in)
+        *in = HAPI_HandleBindingInfo();
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_HandleInfo) HAPI_HandleInfo_Create()
+{
+    return HAPI_HandleInfo();
+}
+
+FAKE_HAPI_DECL_RETURN(void) HAPI_HandleInfo_Init(HAPI_HandleInfo * in)
+{
+    if (in)
+        *in = HAPI_HandleInfo();
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_ImageFileFormat) HAPI_ImageFileFormat_Create()
+{
+    return HAPI_ImageFileFormat();
+}
+
+FAKE_HAPI_DECL_RETURN(void) HAPI_ImageFileFormat_Init(HAPI_ImageFileFormat *in)
+{
+    if (in)
+        *in = HAPI_ImageFileFormat();
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_ImageInfo) HAPI_ImageInfo_Create()
+{
+    return HAPI_ImageInfo();
+}
+
+FAKE_HAPI_DECL_RETURN(void) HAPI_ImageInfo_Init(HAPI_ImageInfo * in)
+{
+    if (in)
+        *in = HAPI_ImageInfo();
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_InputCurveInfo) HAPI_InputCurveInfo_Create()
+{
+    return HAPI_InputCurveInfo();
+}
+
+FAKE_HAPI_DECL_RETURN(void) HAPI_InputCurveInfo_Init(HAPI_InputCurveInfo * in)
+{
+    if (in)
+        *in = HAPI_InputCurveInfo();
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_InsertMultiparmInstance(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_ParmId parm_id, int instance_position)
+{
+    return fakeHAPILUnimplemented("HAPI_InsertMultiparmInstance");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_Interrupt(const HAPI_Session * session)
+{
+    return fakeHAPILUnimplemented("HAPI_Interrupt");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Keyframe) HAPI_Keyframe_Create()
+{
+    return HAPI_Keyframe();
+}
+
+FAKE_HAPI_DECL_RETURN(void) HAPI_Keyframe_Init(HAPI_Keyframe * in)
+{
+    if (in)
+        *in = HAPI_Keyframe();
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_LoadAssetLibraryFromMemory(const HAPI_Session * session, const char * library_buffer, int library_buffer_length, HAPI_Bool allow_overwrite, HAPI_AssetLibraryId * library_id)
+{
+    return fakeHAPILUnimplemented("HAPI_LoadAssetLibraryFromMemory");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_LoadGeoFromFile(const HAPI_Session * session, HAPI_NodeId node_id, const char * file_name)
+{
+    return fakeHAPILUnimplemented("HAPI_LoadGeoFromFile");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_LoadHIPFile(const HAPI_Session * session, const char * file_name, HAPI_Bool cook_on_load)
+{
+    return fakeHAPILUnimplemented("HAPI_LoadHIPFile");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_LoadNodeFromFile(const HAPI_Session * session, const char * file_name, HAPI_NodeId parent_node_id, const char * node_label, HAPI_Bool cook_on_load, HAPI_NodeId * new_node_id)
+{
+    return fakeHAPILUnimplemented("HAPI_LoadNodeFromFile");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_MaterialInfo) HAPI_MaterialInfo_Create()
+{
+    return HAPI_MaterialInfo();
+}
+
+FAKE_HAPI_DECL_RETURN(void) HAPI_MaterialInfo_Init(HAPI_MaterialInfo * in)
+{
+    if (in)
+        *in = HAPI_MaterialInfo();
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_MergeHIPFile(const HAPI_Session * session, const char * file_name, HAPI_Bool cook_on_load, HAPI_HIPFileId * file_id)
+{
+    return fakeHAPILUnimplemented("HAPI_MergeHIPFile");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_NodeInfo) HAPI_NodeInfo_Create()
+{
+    return HAPI_NodeInfo();
+}
+
+FAKE_HAPI_DECL_RETURN(void) HAPI_NodeInfo_Init(HAPI_NodeInfo * in)
+{
+    if (in)
+        *in = HAPI_NodeInfo();
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_ObjectInfo) HAPI_ObjectInfo_Create()
+{
+    return HAPI_ObjectInfo();
+}
+
+FAKE_HAPI_DECL_RETURN(void) HAPI_ObjectInfo_Init(HAPI_ObjectInfo * in)
+{
+    if (in)
+        *in = HAPI_ObjectInfo();
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_ParmChoiceInfo) HAPI_ParmChoiceInfo_Create()
+{
+    return HAPI_ParmChoiceInfo();
+}
+
+FAKE_HAPI_DECL_RETURN(void) HAPI_ParmChoiceInfo_Init(HAPI_ParmChoiceInfo * in)
+{
+    if (in)
+        *in = HAPI_ParmChoiceInfo();
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_ParmHasExpression(const HAPI_Session * session, HAPI_NodeId node_id, const char * parm_name, int index, HAPI_Bool * has_expression)
+{
+    return fakeHAPILUnimplemented("HAPI_ParmHasExpression");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_ParmHasTag(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_ParmId parm_id, const char * tag_name, HAPI_Bool * has_tag)
+{
+    return fakeHAPILUnimplemented("HAPI_ParmHasTag");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_ParmInfo) HAPI_ParmInfo_Create()
+{
+    return HAPI_ParmInfo();
+}
+
+FAKE_HAPI_DECL_RETURN(void) HAPI_ParmInfo_Init(HAPI_ParmInfo * in)
+{
+    if (in)
+        *in = HAPI_ParmInfo();
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Bool) HAPI_ParmInfo_IsNode(const HAPI_ParmInfo * in)
+{
+    return 0;
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Bool) HAPI_ParmInfo_IsNonValue(const HAPI_ParmInfo * in)
+{
+    return 0;
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Bool) HAPI_ParmInfo_IsPath(const HAPI_ParmInfo * in)
+{
+    return 0;
+}
+
+FAKE_HAPI_DECL_RETURN(int) HAPI_PartInfo_GetAttributeCountByOwner(HAPI_PartInfo * in, HAPI_AttributeOwner owner)
+{
+    return 0;
+}
+
+FAKE_HAPI_DECL_RETURN(int) HAPI_PartInfo_GetElementCountByAttributeOwner(HAPI_PartInfo * in, HAPI_AttributeOwner owner)
+{
+    return 0;
+}
+
+FAKE_HAPI_DECL_RETURN(int) HAPI_PartInfo_GetElementCountByGroupType(HAPI_PartInfo * in, HAPI_GroupType type)
+{
+    return 0;
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_PausePDGCook(const HAPI_Session * session, HAPI_PDG_GraphContextId graph_context_id)
+{
+    return fakeHAPILUnimplemented("HAPI_PausePDGCook");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_PythonThreadInterpreterLock(const HAPI_Session * session, HAPI_Bool locked)
+{
+    return fakeHAPILUnimplemented("HAPI_PythonThreadInterpreterLock");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_QueryNodeOutputConnectedCount(const HAPI_Session * session, HAPI_NodeId node_id, int output_idx, HAPI_Bool into_subnets, HAPI_Bool through_dots, int * connected_count)
+{
+    return fakeHAPILUnimplemented("HAPI_QueryNodeOutputConnectedCount");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_QueryNodeOutputConnectedNodes(const HAPI_Session * session, HAPI_NodeId node_id, int output_idx, HAPI_Bool into_subnets, HAPI_Bool through_dots, HAPI_NodeId * connected_node_ids_array, int start, int length)
+{
+    return fakeHAPILUnimplemented("HAPI_QueryNodeOutputConnectedNodes");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_RemoveCustomString(const HAPI_Session * session, const HAPI_StringHandle string_handle)
+{
+    return fakeHAPILUnimplemented("HAPI_RemoveCustomString");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_RemoveMultiparmInstance(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_ParmId parm_id, int instance_position)
+{
+    return fakeHAPILUnimplemented("HAPI_RemoveMultiparmInstance");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_RemoveParmExpression(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_ParmId parm_id, int index)
+{
+    return fakeHAPILUnimplemented("HAPI_RemoveParmExpression");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_RenameNode(const HAPI_Session * session, HAPI_NodeId node_id, const char * new_name)
+{
+    return fakeHAPILUnimplemented("HAPI_RenameNode");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_RenderCOPToImage(const HAPI_Session * session, HAPI_NodeId cop_node_id)
+{
+    return fakeHAPILUnimplemented("HAPI_RenderCOPToImage");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_RenderTextureToImage(const HAPI_Session * session, HAPI_NodeId material_node_id, HAPI_ParmId parm_id)
+{
+    return fakeHAPILUnimplemented("HAPI_RenderTextureToImage");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_ResetSimulation(const HAPI_Session * session, HAPI_NodeId node_id)
+{
+    return fakeHAPILUnimplemented("HAPI_ResetSimulation");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_RevertGeo(const HAPI_Session * session, HAPI_NodeId node_id)
+{
+    return fakeHAPILUnimplemented("HAPI_RevertGeo");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_RevertParmToDefault(const HAPI_Session * session, HAPI_NodeId node_id, const char * parm_name, int index)
+{
+    return fakeHAPILUnimplemented("HAPI_RevertParmToDefault");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_RevertParmToDefaults(const HAPI_Session * session, HAPI_NodeId node_id, const char * parm_name)
+{
+    return fakeHAPILUnimplemented("HAPI_RevertParmToDefaults");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_SaveNodeToFile(const HAPI_Session * session, HAPI_NodeId node_id, const char * file_name)
+{
+    return fakeHAPILUnimplemented("HAPI_SaveNodeToFile");
+}
+
+FAKE_HAPI_DECL_RETURN(void) HAPI_SessionInfo_Init(HAPI_SessionInfo * in)
+{
+    if (in)
+        *in = HAPI_SessionInfo();
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_SessionSyncInfo) HAPI_SessionSyncInfo_Create()
+{
+    return HAPI_SessionSyncInfo();
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_SetAnimCurve(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_ParmId parm_id, int parm_index, const HAPI_Keyframe * curve_keyframes_array, int keyframe_count)
+{
+    return fakeHAPILUnimplemented("HAPI_SetAnimCurve");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_SetAttributeDictionaryArrayData(const HAPI_Session* session, HAPI_NodeId node_id, HAPI_PartId part_id, const char* name, const HAPI_AttributeInfo* attr_info, const char** data_fixed_array, int data_fixed_length, const int* sizes_fixed_array, int start, int sizes_fixed_length)
+{
+    return fakeHAPILUnimplemented("HAPI_SetAttributeDictionaryArrayData");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_SetAttributeDictionaryArrayDataAsync(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const char * name, const HAPI_AttributeInfo * attr_info, const char ** data_fixed_array, int data_fixed_length, const int * sizes_fixed_array, int start, int sizes_fixed_length, int * job_id)
+{
+    return fakeHAPILUnimplemented("HAPI_SetAttributeDictionaryArrayDataAsync");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_SetAttributeDictionaryData(const HAPI_Session* session, HAPI_NodeId node_id, HAPI_PartId part_id, const char* name, const HAPI_AttributeInfo* attr_info, const char** data_array, int start, int length)
+{
+    return fakeHAPILUnimplemented("HAPI_SetAttributeDictionaryData");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_SetAttributeDictionaryDataAsync(const HAPI_Session* session, HAPI_NodeId node_id, HAPI_PartId part_id, const char* name, const HAPI_AttributeInfo* attr_info, const char** data_array, int start, int length, int * job_id)
+{
+    return fakeHAPILUnimplemented("HAPI_SetAttributeDictionaryDataAsync");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_SetAttributeFloat64ArrayData(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const char * name, const HAPI_AttributeInfo * attr_info, const double * data_fixed_array, int data_fixed_length, const int * sizes_fixed_array, int start, int sizes_fixed_length)
+{
+    return fakeHAPILUnimplemented("HAPI_SetAttributeFloat64ArrayData");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_SetAttributeFloat64ArrayDataAsync(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const char * name, const HAPI_AttributeInfo * attr_info, const double * data_fixed_array, int data_fixed_length, const int * sizes_fixed_array, int start, int sizes_fixed_length, int * job_id)
+{
+    return fakeHAPILUnimplemented("HAPI_SetAttributeFloat64ArrayDataAsync");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_SetAttributeFloat64Data(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const char * name, const HAPI_AttributeInfo * attr_info, const double * data_array, int start, int length)
+{
+    return fakeHAPILUnimplemented("HAPI_SetAttributeFloat64Data");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_SetAttributeFloat64DataAsync(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const char * name, const HAPI_AttributeInfo * attr_info, const double * data_array, int start, int length, int * job_id)
+{
+    return fakeHAPILUnimplemented("HAPI_SetAttributeFloat64DataAsync");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_SetAttributeFloat64UniqueData(const HAPI_Session* session, HAPI_NodeId node_id, HAPI_PartId part_id, const char* name, const HAPI_AttributeInfo* attr_info, const double* data_array, int data_length, int start_index, int num_indices)
+{
+    return fakeHAPILUnimplemented("HAPI_SetAttributeFloat64UniqueData");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_SetAttributeFloat64UniqueDataAsync(const HAPI_Session* session, HAPI_NodeId node_id, HAPI_PartId part_id, const char* name, const HAPI_AttributeInfo* attr_info, const double* data_array, int data_length, int start_index, int num_indices, int * job_id)
+{
+    return fakeHAPILUnimplemented("HAPI_SetAttributeFloat64UniqueDataAsync");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_SetAttributeFloatArrayData(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const char * name, const HAPI_AttributeInfo * attr_info, const float * data_fixed_array, int data_fixed_length, const int * sizes_fixed_array, int start, int sizes_fixed_length)
+{
+    return fakeHAPILUnimplemented("HAPI_SetAttributeFloatArrayData");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_SetAttributeFloatArrayDataAsync(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const char * name, const HAPI_AttributeInfo * attr_info, const float * data_fixed_array, int data_fixed_length, const int * sizes_fixed_array, int start, int sizes_fixed_length, int * job_id)
+{
+    return fakeHAPILUnimplemented("HAPI_SetAttributeFloatArrayDataAsync");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_SetAttributeFloatDataAsync(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const char * name, const HAPI_AttributeInfo * attr_info, const float * data_array, int start, int length, int * job_id)
+{
+    return fakeHAPILUnimplemented("HAPI_SetAttributeFloatDataAsync");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_SetAttributeFloatUniqueDataAsync(const HAPI_Session* session, HAPI_NodeId node_id, HAPI_PartId part_id, const char* name, const HAPI_AttributeInfo* attr_info, const float* data_array, int data_length, int start_index, int num_indices, int * job_id)
+{
+    return fakeHAPILUnimplemented("HAPI_SetAttributeFloatUniqueDataAsync");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_SetAttributeIndexedStringDataAsync(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const char * name, const HAPI_AttributeInfo * attr_info, const char ** string_array, int string_count, const int * indices_array, int indices_start, int indices_length, int * job_id)
+{
+    return fakeHAPILUnimplemented("HAPI_SetAttributeIndexedStringDataAsync");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_SetAttributeInt16ArrayData(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const char * name, const HAPI_AttributeInfo * attr_info, const HAPI_Int16 * data_fixed_array, int data_fixed_length, const int * sizes_fixed_array, int start, int sizes_fixed_length)
+{
+    return fakeHAPILUnimplemented("HAPI_SetAttributeInt16ArrayData");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_SetAttributeInt16ArrayDataAsync(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const char * name, const HAPI_AttributeInfo * attr_info, const HAPI_Int16 * data_fixed_array, int data_fixed_length, const int * sizes_fixed_array, int start, int sizes_fixed_length, int * job_id)
+{
+    return fakeHAPILUnimplemented("HAPI_SetAttributeInt16ArrayDataAsync");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_SetAttributeInt16Data(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const char * name, const HAPI_AttributeInfo * attr_info, const HAPI_Int16 * data_array, int start, int length)
+{
+    return fakeHAPILUnimplemented("HAPI_SetAttributeInt16Data");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_SetAttributeInt16DataAsync(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const char * name, const HAPI_AttributeInfo * attr_info, const HAPI_Int16 * data_array, int start, int length, int * job_id)
+{
+    return fakeHAPILUnimplemented("HAPI_SetAttributeInt16DataAsync");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_SetAttributeInt16UniqueData(const HAPI_Session* session, HAPI_NodeId node_id, HAPI_PartId part_id, const char* name, const HAPI_AttributeInfo* attr_info, const HAPI_Int16* data_array, int data_length, int start_index, int num_indices)
+{
+    return fakeHAPILUnimplemented("HAPI_SetAttributeInt16UniqueData");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_SetAttributeInt16UniqueDataAsync(const HAPI_Session* session, HAPI_NodeId node_id, HAPI_PartId part_id, const char* name, const HAPI_AttributeInfo* attr_info, const HAPI_Int16* data_array, int data_length, int start_index, int num_indices, int * job_id)
+{
+    return fakeHAPILUnimplemented("HAPI_SetAttributeInt16UniqueDataAsync");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_SetAttributeInt64ArrayData(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const char * name, const HAPI_AttributeInfo * attr_info, const HAPI_Int64 * data_fixed_array, int data_fixed_length, const int * sizes_fixed_array, int start, int sizes_fixed_length)
+{
+    return fakeHAPILUnimplemented("HAPI_SetAttributeInt64ArrayData");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_SetAttributeInt64ArrayDataAsync(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const char * name, const HAPI_AttributeInfo * attr_info, const HAPI_Int64 * data_fixed_array, int data_fixed_length, const int * sizes_fixed_array, int start, int sizes_fixed_length, int * job_id)
+{
+    return fakeHAPILUnimplemented("HAPI_SetAttributeInt64ArrayDataAsync");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_SetAttributeInt64Data(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const char * name, const HAPI_AttributeInfo * attr_info, const HAPI_Int64 * data_array, int start, int length)
+{
+    return fakeHAPILUnimplemented("HAPI_SetAttributeInt64Data");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_SetAttributeInt64DataAsync(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const char * name, const HAPI_AttributeInfo * attr_info, const HAPI_Int64 * data_array, int start, int length, int * job_id)
+{
+    return fakeHAPILUnimplemented("HAPI_SetAttributeInt64DataAsync");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_SetAttributeInt64UniqueData(const HAPI_Session* session, HAPI_NodeId node_id, HAPI_PartId part_id, const char* name, const HAPI_AttributeInfo* attr_info, const HAPI_Int64* data_array, int data_length, int start_index, int num_indices)
+{
+    return fakeHAPILUnimplemented("HAPI_SetAttributeInt64UniqueData");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_SetAttributeInt64UniqueDataAsync(const HAPI_Session* session, HAPI_NodeId node_id, HAPI_PartId part_id, const char* name, const HAPI_AttributeInfo* attr_info, const HAPI_Int64* data_array, int data_length, int start_index, int num_indices, int * job_id)
+{
+    return fakeHAPILUnimplemented("HAPI_SetAttributeInt64UniqueDataAsync");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_SetAttributeInt8ArrayData(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const char * name, const HAPI_AttributeInfo * attr_info, const HAPI_Int8 * data_fixed_array, int data_fixed_length, const int * sizes_fixed_array, int start, int sizes_fixed_length)
+{
+    return fakeHAPILUnimplemented("HAPI_SetAttributeInt8ArrayData");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_SetAttributeInt8ArrayDataAsync(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const char * name, const HAPI_AttributeInfo * attr_info, const HAPI_Int8 * data_fixed_array, int data_fixed_length, const int * sizes_fixed_array, int start, int sizes_fixed_length, int * job_id)
+{
+    return fakeHAPILUnimplemented("HAPI_SetAttributeInt8ArrayDataAsync");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_SetAttributeInt8Data(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const char * name, const HAPI_AttributeInfo * attr_info, const HAPI_Int8 * data_array, int start, int length)
+{
+    return fakeHAPILUnimplemented("HAPI_SetAttributeInt8Data");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_SetAttributeInt8DataAsync(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const char * name, const HAPI_AttributeInfo * attr_info, const HAPI_Int8 * data_array, int start, int length, int * job_id)
+{
+    return fakeHAPILUnimplemented("HAPI_SetAttributeInt8DataAsync");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_SetAttributeInt8UniqueData(const HAPI_Session* session, HAPI_NodeId node_id, HAPI_PartId part_id, const char* name, const HAPI_AttributeInfo* attr_info, const HAPI_Int8* data_array, int data_length, int start_index, int num_indices)
+{
+    return fakeHAPILUnimplemented("HAPI_SetAttributeInt8UniqueData");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_SetAttributeInt8UniqueDataAsync(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const char * name, const HAPI_AttributeInfo * attr_info, const HAPI_Int8* data_array, int data_length, int start_index, int num_indices, int * job_id)
+{
+    return fakeHAPILUnimplemented("HAPI_SetAttributeInt8UniqueDataAsync");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_SetAttributeIntArrayData(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const char * name, const HAPI_AttributeInfo * attr_info, const int * data_fixed_array, int data_fixed_length, const int * sizes_fixed_array, int start, int sizes_fixed_length)
+{
+    return fakeHAPILUnimplemented("HAPI_SetAttributeIntArrayData");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_SetAttributeIntArrayDataAsync(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const char * name, const HAPI_AttributeInfo * attr_info, const int * data_fixed_array, int data_fixed_length, const int * sizes_fixed_array, int start, int sizes_fixed_length, int * job_id)
+{
+    return fakeHAPILUnimplemented("HAPI_SetAttributeIntArrayDataAsync");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_SetAttributeIntDataAsync(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const char * name, const HAPI_AttributeInfo * attr_info, const int * data_array, int start, int length, int * job_id)
+{
+    return fakeHAPILUnimplemented("HAPI_SetAttributeIntDataAsync");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_SetAttributeIntUniqueDataAsync(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const char * name, const HAPI_AttributeInfo * attr_info, const int * data_array, int data_length, int start_index, int num_indices, int * job_id)
+{
+    return fakeHAPILUnimplemented("HAPI_SetAttributeIntUniqueDataAsync");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_SetAttributeStringArrayData(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const char * name, const HAPI_AttributeInfo * attr_info, const char ** data_fixed_array, int data_fixed_length, const int * sizes_fixed_array, int start, int sizes_fixed_length)
+{
+    return fakeHAPILUnimplemented("HAPI_SetAttributeStringArrayData");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_SetAttributeStringArrayDataAsync(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const char * name, const HAPI_AttributeInfo * attr_info, const char ** data_fixed_array, int data_fixed_length, const int * sizes_fixed_array, int start, int sizes_fixed_length, int * job_id)
+{
+    return fakeHAPILUnimplemented("HAPI_SetAttributeStringArrayDataAsync");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_SetAttributeStringDataAsync(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const char * name, const HAPI_AttributeInfo * attr_info, const char ** data_array, int start, int length, int * job_id)
+{
+    return fakeHAPILUnimplemented("HAPI_SetAttributeStringDataAsync");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_SetAttributeStringUniqueDataAsync(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const char * name, const HAPI_AttributeInfo * attr_info, const char * data_array, int data_length, int start_index, int num_indices, int * job_id)
+{
+    return fakeHAPILUnimplemented("HAPI_SetAttributeStringUniqueDataAsync");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_SetAttributeUInt8ArrayData(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const char * name, const HAPI_AttributeInfo * attr_info, const HAPI_UInt8 * data_fixed_array, int data_fixed_length, const int * sizes_fixed_array, int start, int sizes_fixed_length)
+{
+    return fakeHAPILUnimplemented("HAPI_SetAttributeUInt8ArrayData");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_SetAttributeUInt8ArrayDataAsync(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const char * name, const HAPI_AttributeInfo * attr_info, const HAPI_UInt8 * data_fixed_array, int data_fixed_length, const int * sizes_fixed_array, int start, int sizes_fixed_length, int * job_id)
+{
+    return fakeHAPILUnimplemented("HAPI_SetAttributeUInt8ArrayDataAsync");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_SetAttributeUInt8Data(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const char * name, const HAPI_AttributeInfo * attr_info, const HAPI_UInt8 * data_array, int start, int length)
+{
+    return fakeHAPILUnimplemented("HAPI_SetAttributeUInt8Data");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_SetAttributeUInt8DataAsync(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const char * name, const HAPI_AttributeInfo * attr_info, const HAPI_UInt8 * data_array, int start, int length, int * job_id)
+{
+    return fakeHAPILUnimplemented("HAPI_SetAttributeUInt8DataAsync");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_SetAttributeUInt8UniqueData(const HAPI_Session* session, HAPI_NodeId node_id, HAPI_PartId part_id, const char* name, const HAPI_AttributeInfo* attr_info, const HAPI_UInt8* data_array, int data_length, int start_index, int num_indices)
+{
+    return fakeHAPILUnimplemented("HAPI_SetAttributeUInt8UniqueData");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_SetAttributeUInt8UniqueDataAsync(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const char * name, const HAPI_AttributeInfo * attr_info, const HAPI_UInt8 * data_array, int data_length, int start_index, int num_indices, int * job_id)
+{
+    return fakeHAPILUnimplemented("HAPI_SetAttributeUInt8UniqueDataAsync");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_SetCacheProperty(const HAPI_Session * session, const char * cache_name, HAPI_CacheProperty cache_property, int property_value)
+{
+    return fakeHAPILUnimplemented("HAPI_SetCacheProperty");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_SetCompositorOptions(const HAPI_Session * session, const HAPI_CompositorOptions * compositor_options)
+{
+    return fakeHAPILUnimplemented("HAPI_SetCompositorOptions");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_SetCurveCounts(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const int * counts_array, int start, int length)
+{
+    return fakeHAPILUnimplemented("HAPI_SetCurveCounts");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_SetCurveInfo(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const HAPI_CurveInfo * info)
+{
+    return fakeHAPILUnimplemented("HAPI_SetCurveInfo");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_SetCurveKnots(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const float * knots_array, int start, int length)
+{
+    return fakeHAPILUnimplemented("HAPI_SetCurveKnots");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_SetCurveOrders(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const int * orders_array, int start, int length)
+{
+    return fakeHAPILUnimplemented("HAPI_SetCurveOrders");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_SetCustomString(const HAPI_Session * session, const char * string_value, HAPI_StringHandle * handle_value)
+{
+    return fakeHAPILUnimplemented("HAPI_SetCustomString");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_SetGroupMembership(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, HAPI_GroupType group_type, const char * group_name, const int * membership_array, int start, int length)
+{
+    return fakeHAPILUnimplemented("HAPI_SetGroupMembership");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_SetHeightFieldData(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const char * name, const float * values_array, int start, int length)
+{
+    return fakeHAPILUnimplemented("HAPI_SetHeightFieldData");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_SetImageInfo(const HAPI_Session * session, HAPI_NodeId material_node_id, const HAPI_ImageInfo * image_info)
+{
+    return fakeHAPILUnimplemented("HAPI_SetImageInfo");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_SetInputCurveInfo(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const HAPI_InputCurveInfo * info)
+{
+    return fakeHAPILUnimplemented("HAPI_SetInputCurveInfo");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_SetInputCurvePositions(const HAPI_Session* session, HAPI_NodeId node_id, HAPI_PartId part_id, const float* positions_array, int start, int length)
+{
+    return fakeHAPILUnimplemented("HAPI_SetInputCurvePositions");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_SetInputCurvePositionsRotationsScales(const HAPI_Session* session, HAPI_NodeId node_id, HAPI_PartId part_id, const float* positions_array, int positions_start, int positions_length, const float* rotations_array, int rotations_start, int rotations_length, const float * scales_array, int scales_start, int scales_length)
+{
+    return fakeHAPILUnimplemented("HAPI_SetInputCurvePositionsRotationsScales");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_SetObjectTransform(const HAPI_Session * session, HAPI_NodeId node_id, const HAPI_TransformEuler * trans)
+{
+    return fakeHAPILUnimplemented("HAPI_SetObjectTransform");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_SetParmExpression(const HAPI_Session * session, HAPI_NodeId node_id, const char * value, HAPI_ParmId parm_id, int index)
+{
+    return fakeHAPILUnimplemented("HAPI_SetParmExpression");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_SetParmFloatValue(const HAPI_Session * session, HAPI_NodeId node_id, const char * parm_name, int index, float value)
+{
+    return fakeHAPILUnimplemented("HAPI_SetParmFloatValue");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_SetParmIntValue(const HAPI_Session * session, HAPI_NodeId node_id, const char * parm_name, int index, int value)
+{
+    return fakeHAPILUnimplemented("HAPI_SetParmIntValue");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_SetParmIntValues(const HAPI_Session * session, HAPI_NodeId node_id, const int * values_array, int start, int length)
+{
+    return fakeHAPILUnimplemented("HAPI_SetParmIntValues");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_SetParmNodeValue(const HAPI_Session * session, HAPI_NodeId node_id, const char * parm_name, HAPI_NodeId value)
+{
+    return fakeHAPILUnimplemented("HAPI_SetParmNodeValue");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_SetParmStringValue(const HAPI_Session * session, HAPI_NodeId node_id, const char * value, HAPI_ParmId parm_id, int index)
+{
+    return fakeHAPILUnimplemented("HAPI_SetParmStringValue");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_SetServerEnvInt(const HAPI_Session * session, const char * variable_name, int value)
+{
+    return fakeHAPILUnimplemented("HAPI_SetServerEnvInt");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_SetServerEnvString(const HAPI_Session * session, const char * variable_name, const char * value)
+{
+    return fakeHAPILUnimplemented("HAPI_SetServerEnvString");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_SetSessionSync(const HAPI_Session * session, HAPI_Bool enable)
+{
+    return fakeHAPILUnimplemented("HAPI_SetSessionSync");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_SetSessionSyncInfo(const HAPI_Session * session, const HAPI_SessionSyncInfo * session_sync_info)
+{
+    return fakeHAPILUnimplemented("HAPI_SetSessionSyncInfo");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_SetTime(const HAPI_Session * session, float time)
+{
+    return fakeHAPILUnimplemented("HAPI_SetTime");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_SetTimelineOptions(const HAPI_Session * session, const HAPI_TimelineOptions * timeline_options)
+{
+    return fakeHAPILUnimplemented("HAPI_SetTimelineOptions");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_SetTransformAnimCurve(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_TransformComponent trans_comp, const HAPI_Keyframe * curve_keyframes_array, int keyframe_count)
+{
+    return fakeHAPILUnimplemented("HAPI_SetTransformAnimCurve");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_SetUseHoudiniTime(const HAPI_Session * session, HAPI_Bool enabled)
+{
+    return fakeHAPILUnimplemented("HAPI_SetUseHoudiniTime");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_SetViewport(const HAPI_Session * session, const HAPI_Viewport * viewport)
+{
+    return fakeHAPILUnimplemented("HAPI_SetViewport");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_SetVolumeInfo(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const HAPI_VolumeInfo * volume_info)
+{
+    return fakeHAPILUnimplemented("HAPI_SetVolumeInfo");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_SetVolumeTileFloatData(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const HAPI_VolumeTileInfo * tile, const float * values_array, int length)
+{
+    return fakeHAPILUnimplemented("HAPI_SetVolumeTileFloatData");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_SetVolumeTileIntData(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const HAPI_VolumeTileInfo * tile, const int * values_array, int length)
+{
+    return fakeHAPILUnimplemented("HAPI_SetVolumeTileIntData");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_SetVolumeVoxelFloatData(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, int x_index, int y_index, int z_index, const float * values_array, int value_count)
+{
+    return fakeHAPILUnimplemented("HAPI_SetVolumeVoxelFloatData");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_SetVolumeVoxelIntData(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, int x_index, int y_index, int z_index, const int * values_array, int value_count)
+{
+    return fakeHAPILUnimplemented("HAPI_SetVolumeVoxelIntData");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_SetWorkItemFloatAttribute(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PDG_WorkItemId work_item_id, const char * attribute_name, const float * values_array, int length)
+{
+    return fakeHAPILUnimplemented("HAPI_SetWorkItemFloatAttribute");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_SetWorkItemIntAttribute(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PDG_WorkItemId work_item_id, const char * attribute_name, const int * values_array, int length)
+{
+    return fakeHAPILUnimplemented("HAPI_SetWorkItemIntAttribute");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_SetWorkItemStringAttribute(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PDG_WorkItemId work_item_id, const char * attribute_name, int data_index, const char * value)
+{
+    return fakeHAPILUnimplemented("HAPI_SetWorkItemStringAttribute");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_SetWorkitemFloatData(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PDG_WorkItemId workitem_id, const char * data_name, const float * values_array, int length)
+{
+    return fakeHAPILUnimplemented("HAPI_SetWorkitemFloatData");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_SetWorkitemIntData(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PDG_WorkItemId workitem_id, const char * data_name, const int * values_array, int length)
+{
+    return fakeHAPILUnimplemented("HAPI_SetWorkitemIntData");
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Result) HAPI_SetWorkitemStringData(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PDG_WorkItemId workitem_id, const char * data_name, int data_index, const char * value)
+{
+    return fakeHAPILUnimplemented("HAPI_SetWorkitemStringData");
+}
+
+FAKE_HAPI_DECL_RETURN(void) HAPI_ThriftServerOptions_Init(HAPI_ThriftServerOptions * in)
+{
+    if (in)
+        *in = HAPI_ThriftServerOptions();
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_TimelineOptions) HAPI_TimelineOptions_Create()
+{
+    return HAPI_TimelineOptions();
+}
+
+FAKE_HAPI_DECL_RETURN(void) HAPI_TimelineOptions_Init(HAPI_TimelineOptions * in)
+{
+    if (in)
+        *in = HAPI_TimelineOptions();
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_TransformEuler) HAPI_TransformEuler_Create()
+{
+    return HAPI_TransformEuler();
+}
+
+FAKE_HAPI_DECL_RETURN(void) HAPI_TransformEuler_Init(HAPI_TransformEuler * in)
+{
+    if (in)
+        *in = HAPI_TransformEuler();
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Transform) HAPI_Transform_Create()
+{
+    return HAPI_Transform();
+}
+
+FAKE_HAPI_DECL_RETURN(void) HAPI_Transform_Init(HAPI_Transform * in)
+{
+    if (in)
+        *in = HAPI_Transform();
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_Viewport) HAPI_Viewport_Create()
+{
+    return HAPI_Viewport();
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_VolumeInfo) HAPI_VolumeInfo_Create()
+{
+    return HAPI_VolumeInfo();
+}
+
+FAKE_HAPI_DECL_RETURN(void) HAPI_VolumeInfo_Init(HAPI_VolumeInfo * in)
+{
+    if (in)
+        *in = HAPI_VolumeInfo();
+}
+
+FAKE_HAPI_DECL_RETURN(HAPI_VolumeTileInfo) HAPI_VolumeTileInfo_Create()
+{
+    return HAPI_VolumeTileInfo();
+}
+
+FAKE_HAPI_DECL_RETURN(void) HAPI_VolumeTileInfo_Init(HAPI_VolumeTileInfo * in)
+{
+    if (in)
+        *in = HAPI_VolumeTileInfo();
+}
@@ -0,0 +1,72 @@
+#!/usr/bin/env python3
+#
+# Generate FakeHAPIL_Stubs.cpp: an exported stub for every HAPI_* entry point resolved
+# by HoudiniApi::InitializeHAPI that FakeHAPIL.cpp does not implement itself.
+#
+# Usage: python3 GenerateStubs.py   (run again whenever HoudiniApi.h is regenerated)
+
+import os
+import re
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+API_HEADER = os.path.join(HERE, '..', 'HoudiniApi.h')
+API_SOURCE = os.path.join(HERE, '..', 'HoudiniApi.cpp')
+FAKE_SOURCE = os.path.join(HERE, 'FakeHAPIL.cpp')
+OUTPUT = os.path.join(HERE, 'FakeHAPIL_Stubs.cpp')
+
+TYPEDEF = re.compile(r'typedef\s+(.+?)\s*\(\*(\w+)FuncPtr\)\((.*)\);')
+EXPORT = re.compile(r'HoudiniApi::(\w+)\s*=\s*\(\w+FuncPtr\)\s*HoudiniEnginePlatform::GetDllExport\(\s*\w+\s*,\s*"(\w+)"\)')
+DEFINED = re.compile(r'FAKE_HAPI_DECL(?:_RETURN\(\s*[^)]*\))?\s+(HAPI_\w+)\s*\(')
+INIT_PARAM = re.compile(r'^(?:const\s+)?(\w+)\s*\*\s*in$')
+
+
+def read(path):
+    with open(path) as f:
+        return f.read()
+
+
+def license_header():
+    lines = read(API_HEADER).splitlines()
+    end = next(i for i, line in enumerate(lines) if line.strip() == '*/')
+    return '\n'.join(lines[:end + 1])
+
+
+def stub_body(return_type, export_name, params):
+    if return_type == 'HAPI_Result':
+        return '    return fakeHAPILUnimplemented("%s");' % export_name
+    if return_type == 'void':
+        init = INIT_PARAM.match(params.strip())
+        if export_name.endswith('_Init') and init:
+            return '    if (in)\n        *in = %s();' % init.group(1)
+        return '    return;'
+    if return_type in ('int', 'HAPI_Bool'):
+        return '    return 0;'
+    return '    return %s();' % return_type
+
+
+def main():
+    signatures = {name: (ret, params) for ret, name, params in TYPEDEF.findall(read(API_HEADER))}
+    exports = EXPORT.findall(read(API_SOURCE))
+    defined = set(DEFINED.findall(read(FAKE_SOURCE)))
+
+    out = [license_header(), '',
+           '// This file is generated by GenerateStubs.py. Do not modify directly.', '',
+           '#include "FakeHAPIL.h"', '']
+    for name, export_name in exports:
+        if export_name in defined:
+            continue
+        return_type, params = signatures[name]
+        out.append('FAKE_HAPI_DECL_RETURN(%s) %s(%s)' % (return_type, export_name, params))
+        out.append('{')
+        out.append(stub_body(return_type, export_name, params))
+        out.append('}')
+        out.append('')
+
+    with open(OUTPUT, 'w', newline='\n') as f:
+        f.write('\n'.join(out))
+
+    print('Wrote %d stubs to %s' % (len(exports) - len(defined & {e for _, e in exports}), OUTPUT))
+
+
+if __name__ == '__main__':
+    main()
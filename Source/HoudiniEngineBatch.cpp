@@ -0,0 +1,427 @@
+/*
+* Copyright (c) <2023> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "HoudiniApi.h"
+#include "HoudiniEngineBatch.h"
+#include "HoudiniEngineBgeo.h"
+#include "HoudiniEngineGeometry.h"
+#include "HoudiniEngineManager.h"
+#include "HoudiniEngineMeshCache.h"
+#include "HoudiniEngineTrace.h"
+#include "HoudiniEngineUtility.h"
+
+#include <chrono>
+#include <exception>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// A parsed job description
+struct BatchJob
+{
+    HoudiniEngineManager::SessionType sessionType = HoudiniEngineManager::InProcess;
+    std::string namedPipe = DEFAULT_NAMED_PIPE;
+    int tcpPort = DEFAULT_TCP_PORT;
+    std::string sharedMemoryName = DEFAULT_SHARED_MEMORY_NAME;
+    HAPI_ThriftSharedMemoryBufferType sharedMemoryBufferType = HAPI_THRIFT_SHARED_MEMORY_FIXED_LENGTH_BUFFER;
+    HAPI_Int64 sharedMemoryBufferSize = DEFAULT_SHARED_MEMORY_BUFFER_SIZE;
+    bool useCookingThread = true;
+    std::string cookProfile = DEFAULT_COOK_PROFILE;
+    std::string traceFile;
+
+    std::vector<std::string> hdas;
+
+    // (label, operator name), in creation order
+    std::vector<std::pair<std::string, std::string>> nodes;
+
+    struct Parm
+    {
+        std::string label;
+        std::string name;
+        std::vector<std::string> values;
+    };
+    std::vector<Parm> parms;
+
+    struct Output
+    {
+        std::string label;
+        std::string kind;
+        std::string file;
+    };
+    std::vector<Output> outputs;
+
+    std::vector<std::string> hips;
+};
+
+// A timed step of the job, reported individually
+struct BatchStep
+{
+    std::string phase;
+    std::string target;
+    double milliseconds;
+    bool success;
+};
+
+static bool
+parseJob(const std::string& job_path, BatchJob& job, std::string& error)
+{
+    std::ifstream job_file(job_path);
+    if (!job_file)
+    {
+        error = "Failed to open the job file " + job_path;
+        return false;
+    }
+
+    std::string line;
+    int line_number = 0;
+    while (std::getline(job_file, line))
+    {
+        ++line_number;
+        line = line.substr(0, line.find('#'));
+
+        std::istringstream line_stream(line);
+        std::vector<std::string> tokens;
+        std::string token;
+        while (line_stream >> std::quoted(token))
+            tokens.push_back(token);
+
+        if (tokens.empty())
+            continue;
+
+        const std::string& directive = tokens[0];
+        const size_t argument_count = tokens.size() - 1;
+        bool valid = true;
+        if (directive == "session" && argument_count >= 1)
+        {
+            job.sessionType = (HoudiniEngineManager::SessionType)std::stoi(tokens[1]);
+            if (argument_count >= 2)
+            {
+                if (job.sessionType == HoudiniEngineManager::NewTCPSocket ||
+                    job.sessionType == HoudiniEngineManager::ExistingTCPSocket)
+                    job.tcpPort = std::stoi(tokens[2]);
+                else if (job.sessionType == HoudiniEngineManager::NewNamedPipe ||
+                         job.sessionType == HoudiniEngineManager::ExistingNamedPipe)
+                    job.namedPipe = tokens[2];
+                else
+                    job.sharedMemoryName = tokens[2];
+            }
+            if (argument_count == 4 && job.sessionType == HoudiniEngineManager::NewSharedMemory)
+            {
+                job.sharedMemoryBufferSize = std::stoll(tokens[4]);
+                valid = HoudiniEngineManager::parseSharedMemoryBufferType(tokens[3], job.sharedMemoryBufferType) &&
+                        job.sharedMemoryBufferSize > 0;
+            }
+            else
+                valid = argument_count <= 2;
+        }
+        else if (directive == "cookingthread" && argument_count == 1)
+            job.useCookingThread = tokens[1] != "0";
+        else if (directive == "profile" && argument_count == 1)
+            job.cookProfile = tokens[1];
+        else if (directive == "hda" && argument_count == 1)
+            job.hdas.push_back(tokens[1]);
+        else if (directive == "node" && argument_count == 2)
+            job.nodes.emplace_back(tokens[1], tokens[2]);
+        else if (directive == "parm" && argument_count >= 3)
+            job.parms.push_back({ tokens[1], tokens[2], std::vector<std::string>(tokens.begin() + 3, tokens.end()) });
+        else if (directive == "output" && argument_count >= 2)
+            job.outputs.push_back({ tokens[1], tokens[2], argument_count >= 3 ? tokens[3] : std::string() });
+        else if (directive == "hip" && argument_count == 1)
+            job.hips.push_back(tokens[1]);
+        else if (directive == "trace" && argument_count == 1)
+            job.traceFile = tokens[1];
+        else
+            valid = false;
+
+        if (!valid)
+        {
+            error = "Invalid directive on line " + std::to_string(line_number) + ": " + line;
+            return false;
+        }
+    }
+
+    // Check the references to node labels up front, before paying for a session
+    std::map<std::string, bool> labels;
+    for (const std::pair<std::string, std::string>& node : job.nodes)
+        labels[node.first] = true;
+
+    for (const BatchJob::Parm& parm : job.parms)
+    {
+        if (!labels.count(parm.label))
+        {
+            error = "Unknown node label in parm: " + parm.label;
+            return false;
+        }
+    }
+
+    for (const BatchJob::Output& output : job.outputs)
+    {
+        if (!labels.count(output.label))
+        {
+            error = "Unknown node label in output: " + output.label;
+            return false;
+        }
+        if (output.kind != "mesh" && !(output.kind == "bgeo" && !output.file.empty()))
+        {
+            error = "Invalid output for " + output.label + ": " + output.kind;
+            return false;
+        }
+    }
+
+    return true;
+}
+
+static void
+writeReport(const std::string& report_path, const std::string& job_path, bool success, const std::string& error,
+            const std::vector<BatchStep>& steps, double startup_milliseconds, double total_milliseconds)
+{
+    // Phase totals first, then every step
+    std::vector<std::pair<std::string, double>> phases;
+    for (const BatchStep& step : steps)
+    {
+        if (phases.empty() || phases.back().first != step.phase)
+            phases.emplace_back(step.phase, 0.0);
+        phases.back().second += step.milliseconds;
+    }
+
+    std::ofstream report(report_path);
+    report << "{\n"
+           << "  \"job\": \"" << HoudiniEngineUtility::escapeJson(job_path) << "\",\n"
+           << "  \"success\": " << (success ? "true" : "false") << ",\n"
+           << "  \"error\": \"" << HoudiniEngineUtility::escapeJson(error) << "\",\n"
+           << "  \"startup_ms\": " << startup_milliseconds << ",\n"
+           << "  \"total_ms\": " << total_milliseconds << ",\n"
+           << "  \"phases_ms\": {";
+    for (size_t i = 0; i < phases.size(); ++i)
+        report << (i ? ", " : " ") << "\"" << phases[i].first << "\": " << phases[i].second;
+    report << " },\n"
+           << "  \"steps\": [";
+    for (size_t i = 0; i < steps.size(); ++i)
+    {
+        const BatchStep& step = steps[i];
+        report << (i ? ",\n" : "\n")
+               << "    { \"phase\": \"" << step.phase << "\", \"target\": \"" << HoudiniEngineUtility::escapeJson(step.target)
+               << "\", \"ms\": " << step.milliseconds << ", \"success\": " << (step.success ? "true" : "false") << " }";
+    }
+    report << "\n  ]\n}" << std::endl;
+
+    std::cout << "Batch report written to " << report_path << std::endl;
+}
+
+int
+HoudiniEngineBatch::run(const std::string& job_path, const std::string& report_path, double startup_milliseconds)
+{
+    auto job_start = std::chrono::steady_clock::now();
+    std::vector<BatchStep> steps;
+    std::string error;
+
+    // Time a step of the job, safe to call from several threads at once
+    auto runStep = [](const std::string& phase, const std::string& target, const std::function<bool()>& step)
+    {
+        auto start = std::chrono::steady_clock::now();
+        bool success = false;
+        try
+        {
+            success = step();
+        }
+        catch (const std::exception& exception)
+        {
+            std::cout << "Batch step failed: " << exception.what() << std::endl;
+        }
+
+        return BatchStep{ phase, target,
+            std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count(), success };
+    };
+
+    // Record a step, its first failure becoming the job's error
+    auto recordStep = [&](const BatchStep& step)
+    {
+        steps.push_back(step);
+        if (!step.success && error.empty())
+            error = step.phase + " failed: " + step.target;
+        return step.success;
+    };
+
+    auto timeStep = [&](const std::string& phase, const std::string& target, const std::function<bool()>& step)
+    {
+        return recordStep(runStep(phase, target, step));
+    };
+
+    // Time independent steps concurrently, recording them in job order
+    auto timeSteps = [&](const std::string& phase, size_t count, const std::function<std::string(size_t)>& target,
+                         const std::function<bool(size_t)>& step)
+    {
+        std::vector<BatchStep> results(count);
+        HoudiniEngineUtility::parallelFor((int64_t)count, [&](int64_t begin, int64_t end)
+        {
+            for (int64_t i = begin; i < end; ++i)
+                results[i] = runStep(phase, target((size_t)i), [&]() { return step((size_t)i); });
+        }, 1);
+
+        bool success = true;
+        for (const BatchStep& result : results)
+            success = recordStep(result) && success;
+        return success;
+    };
+
+    BatchJob job;
+    bool success = false;
+    try
+    {
+        success = parseJob(job_path, job, error);
+    }
+    catch (const std::exception& exception)
+    {
+        error = std::string("Invalid job file: ") + exception.what();
+    }
+
+    HoudiniEngineManager manager;
+    std::map<std::string, HAPI_NodeId> node_ids;
+    if (success)
+    {
+        if (!job.traceFile.empty())
+            HoudiniEngineTrace::setEnabled(true);
+
+        success = timeStep("session", std::to_string((int)job.sessionType), [&]()
+        {
+            manager.setSharedMemoryBuffer(job.sharedMemoryBufferType, job.sharedMemoryBufferSize);
+            return manager.startSession(job.sessionType, job.namedPipe, job.tcpPort, job.sharedMemoryName) &&
+                   manager.initializeHAPI(job.useCookingThread);
+        });
+    }
+
+    if (success)
+    {
+        success = timeSteps("hda", job.hdas.size(), [&](size_t i) { return job.hdas[i]; }, [&](size_t i)
+        {
+            HAPI_AssetLibraryId asset_library_id = -1;
+            std::string asset_name;
+            return manager.loadAsset(job.hdas[i].c_str(), asset_library_id, asset_name);
+        });
+    }
+
+    // Nodes are created uncooked, so that parameters are applied before their single cook
+    for (size_t i = 0; success && i < job.nodes.size(); ++i)
+    {
+        const std::pair<std::string, std::string>& node = job.nodes[i];
+        success = timeStep("node", node.first, [&]()
+        {
+            return manager.createNode(node.second.c_str(), node.first.c_str(), &node_ids[node.first]);
+        });
+    }
+
+    for (size_t i = 0; success && i < job.parms.size(); ++i)
+    {
+        const BatchJob::Parm& parm = job.parms[i];
+        success = timeStep("parm", parm.label + "/" + parm.name, [&]()
+        {
+            return manager.setParameter(node_ids[parm.label], parm.name, parm.values);
+        });
+    }
+
+    if (success && !node_ids.empty())
+    {
+        success = timeStep("cook", job.cookProfile, [&]()
+        {
+            std::vector<HAPI_NodeId> cook_nodes;
+            for (const std::pair<std::string, std::string>& node : job.nodes)
+                cook_nodes.push_back(node_ids[node.first]);
+            return manager.cookNodes(cook_nodes, job.cookProfile);
+        });
+    }
+
+    if (success)
+    {
+        auto output_target = [&](size_t i) { return job.outputs[i].label + ":" + job.outputs[i].kind; };
+        success = timeSteps("output", job.outputs.size(), output_target, [&](size_t i)
+        {
+            const BatchJob::Output& output = job.outputs[i];
+            HAPI_NodeId node_id = node_ids.at(output.label);
+            if (output.kind == "mesh")
+            {
+                // The nodes were all cooked above, so only read what they produced
+                HoudiniEngineMesh mesh;
+                if (!HoudiniEngineGeometry::readMeshFromHoudini(manager.getSession(), node_id, mesh))
+                    return false;
+
+                if (output.file.empty())
+                    return true;
+
+                const std::string bgeo_extension = ".bgeo";
+                if (output.file.size() >= bgeo_extension.size() &&
+                    output.file.compare(output.file.size() - bgeo_extension.size(), bgeo_extension.size(), bgeo_extension) == 0)
+                {
+                    std::vector<char> data;
+                    HoudiniEngineBgeo::encode(mesh, data);
+                    std::ofstream bgeo_file(output.file, std::ios::binary);
+                    bgeo_file.write(data.data(), (std::streamsize)data.size());
+                    return (bool)bgeo_file;
+                }
+
+                uint64_t key = 0;
+                return HoudiniEngineGeometry::getMeshCacheKey(manager.getSession(), node_id, key) &&
+                       HoudiniEngineMeshCache::write(output.file, mesh, key, true);
+            }
+
+            HAPI_GeoInfo geo_info;
+            HOUDINI_CHECK_ERROR_RETURN(
+                HoudiniApi::GetDisplayGeoInfo(manager.getSession(), node_id, &geo_info), false);
+            HOUDINI_CHECK_ERROR_RETURN(
+                HoudiniApi::SaveGeoToFile(manager.getSession(), geo_info.nodeId, output.file.c_str()), false);
+            return true;
+        });
+    }
+
+    for (size_t i = 0; success && i < job.hips.size(); ++i)
+    {
+        success = timeStep("hip", job.hips[i], [&]()
+        {
+            return HoudiniEngineUtility::saveToHip(manager.getSession(), job.hips[i]);
+        });
+    }
+
+    manager.stopSession();
+
+    if (!job.traceFile.empty())
+    {
+        HoudiniEngineTrace::setEnabled(false);
+        HoudiniEngineTrace::exportChromeTrace(job.traceFile);
+    }
+
+    double total_milliseconds =
+        std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - job_start).count();
+    writeReport(report_path, job_path, success, error, steps, startup_milliseconds, total_milliseconds);
+
+    if (!success)
+        std::cerr << "Batch job failed: " << error << std::endl;
+
+    return success ? 0 : 1;
+}
@@ -0,0 +1,59 @@
+/*
+* Copyright (c) <2023> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#pragma once
+
+#include <string>
+
+// Runs a job description without any user interaction, for render-farm workers.
+//
+// A job is a text file with one directive per line ('#' starts a comment, values
+// with spaces can be double-quoted):
+//
+//   session <type> [<pipe name> | <port> | <shared memory name> [fixed|ring <buffer size in MB>]]
+//   cookingthread <0|1>
+//   profile <cook profile>
+//   hda <path>
+//   node <label> <operator name>
+//   parm <label> <parm name> <value> [<value> ...]
+//   output <label> bgeo <file>
+//   output <label> mesh [<file>]
+//   hip <file>
+//   trace <file>
+//
+// The directives are executed in phases, whatever their order in the file: start the
+// session, load the HDAs, create the nodes, set the parameters, cook every node at
+// once, then write the outputs. The HDAs are loaded, and the outputs fetched, concurrently.
+//
+// A mesh output reads the cooked display geometry without cooking again, and writes it
+// to <file> when given: as a .bgeo when the file ends in .bgeo, as a mesh cache otherwise.
+struct HoudiniEngineBatch
+{
+public:
+    // Execute the job and write a JSON timing report, returns the process exit code.
+    // startup_milliseconds is the time the process took to load and bind libHAPIL.
+    static int run(const std::string& job_path, const std::string& report_path, double startup_milliseconds = 0.0);
+};
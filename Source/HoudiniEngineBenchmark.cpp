@@ -0,0 +1,633 @@
+/*
+* Copyright (c) <2023> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "HoudiniApi.h"
+#include "HoudiniEngineGeometry.h"
+#include "HoudiniEngineManager.h"
+#include "HoudiniEnginePlatform.h"
+#include "HoudiniEngineUtility.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// One measured row of the report
+struct BenchmarkResult
+{
+    std::string session;
+    std::string test;
+    long long bytes = 0;
+    int iterations = 0;
+    double meanUs = 0.0;
+    double p50Us = 0.0;
+    double p99Us = 0.0;
+    double megabytesPerSecond = 0.0;
+};
+
+struct BenchmarkOptions
+{
+    std::vector<HoudiniEngineManager::SessionType> sessionTypes;
+    long long minBytes = 1024;
+    long long maxBytes = 1024LL * 1024 * 1024;
+    int latencyCalls = 10000;
+    int meshMinPoints = 1024;
+    int meshMaxPoints = 4 * 1024 * 1024;
+    std::string format = "csv";
+    std::string outputPath;
+    bool checkFailover = false;
+    HAPI_ThriftSharedMemoryBufferType sharedMemoryBufferType = HAPI_THRIFT_SHARED_MEMORY_FIXED_LENGTH_BUFFER;
+    HAPI_Int64 sharedMemoryBufferSize = DEFAULT_SHARED_MEMORY_BUFFER_SIZE;
+    HoudiniEngineLibraryOptions library;
+};
+
+static const char*
+getSessionTypeName(HoudiniEngineManager::SessionType session_type)
+{
+    switch (session_type)
+    {
+        case HoudiniEngineManager::InProcess: return "in-process";
+        case HoudiniEngineManager::NewNamedPipe: return "named-pipe";
+        case HoudiniEngineManager::NewTCPSocket: return "tcp-socket";
+        case HoudiniEngineManager::NewSharedMemory: return "shared-memory";
+        default: return "unsupported";
+    }
+}
+
+// Summarize per-call timings (in microseconds) into a result row
+static BenchmarkResult
+summarize(const char* session, const char* test, long long bytes, std::vector<double>& timings_us)
+{
+    BenchmarkResult result;
+    result.session = session;
+    result.test = test;
+    result.bytes = bytes;
+    result.iterations = (int)timings_us.size();
+    if (timings_us.empty())
+        return result;
+
+    std::sort(timings_us.begin(), timings_us.end());
+    double total_us = 0.0;
+    for (double t : timings_us)
+        total_us += t;
+
+    result.meanUs = total_us / timings_us.size();
+    result.p50Us = timings_us[timings_us.size() / 2];
+    result.p99Us = timings_us[std::min(timings_us.size() - 1, timings_us.size() * 99 / 100)];
+    if (bytes > 0 && total_us > 0.0)
+        result.megabytesPerSecond = (bytes * (double)timings_us.size() / (1024.0 * 1024.0)) / (total_us * 1e-6);
+
+    std::cout << "  " << test;
+    if (bytes > 0)
+        std::cout << " " << bytes << " B";
+    std::cout << ": mean " << result.meanUs << " us, p50 " << result.p50Us << " us, p99 " << result.p99Us << " us";
+    if (bytes > 0)
+        std::cout << " (" << result.megabytesPerSecond << " MB/s)";
+    std::cout << std::endl;
+
+    return result;
+}
+
+// Time a single call, in microseconds
+template <typename CALL>
+static double
+timeCall(CALL call, HAPI_Result& result)
+{
+    auto start = std::chrono::steady_clock::now();
+    result = call();
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::micro>(end - start).count();
+}
+
+// Create an input node holding point_count points and cook it
+static bool
+createBenchmarkGeometry(const HAPI_Session* session, const HAPI_CookOptions* cook_options,
+                        int point_count, const std::vector<float>& positions, HAPI_NodeId* node_id)
+{
+    HOUDINI_CHECK_ERROR_RETURN(
+        HoudiniApi::CreateInputNode(session, -1, node_id, "Benchmark"), false);
+
+    HAPI_PartInfo part_info = HoudiniApi::PartInfo_Create();
+    part_info.type = HAPI_PARTTYPE_MESH;
+    part_info.faceCount = 0;
+    part_info.vertexCount = 0;
+    part_info.pointCount = point_count;
+    HOUDINI_CHECK_ERROR_RETURN(
+        HoudiniApi::SetPartInfo(session, *node_id, 0, &part_info), false);
+
+    HAPI_AttributeInfo point_info = HoudiniApi::AttributeInfo_Create();
+    point_info.count = point_count;
+    point_info.tupleSize = 3;
+    point_info.exists = true;
+    point_info.storage = HAPI_STORAGETYPE_FLOAT;
+    point_info.owner = HAPI_ATTROWNER_POINT;
+    HOUDINI_CHECK_ERROR_RETURN(
+        HoudiniApi::AddAttribute(session, *node_id, 0, "P", &point_info), false);
+
+    HOUDINI_CHECK_ERROR_RETURN(
+        HoudiniApi::SetAttributeFloatData(session, *node_id, 0, "P", &point_info, positions.data(), 0, point_count), false);
+
+    HOUDINI_CHECK_ERROR_RETURN(
+        HoudiniApi::CommitGeo(session, *node_id), false);
+
+    HOUDINI_CHECK_ERROR_RETURN(
+        HoudiniApi::CookNode(session, *node_id, cook_options), false);
+
+    int cook_status = HAPI_STATE_MAX;
+    HAPI_Result result;
+    do
+    {
+        result = HoudiniApi::GetStatus(session, HAPI_STATUS_COOK_STATE, &cook_status);
+    }
+    while (cook_status > HAPI_STATE_MAX_READY_STATE && result == HAPI_RESULT_SUCCESS);
+
+    HOUDINI_CHECK_ERROR_RETURN(result, false);
+    return true;
+}
+
+// Round-trip latency of calls that move (almost) no data
+static bool
+measureLatency(const HAPI_Session* session, const char* session_name, int call_count, std::vector<BenchmarkResult>& results)
+{
+    HAPI_Result result = HAPI_RESULT_SUCCESS;
+    std::vector<double> timings_us(call_count);
+
+    for (int i = 0; i < call_count; ++i)
+    {
+        int status = 0;
+        timings_us[i] = timeCall([&]() { return HoudiniApi::GetStatus(session, HAPI_STATUS_COOK_STATE, &status); }, result);
+        HOUDINI_CHECK_ERROR_RETURN(result, false);
+    }
+    results.push_back(summarize(session_name, "GetStatus", 0, timings_us));
+
+    timings_us.assign(call_count, 0.0);
+    for (int i = 0; i < call_count; ++i)
+    {
+        timings_us[i] = timeCall([&]() { return HoudiniApi::IsSessionValid(session); }, result);
+        HOUDINI_CHECK_ERROR_RETURN(result, false);
+    }
+    results.push_back(summarize(session_name, "IsSessionValid", 0, timings_us));
+
+    return true;
+}
+
+// Attribute get/set bandwidth for a P attribute of the given size in bytes
+static bool
+measureBandwidth(const HAPI_Session* session, const HAPI_CookOptions* cook_options, const char* session_name,
+                 long long bytes, std::vector<BenchmarkResult>& results)
+{
+    const int point_count = (int)std::max(1LL, bytes / (long long)(3 * sizeof(float)));
+    const long long actual_bytes = (long long)point_count * 3 * sizeof(float);
+
+    // Aim for ~256 MB moved per test, with at least a few samples
+    const int iterations = (int)std::min(1000LL, std::max(5LL, (256LL * 1024 * 1024) / actual_bytes));
+
+    std::vector<float> positions((size_t)point_count * 3);
+    for (size_t i = 0; i < positions.size(); ++i)
+        positions[i] = (float)i;
+
+    HAPI_NodeId node_id = -1;
+    if (!createBenchmarkGeometry(session, cook_options, point_count, positions, &node_id))
+        return false;
+
+    HAPI_AttributeInfo point_info;
+    HOUDINI_CHECK_ERROR_RETURN(
+        HoudiniApi::GetAttributeInfo(session, node_id, 0, "P", HAPI_ATTROWNER_POINT, &point_info), false);
+
+    HAPI_Result result = HAPI_RESULT_SUCCESS;
+    std::vector<double> timings_us(iterations);
+    for (int i = 0; i < iterations; ++i)
+    {
+        timings_us[i] = timeCall([&]()
+        {
+            return HoudiniApi::GetAttributeFloatData(
+                session, node_id, 0, "P", &point_info, -1, positions.data(), 0, point_count);
+        }, result);
+        HOUDINI_CHECK_ERROR_RETURN(result, false);
+    }
+    results.push_back(summarize(session_name, "GetAttributeFloatData", actual_bytes, timings_us));
+
+    // The same read split into auto-tuned chunks
+    timings_us.assign(iterations, 0.0);
+    for (int i = 0; i < iterations; ++i)
+    {
+        timings_us[i] = timeCall([&]()
+        {
+            return HoudiniEngineGeometry::readAttributeFloatDataChunked(
+                session, node_id, 0, "P", point_info, positions.data()) ? HAPI_RESULT_SUCCESS : HAPI_RESULT_FAILURE;
+        }, result);
+        HOUDINI_CHECK_ERROR_RETURN(result, false);
+    }
+    results.push_back(summarize(session_name, "GetAttributeFloatDataChunked", actual_bytes, timings_us));
+
+    timings_us.assign(iterations, 0.0);
+    for (int i = 0; i < iterations; ++i)
+    {
+        timings_us[i] = timeCall([&]()
+        {
+            return HoudiniApi::SetAttributeFloatData(
+                session, node_id, 0, "P", &point_info, positions.data(), 0, point_count);
+        }, result);
+        HOUDINI_CHECK_ERROR_RETURN(result, false);
+    }
+    results.push_back(summarize(session_name, "SetAttributeFloatData", actual_bytes, timings_us));
+
+    HOUDINI_CHECK_ERROR(HoudiniApi::DeleteNode(session, node_id));
+    return true;
+}
+
+// A grid of quads with P and Cd point, uv vertex and name primitive attributes
+static void
+createBenchmarkMesh(int point_count, HoudiniEngineMesh& mesh)
+{
+    const int width = std::max(2, (int)std::sqrt((double)point_count));
+    const int rows = std::max(2, point_count / width);
+
+    mesh = HoudiniEngineMesh();
+    mesh.pointCount = width * rows;
+
+    HoudiniEngineMeshAttribute positions;
+    positions.name = "P";
+    positions.owner = HAPI_ATTROWNER_POINT;
+    positions.tupleSize = 3;
+
+    HoudiniEngineMeshAttribute colors = positions;
+    colors.name = "Cd";
+
+    for (int point = 0; point < mesh.pointCount; ++point)
+    {
+        const float x = (float)(point % width);
+        const float z = (float)(point / width);
+        positions.values.insert(positions.values.end(), { x, std::sin(x * 0.1f) * std::cos(z * 0.1f), z });
+        colors.values.insert(colors.values.end(), { x / width, 0.5f, z / rows });
+    }
+
+    HoudiniEngineMeshAttribute uvs;
+    uvs.name = "uv";
+    uvs.owner = HAPI_ATTROWNER_VERTEX;
+    uvs.tupleSize = 2;
+
+    HoudiniEngineMeshAttribute names;
+    names.name = "name";
+    names.owner = HAPI_ATTROWNER_PRIM;
+    names.isString = true;
+    names.strings = { "left", "right" };
+
+    for (int row = 0; row + 1 < rows; ++row)
+    {
+        for (int column = 0; column + 1 < width; ++column)
+        {
+            const int corner = row * width + column;
+            const int quad[4] = { corner, corner + width, corner + width + 1, corner + 1 };
+            mesh.faceCounts.push_back(4);
+            for (int point : quad)
+            {
+                mesh.vertexList.push_back(point);
+                uvs.values.insert(uvs.values.end(), { (float)(point % width) / width, (float)(point / width) / rows });
+            }
+            names.indices.push_back(column < width / 2 ? 0 : 1);
+        }
+    }
+
+    mesh.attributes = { positions, colors, uvs, names };
+}
+
+// Whole-mesh transfers, attribute by attribute against a single .bgeo blob, to find the
+// mesh size where one transport overtakes the other
+static bool
+measureMeshTransfer(const HAPI_Session* session, const HAPI_CookOptions* cook_options, const char* session_name,
+                    int point_count, std::vector<BenchmarkResult>& results)
+{
+    HoudiniEngineMesh mesh;
+    createBenchmarkMesh(point_count, mesh);
+
+    // Bytes of the mesh arrays themselves, which both transports have to move
+    long long bytes = (long long)(mesh.faceCounts.size() + mesh.vertexList.size()) * sizeof(int);
+    for (const HoudiniEngineMeshAttribute& attribute : mesh.attributes)
+        bytes += (long long)(attribute.values.size() * sizeof(float) + (attribute.intValues.size() + attribute.indices.size()) * sizeof(int));
+
+    const int iterations = (int)std::min(100LL, std::max(3LL, (256LL * 1024 * 1024) / bytes));
+
+    HAPI_NodeId node_id = -1;
+    HOUDINI_CHECK_ERROR_RETURN(
+        HoudiniApi::CreateInputNode(session, -1, &node_id, "BenchmarkMesh"), false);
+
+    HoudiniEngineMesh read_mesh;
+    HAPI_Result result = HAPI_RESULT_SUCCESS;
+    std::vector<double> timings_us;
+
+    auto measure = [&](const char* test, const std::function<bool()>& transfer)
+    {
+        timings_us.assign(iterations, 0.0);
+        for (int i = 0; i < iterations; ++i)
+        {
+            timings_us[i] = timeCall([&]() { return transfer() ? HAPI_RESULT_SUCCESS : HAPI_RESULT_FAILURE; }, result);
+            if (result != HAPI_RESULT_SUCCESS)
+                return false;
+        }
+        results.push_back(summarize(session_name, test, bytes, timings_us));
+        return true;
+    };
+
+    std::cout << "  Mesh of " << mesh.pointCount << " points, " << mesh.faceCounts.size() << " faces" << std::endl;
+    bool success =
+        measure("SendMeshAttributes", [&]() { return HoudiniEngineGeometry::sendMeshToHoudini(session, node_id, mesh); }) &&
+        measure("SendMeshBgeo", [&]() { return HoudiniEngineGeometry::sendMeshBgeoToHoudini(session, node_id, mesh); });
+
+    if (success)
+    {
+        HOUDINI_CHECK_ERROR_RETURN(
+            HoudiniApi::CookNode(session, node_id, cook_options), false);
+
+        success =
+            measure("ReadMeshAttributes", [&]() { return HoudiniEngineGeometry::readMeshFromHoudini(session, node_id, read_mesh); }) &&
+            measure("ReadMeshBgeo", [&]() { return HoudiniEngineGeometry::readMeshBgeoFromHoudini(session, node_id, read_mesh); });
+    }
+
+    HOUDINI_CHECK_ERROR(HoudiniApi::DeleteNode(session, node_id));
+    return success;
+}
+
+static bool
+benchmarkSessionType(HoudiniEngineManager::SessionType session_type, const BenchmarkOptions& options,
+                     std::vector<BenchmarkResult>& results)
+{
+    const char* session_name = getSessionTypeName(session_type);
+    std::cout << "\n[" << session_name << "]" << std::endl;
+
+    HoudiniEngineManager manager;
+    manager.setSharedMemoryBuffer(options.sharedMemoryBufferType, options.sharedMemoryBufferSize);
+    bool success = manager.startSession(session_type, DEFAULT_NAMED_PIPE, DEFAULT_TCP_PORT, DEFAULT_SHARED_MEMORY_NAME) &&
+                   manager.initializeHAPI(false);
+    if (!success)
+    {
+        std::cerr << "Failed to start a " << session_name << " session." << std::endl;
+    }
+    else
+    {
+        success = measureLatency(manager.getSession(), session_name, options.latencyCalls, results);
+
+        // Sizes grow 4x per step, from min to max
+        for (long long bytes = options.minBytes; success && bytes <= options.maxBytes; bytes *= 4)
+            success = measureBandwidth(manager.getSession(), manager.getCookOptions(), session_name, bytes, results);
+
+        for (int points = options.meshMinPoints; success && points <= options.meshMaxPoints; points *= 4)
+            success = measureMeshTransfer(manager.getSession(), manager.getCookOptions(), session_name, points, results);
+    }
+
+    manager.stopSession();
+    return success;
+}
+
+// Edit a parameter of a cooked node, fail over to the warm standby and check that the
+// replayed node has the edited value
+static bool
+checkFailover(HoudiniEngineManager::SessionType session_type, const BenchmarkOptions& options)
+{
+    const char* session_name = getSessionTypeName(session_type);
+    std::cout << "\n[" << session_name << "] failover" << std::endl;
+
+    HoudiniEngineManager manager;
+    manager.setSharedMemoryBuffer(options.sharedMemoryBufferType, options.sharedMemoryBufferSize);
+    bool success = manager.startSession(session_type, DEFAULT_NAMED_PIPE, DEFAULT_TCP_PORT, DEFAULT_SHARED_MEMORY_NAME) &&
+                   manager.initializeHAPI(false) &&
+                   manager.enableWarmStandby(true);
+
+    HAPI_NodeId node_id = -1;
+    const std::vector<std::string> size = { "2", "3", "4" };
+    success = success &&
+              manager.createNode("Sop/box", "failover_check", &node_id) &&
+              manager.cookNode(node_id, DEFAULT_COOK_PROFILE) &&
+              manager.setParameter(node_id, "size", size);
+
+    std::map<HAPI_NodeId, HAPI_NodeId> replayed_nodes;
+    success = success && manager.restartSession(session_type, false, &replayed_nodes) && replayed_nodes.count(node_id);
+    if (success)
+    {
+        HAPI_NodeId replayed_node_id = replayed_nodes[node_id];
+        HAPI_ParmInfo parm_info;
+        float values[3] = { 0.0f, 0.0f, 0.0f };
+        success =
+            HoudiniApi::GetParmInfoFromName(manager.getSession(), replayed_node_id, "size", &parm_info) == HAPI_RESULT_SUCCESS &&
+            HoudiniApi::GetParmFloatValues(manager.getSession(), replayed_node_id, values, parm_info.floatValuesIndex, 3) == HAPI_RESULT_SUCCESS;
+
+        for (int i = 0; success && i < 3; ++i)
+            success = values[i] == std::stof(size[i]);
+
+        std::cout << "  Replayed size: " << values[0] << ", " << values[1] << ", " << values[2] << std::endl;
+    }
+
+    std::cout << "  Failover check " << (success ? "passed" : "FAILED") << std::endl;
+    manager.stopSession();
+    return success;
+}
+
+static void
+writeReport(std::ostream& out, const std::string& format, const std::vector<BenchmarkResult>& results)
+{
+    if (format == "json")
+    {
+        out << "[\n";
+        for (size_t i = 0; i < results.size(); ++i)
+        {
+            const BenchmarkResult& r = results[i];
+            out << "  {\"session\": \"" << r.session << "\", \"test\": \"" << r.test
+                << "\", \"bytes\": " << r.bytes << ", \"iterations\": " << r.iterations
+                << ", \"mean_us\": " << r.meanUs << ", \"p50_us\": " << r.p50Us << ", \"p99_us\": " << r.p99Us
+                << ", \"mb_per_s\": " << r.megabytesPerSecond << "}" << (i + 1 < results.size() ? "," : "") << "\n";
+        }
+        out << "]\n";
+    }
+    else
+    {
+        out << "session,test,bytes,iterations,mean_us,p50_us,p99_us,mb_per_s\n";
+        for (const BenchmarkResult& r : results)
+        {
+            out << r.session << "," << r.test << "," << r.bytes << "," << r.iterations << ","
+                << r.meanUs << "," << r.p50Us << "," << r.p99Us << "," << r.megabytesPerSecond << "\n";
+        }
+    }
+}
+
+static void
+printUsage()
+{
+    std::cout << "Usage: HoudiniEngineBenchmark [options]" << std::endl;
+    std::cout << "  --sessions 7,2,3,1   Session types to measure (in-process should run last)" << std::endl;
+    std::cout << "  --min-size bytes     Smallest attribute transfer (default 1024)" << std::endl;
+    std::cout << "  --max-size bytes     Largest attribute transfer (default 1073741824)" << std::endl;
+    std::cout << "  --latency-calls n    Calls per latency test (default 10000)" << std::endl;
+    std::cout << "  --mesh-min-points n  Smallest mesh of the attribute vs .bgeo transfer tests (default 1024)" << std::endl;
+    std::cout << "  --mesh-max-points n  Largest mesh of those tests, 0 to skip them (default 4194304)" << std::endl;
+    std::cout << "  --format csv|json    Report format (default csv)" << std::endl;
+    std::cout << "  --output path        Write the report to a file instead of stdout" << std::endl;
+    std::cout << "  --shm-buffer type    Shared memory session buffer, fixed or ring (default fixed)" << std::endl;
+    std::cout << "  --shm-buffer-size MB Shared memory session buffer size (default " << DEFAULT_SHARED_MEMORY_BUFFER_SIZE << ")" << std::endl;
+    std::cout << "  --libhapil path      Load this library instead of libHAPIL" << std::endl;
+    std::cout << "  --bind-now           Resolve every libHAPIL symbol at load time" << std::endl;
+    std::cout << "  --check-failover     Instead of measuring, check that a failover to the warm standby" << std::endl;
+    std::cout << "                       restores an edited parameter, for each session type with a server" << std::endl;
+}
+
+int
+main(int argc, char ** argv)
+{
+    std::cout << "==========================================" << std::endl;
+    std::cout << " Houdini Engine Sample Transport Benchmark " << std::endl;
+    std::cout << "==========================================" << std::endl;
+
+    BenchmarkOptions options;
+    for (int i = 1; i < argc; ++i)
+    {
+        std::string arg = argv[i];
+        if (arg == "--help")
+        {
+            printUsage();
+            return 0;
+        }
+        if (arg == "--bind-now")
+        {
+            options.library.bindNow = true;
+            continue;
+        }
+        if (arg == "--check-failover")
+        {
+            options.checkFailover = true;
+            continue;
+        }
+        if (i + 1 >= argc)
+        {
+            printUsage();
+            return 1;
+        }
+
+        std::string value = argv[++i];
+        if (arg == "--sessions")
+        {
+            std::stringstream stream(value);
+            std::string type;
+            while (std::getline(stream, type, ','))
+                options.sessionTypes.push_back((HoudiniEngineManager::SessionType)std::atoi(type.c_str()));
+        }
+        else if (arg == "--min-size")
+            options.minBytes = std::max(1LL, std::atoll(value.c_str()));
+        else if (arg == "--max-size")
+            options.maxBytes = std::atoll(value.c_str());
+        else if (arg == "--latency-calls")
+            options.latencyCalls = std::max(1, std::atoi(value.c_str()));
+        else if (arg == "--mesh-min-points")
+            options.meshMinPoints = std::max(4, std::atoi(value.c_str()));
+        else if (arg == "--mesh-max-points")
+            options.meshMaxPoints = std::atoi(value.c_str());
+        else if (arg == "--format")
+            options.format = value;
+        else if (arg == "--output")
+            options.outputPath = value;
+        else if (arg == "--shm-buffer")
+        {
+            if (!HoudiniEngineManager::parseSharedMemoryBufferType(value, options.sharedMemoryBufferType))
+            {
+                printUsage();
+                return 1;
+            }
+        }
+        else if (arg == "--shm-buffer-size")
+            options.sharedMemoryBufferSize = std::max(1LL, std::atoll(value.c_str()));
+        else if (arg == "--libhapil")
+            options.library.path = value;
+        else
+        {
+            printUsage();
+            return 1;
+        }
+    }
+
+    // An in-process session cannot be restarted once shut down, so it runs last
+    if (options.sessionTypes.empty())
+        options.sessionTypes = {
+            HoudiniEngineManager::NewSharedMemory,
+            HoudiniEngineManager::NewNamedPipe,
+            HoudiniEngineManager::NewTCPSocket,
+            HoudiniEngineManager::InProcess };
+
+    auto load_start = std::chrono::steady_clock::now();
+    void* libHAPIL = HoudiniEnginePlatform::LoadLibHAPIL(options.library);
+    if (libHAPIL != nullptr)
+        HoudiniApi::InitializeHAPI(libHAPIL);
+
+    if (!HoudiniApi::IsHAPIInitialized())
+    {
+        std::cerr << "Failed to load and initialize the "
+                     "Houdini Engine API from libHAPIL." << std::endl;
+        return 1;
+    }
+
+    std::cout << "libHAPIL ready in "
+              << std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - load_start).count()
+              << " ms (load " << HoudiniEnginePlatform::GetLibHAPILLoadMilliseconds() << " ms)" << std::endl;
+
+    bool success = true;
+    std::vector<BenchmarkResult> results;
+    if (options.checkFailover)
+    {
+        for (HoudiniEngineManager::SessionType session_type : options.sessionTypes)
+        {
+            if (session_type != HoudiniEngineManager::InProcess)
+                success &= checkFailover(session_type, options);
+        }
+
+        HoudiniApi::FinalizeHAPI();
+        HoudiniEnginePlatform::FreeLibHAPIL(libHAPIL);
+        return success ? 0 : 1;
+    }
+
+    for (HoudiniEngineManager::SessionType session_type : options.sessionTypes)
+        success &= benchmarkSessionType(session_type, options, results);
+
+    if (options.outputPath.empty())
+    {
+        std::cout << std::endl;
+        writeReport(std::cout, options.format, results);
+    }
+    else
+    {
+        std::ofstream report(options.outputPath);
+        writeReport(report, options.format, results);
+        std::cout << "\nReport written to " << options.outputPath << std::endl;
+    }
+
+    HoudiniApi::FinalizeHAPI();
+    HoudiniEnginePlatform::FreeLibHAPIL(libHAPIL);
+
+    return success ? 0 : 1;
+}
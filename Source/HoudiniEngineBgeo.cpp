@@ -0,0 +1,1390 @@
+/*
+* Copyright (c) <2023> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "HoudiniEngineBgeo.h"
+#include "HoudiniEngineUtility.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <map>
+#include <unordered_map>
+
+// Binary JSON token ids (UT_JSON)
+static const unsigned char BJSON_NULL = 0x00;
+static const unsigned char BJSON_MAP_BEGIN = 0x7b;
+static const unsigned char BJSON_MAP_END = 0x7d;
+static const unsigned char BJSON_ARRAY_BEGIN = 0x5b;
+static const unsigned char BJSON_ARRAY_END = 0x5d;
+static const unsigned char BJSON_BOOL = 0x10;
+static const unsigned char BJSON_INT8 = 0x11;
+static const unsigned char BJSON_INT16 = 0x12;
+static const unsigned char BJSON_INT32 = 0x13;
+static const unsigned char BJSON_INT64 = 0x14;
+static const unsigned char BJSON_REAL16 = 0x18;
+static const unsigned char BJSON_REAL32 = 0x19;
+static const unsigned char BJSON_REAL64 = 0x1a;
+static const unsigned char BJSON_UINT8 = 0x21;
+static const unsigned char BJSON_UINT16 = 0x22;
+static const unsigned char BJSON_STRING = 0x27;
+static const unsigned char BJSON_FALSE = 0x30;
+static const unsigned char BJSON_TRUE = 0x31;
+static const unsigned char BJSON_TOKENDEF = 0x2b;
+static const unsigned char BJSON_TOKENREF = 0x26;
+static const unsigned char BJSON_TOKENUNDEF = 0x2d;
+static const unsigned char BJSON_UNIFORM_ARRAY = 0x40;
+static const unsigned char BJSON_MAGIC = 0x7f;
+
+// Written after BJSON_MAGIC in the byte order of the writer
+static const uint32_t BJSON_MAGIC_NUMBER = 0x624a534e;
+static const uint32_t BJSON_MAGIC_NUMBER_SWAPPED = 0x4e534a62;
+
+// Nesting deeper than this is treated as a corrupt buffer
+static const int BJSON_MAX_DEPTH = 256;
+
+// Numeric arrays shorter than this are converted on the calling thread
+static const int64_t BGEO_MIN_VALUES_PER_TASK = 256 * 1024;
+
+// Page size of attribute data written by encode
+static const int BGEO_PAGE_SIZE = 1024;
+
+// A parsed binary JSON value. Uniform arrays are not copied: they point into the decoded buffer.
+struct BJsonValue
+{
+    enum Type { NullType, BoolType, IntType, RealType, StringType, ArrayType, MapType, UniformType };
+
+    Type type = NullType;
+    bool boolean = false;
+    int64_t integer = 0;
+    double real = 0.0;
+    std::string string;
+
+    // Elements of an array, or values of a map
+    std::vector<BJsonValue> children;
+    std::vector<std::string> keys;
+
+    unsigned char uniformId = BJSON_NULL;
+    int64_t uniformCount = 0;
+    const char* uniformData = nullptr;
+
+    bool isNumber() const { return type == IntType || type == RealType || type == BoolType; }
+
+    bool isArray() const { return type == ArrayType || type == UniformType; }
+
+    double number() const
+    {
+        return type == RealType ? real : type == BoolType ? (boolean ? 1.0 : 0.0) : (double)integer;
+    }
+
+    int64_t size() const { return type == UniformType ? uniformCount : (int64_t)children.size(); }
+
+    // Value of a key in a map, or in an array of alternating keys and values as used by .geo
+    const BJsonValue* get(const char* key) const
+    {
+        if (type == MapType)
+        {
+            for (size_t i = 0; i < keys.size(); ++i)
+            {
+                if (keys[i] == key)
+                    return &children[i];
+            }
+        }
+        else if (type == ArrayType)
+        {
+            for (size_t i = 0; i + 1 < children.size(); i += 2)
+            {
+                if (children[i].type == StringType && children[i].string == key)
+                    return &children[i + 1];
+            }
+        }
+        return nullptr;
+    }
+};
+
+static int
+uniformElementSize(unsigned char id)
+{
+    switch (id)
+    {
+        case BJSON_INT8: case BJSON_UINT8: return 1;
+        case BJSON_INT16: case BJSON_UINT16: case BJSON_REAL16: return 2;
+        case BJSON_INT32: case BJSON_REAL32: return 4;
+        case BJSON_INT64: case BJSON_REAL64: return 8;
+        default: return 0;
+    }
+}
+
+static float
+halfToFloat(uint16_t half)
+{
+    const uint32_t sign = (uint32_t)(half & 0x8000) << 16;
+    const uint32_t exponent = (half >> 10) & 0x1f;
+    const uint32_t mantissa = half & 0x3ff;
+
+    uint32_t bits;
+    if (exponent == 0)
+    {
+        // Zero or subnormal
+        float value = std::ldexp((float)mantissa, -24);
+        return sign ? -value : value;
+    }
+    else if (exponent == 31)
+        bits = sign | 0x7f800000 | (mantissa << 13);
+    else
+        bits = sign | ((exponent + 112) << 23) | (mantissa << 13);
+
+    float value;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+// Single pass reader of a binary JSON buffer into BJsonValues
+class BJsonReader
+{
+public:
+    BJsonReader(const char* data, size_t size)
+        : myData(data), mySize(size), myPosition(0)
+    {
+    }
+
+    bool parse(BJsonValue& root, std::string& error)
+    {
+        unsigned char id = 0;
+        uint32_t magic = 0;
+        if (!readRaw(id) || id != BJSON_MAGIC || !readRaw(magic))
+        {
+            error = "Not a binary geometry buffer.";
+            return false;
+        }
+        if (magic != BJSON_MAGIC_NUMBER)
+        {
+            error = magic == BJSON_MAGIC_NUMBER_SWAPPED ?
+                "Byte-swapped binary geometry is not supported." : "Not a binary geometry buffer.";
+            return false;
+        }
+
+        if (!nextId(id) || !readValue(id, root, 0))
+        {
+            error = myError.empty() ? "Truncated binary geometry buffer." : myError;
+            return false;
+        }
+        return true;
+    }
+
+private:
+    template <typename T>
+    bool readRaw(T& value)
+    {
+        if (mySize - myPosition < sizeof(T))
+            return false;
+        std::memcpy(&value, myData + myPosition, sizeof(T));
+        myPosition += sizeof(T);
+        return true;
+    }
+
+    bool readLength(int64_t& length)
+    {
+        unsigned char prefix = 0;
+        if (!readRaw(prefix))
+            return false;
+
+        if (prefix < 0xf1)
+        {
+            length = prefix;
+            return true;
+        }
+
+        if (prefix == 0xf2)
+        {
+            uint16_t value = 0;
+            if (!readRaw(value))
+                return false;
+            length = value;
+        }
+        else if (prefix == 0xf4)
+        {
+            uint32_t value = 0;
+            if (!readRaw(value))
+                return false;
+            length = value;
+        }
+        else if (prefix == 0xf8)
+        {
+            if (!readRaw(length))
+                return false;
+        }
+        else
+        {
+            myError = "Invalid length in binary geometry buffer.";
+            return false;
+        }
+
+        if (length < 0)
+        {
+            myError = "Invalid length in binary geometry buffer.";
+            return false;
+        }
+        return true;
+    }
+
+    bool readString(std::string& value)
+    {
+        int64_t length = 0;
+        if (!readLength(length) || (uint64_t)length > mySize - myPosition)
+            return false;
+        value.assign(myData + myPosition, (size_t)length);
+        myPosition += (size_t)length;
+        return true;
+    }
+
+    // Read the next id, applying token definitions on the way
+    bool nextId(unsigned char& id)
+    {
+        while (readRaw(id))
+        {
+            if (id == BJSON_TOKENDEF)
+            {
+                int64_t token = 0;
+                std::string value;
+                if (!readLength(token) || !readString(value))
+                    return false;
+                myTokens[token] = value;
+            }
+            else if (id == BJSON_TOKENUNDEF)
+            {
+                int64_t token = 0;
+                if (!readLength(token))
+                    return false;
+                myTokens.erase(token);
+            }
+            else
+                return true;
+        }
+        return false;
+    }
+
+    bool readToken(std::string& value)
+    {
+        int64_t token = 0;
+        if (!readLength(token))
+            return false;
+
+        auto found = myTokens.find(token);
+        if (found == myTokens.end())
+        {
+            myError = "Undefined token in binary geometry buffer.";
+            return false;
+        }
+        value = found->second;
+        return true;
+    }
+
+    bool readValue(unsigned char id, BJsonValue& value, int depth)
+    {
+        if (depth > BJSON_MAX_DEPTH)
+        {
+            myError = "Binary geometry buffer is nested too deeply.";
+            return false;
+        }
+
+        switch (id)
+        {
+            case BJSON_NULL:
+                value.type = BJsonValue::NullType;
+                return true;
+            case BJSON_FALSE:
+            case BJSON_TRUE:
+                value.type = BJsonValue::BoolType;
+                value.boolean = id == BJSON_TRUE;
+                return true;
+            case BJSON_BOOL:
+            {
+                unsigned char flag = 0;
+                value.type = BJsonValue::BoolType;
+                if (!readRaw(flag))
+                    return false;
+                value.boolean = flag != 0;
+                return true;
+            }
+            case BJSON_INT8: { int8_t v = 0; value.type = BJsonValue::IntType; if (!readRaw(v)) return false; value.integer = v; return true; }
+            case BJSON_INT16: { int16_t v = 0; value.type = BJsonValue::IntType; if (!readRaw(v)) return false; value.integer = v; return true; }
+            case BJSON_INT32: { int32_t v = 0; value.type = BJsonValue::IntType; if (!readRaw(v)) return false; value.integer = v; return true; }
+            case BJSON_INT64: { int64_t v = 0; value.type = BJsonValue::IntType; if (!readRaw(v)) return false; value.integer = v; return true; }
+            case BJSON_UINT8: { uint8_t v = 0; value.type = BJsonValue::IntType; if (!readRaw(v)) return false; value.integer = v; return true; }
+            case BJSON_UINT16: { uint16_t v = 0; value.type = BJsonValue::IntType; if (!readRaw(v)) return false; value.integer = v; return true; }
+            case BJSON_REAL16: { uint16_t v = 0; value.type = BJsonValue::RealType; if (!readRaw(v)) return false; value.real = halfToFloat(v); return true; }
+            case BJSON_REAL32: { float v = 0; value.type = BJsonValue::RealType; if (!readRaw(v)) return false; value.real = v; return true; }
+            case BJSON_REAL64: { double v = 0; value.type = BJsonValue::RealType; if (!readRaw(v)) return false; value.real = v; return true; }
+            case BJSON_STRING:
+                value.type = BJsonValue::StringType;
+                return readString(value.string);
+            case BJSON_TOKENREF:
+                value.type = BJsonValue::StringType;
+                return readToken(value.string);
+            case BJSON_ARRAY_BEGIN:
+            {
+                value.type = BJsonValue::ArrayType;
+                unsigned char child_id = 0;
+                while (nextId(child_id))
+                {
+                    if (child_id == BJSON_ARRAY_END)
+                        return true;
+                    value.children.emplace_back();
+                    if (!readValue(child_id, value.children.back(), depth + 1))
+                        return false;
+                }
+                return false;
+            }
+            case BJSON_MAP_BEGIN:
+            {
+                value.type = BJsonValue::MapType;
+                unsigned char child_id = 0;
+                while (nextId(child_id))
+                {
+                    if (child_id == BJSON_MAP_END)
+                        return true;
+
+                    value.keys.emplace_back();
+                    if (child_id == BJSON_STRING)
+                    {
+                        if (!readString(value.keys.back()))
+                            return false;
+                    }
+                    else if (child_id == BJSON_TOKENREF)
+                    {
+                        if (!readToken(value.keys.back()))
+                            return false;
+                    }
+                    else
+                    {
+                        myError = "Invalid map key in binary geometry buffer.";
+                        return false;
+                    }
+
+                    value.children.emplace_back();
+                    if (!nextId(child_id) || !readValue(child_id, value.children.back(), depth + 1))
+                        return false;
+                }
+                return false;
+            }
+            case BJSON_UNIFORM_ARRAY:
+            {
+                value.type = BJsonValue::UniformType;
+                if (!readRaw(value.uniformId) || !readLength(value.uniformCount))
+                    return false;
+
+                uint64_t bytes;
+                if (value.uniformId == BJSON_BOOL)
+                    bytes = ((uint64_t)value.uniformCount + 31) / 32 * 4;
+                else
+                {
+                    const int element_size = uniformElementSize(value.uniformId);
+                    if (element_size == 0)
+                    {
+                        myError = "Unsupported uniform array type in binary geometry buffer.";
+                        return false;
+                    }
+                    if ((uint64_t)value.uniformCount > (mySize - myPosition) / element_size)
+                        return false;
+                    bytes = (uint64_t)value.uniformCount * element_size;
+                }
+
+                if (bytes > mySize - myPosition)
+                    return false;
+                value.uniformData = myData + myPosition;
+                myPosition += (size_t)bytes;
+                return true;
+            }
+            default:
+                myError = "Invalid token in binary geometry buffer.";
+                return false;
+        }
+    }
+
+    const char* myData;
+    size_t mySize;
+    size_t myPosition;
+    std::unordered_map<int64_t, std::string> myTokens;
+    std::string myError;
+};
+
+// Split across threads with at least BGEO_MIN_VALUES_PER_TASK values per task by default
+template <typename Func>
+static void
+parallelFor(int64_t count, const Func& func, int64_t min_per_task = BGEO_MIN_VALUES_PER_TASK)
+{
+    HoudiniEngineUtility::parallelFor(count, func, min_per_task);
+}
+
+template <typename In, typename Out>
+static void
+copyUniformRows(const char* data, int64_t first, int64_t rows, int width, Out* out, int stride)
+{
+    const char* source = data + first * (int64_t)sizeof(In);
+    for (int64_t row = 0; row < rows; ++row)
+    {
+        for (int component = 0; component < width; ++component)
+        {
+            In value;
+            std::memcpy(&value, source, sizeof(In));
+            source += sizeof(In);
+            out[row * stride + component] = (Out)value;
+        }
+    }
+}
+
+// Copy rows of width values, starting at value first of an array, into out rows stride apart.
+// The caller checks that the array holds first + rows * width values.
+template <typename Out>
+static void
+copyRows(const BJsonValue& array, int64_t first, int64_t rows, int width, Out* out, int stride)
+{
+    if (array.type == BJsonValue::ArrayType)
+    {
+        for (int64_t row = 0; row < rows; ++row)
+        {
+            for (int component = 0; component < width; ++component)
+                out[row * stride + component] = (Out)array.children[first + row * width + component].number();
+        }
+        return;
+    }
+
+    const char* data = array.uniformData;
+    switch (array.uniformId)
+    {
+        case BJSON_INT8: copyUniformRows<int8_t>(data, first, rows, width, out, stride); break;
+        case BJSON_INT16: copyUniformRows<int16_t>(data, first, rows, width, out, stride); break;
+        case BJSON_INT32: copyUniformRows<int32_t>(data, first, rows, width, out, stride); break;
+        case BJSON_INT64: copyUniformRows<int64_t>(data, first, rows, width, out, stride); break;
+        case BJSON_UINT8: copyUniformRows<uint8_t>(data, first, rows, width, out, stride); break;
+        case BJSON_UINT16: copyUniformRows<uint16_t>(data, first, rows, width, out, stride); break;
+        case BJSON_REAL32: copyUniformRows<float>(data, first, rows, width, out, stride); break;
+        case BJSON_REAL64: copyUniformRows<double>(data, first, rows, width, out, stride); break;
+        case BJSON_REAL16:
+        {
+            const char* source = data + first * 2;
+            for (int64_t row = 0; row < rows; ++row)
+            {
+                for (int component = 0; component < width; ++component)
+                {
+                    uint16_t half;
+                    std::memcpy(&half, source, sizeof(half));
+                    source += sizeof(half);
+                    out[row * stride + component] = (Out)halfToFloat(half);
+                }
+            }
+            break;
+        }
+        case BJSON_BOOL:
+        {
+            for (int64_t row = 0; row < rows; ++row)
+            {
+                for (int component = 0; component < width; ++component)
+                {
+                    const int64_t index = first + row * width + component;
+                    uint32_t word;
+                    std::memcpy(&word, data + (index / 32) * 4, sizeof(word));
+                    out[row * stride + component] = (Out)((word >> (index % 32)) & 1);
+                }
+            }
+            break;
+        }
+    }
+}
+
+// An array holding only numbers
+static bool
+isNumberArray(const BJsonValue* array)
+{
+    if (!array || !array->isArray())
+        return false;
+    if (array->type == BJsonValue::UniformType)
+        return true;
+    for (const BJsonValue& child : array->children)
+    {
+        if (!child.isNumber())
+            return false;
+    }
+    return true;
+}
+
+static int64_t
+getInteger(const BJsonValue* value, int64_t default_value)
+{
+    return value && value->isNumber() ? (int64_t)value->number() : default_value;
+}
+
+// Copy a whole array of numbers, in parallel when it is large
+template <typename Out>
+static bool
+readArray(const BJsonValue* array, int64_t count, Out* out)
+{
+    if (!isNumberArray(array) || array->size() != count)
+        return false;
+    parallelFor(count, [&](int64_t begin, int64_t end)
+    {
+        copyRows(*array, begin, end - begin, 1, out + begin, 1);
+    });
+    return true;
+}
+
+// Per page flags of constantpageflags, as numbers or as bits of a uniform bool array
+static bool
+readFlags(const BJsonValue& array, std::vector<char>& flags)
+{
+    if (!isNumberArray(&array))
+        return false;
+    flags.resize((size_t)array.size());
+    copyRows(array, 0, array.size(), 1, flags.data(), 1);
+    return true;
+}
+
+// Read count tuples of an attribute's "values" (or a string attribute's "indices") into out.
+// Handles the "tuples", "arrays" and paged "rawpagedata" layouts.
+template <typename Out>
+static bool
+readTuples(const BJsonValue& values, int tuple_size, int64_t count, Out* out, std::string& error)
+{
+    if (const BJsonValue* tuples = values.get("tuples"))
+    {
+        if (tuples->type == BJsonValue::UniformType || tuple_size == 1)
+        {
+            // Scalars may be stored as a flat array
+            if (isNumberArray(tuples) && tuples->size() == count * tuple_size)
+            {
+                parallelFor(count, [&](int64_t begin, int64_t end)
+                {
+                    copyRows(*tuples, begin * tuple_size, end - begin, tuple_size, out + begin * tuple_size, tuple_size);
+                });
+                return true;
+            }
+        }
+
+        if (tuples->type != BJsonValue::ArrayType || tuples->size() != count)
+        {
+            error = "Invalid attribute tuples.";
+            return false;
+        }
+        for (int64_t i = 0; i < count; ++i)
+        {
+            const BJsonValue& tuple = tuples->children[i];
+            if (!isNumberArray(&tuple) || tuple.size() != tuple_size)
+            {
+                error = "Invalid attribute tuple.";
+                return false;
+            }
+            copyRows(tuple, 0, 1, tuple_size, out + i * tuple_size, tuple_size);
+        }
+        return true;
+    }
+
+    if (const BJsonValue* arrays = values.get("arrays"))
+    {
+        // One array per component
+        if (arrays->type != BJsonValue::ArrayType || arrays->size() != tuple_size)
+        {
+            error = "Invalid attribute arrays.";
+            return false;
+        }
+        for (int component = 0; component < tuple_size; ++component)
+        {
+            const BJsonValue& array = arrays->children[component];
+            if (!isNumberArray(&array) || array.size() != count)
+            {
+                error = "Invalid attribute array.";
+                return false;
+            }
+            parallelFor(count, [&](int64_t begin, int64_t end)
+            {
+                copyRows(array, begin, end - begin, 1, out + begin * tuple_size + component, tuple_size);
+            });
+        }
+        return true;
+    }
+
+    const BJsonValue* data = values.get("rawpagedata");
+    if (!isNumberArray(data))
+    {
+        error = "Unsupported attribute value layout.";
+        return false;
+    }
+
+    const int64_t page_size = getInteger(values.get("pagesize"), 0);
+    if (page_size <= 0)
+    {
+        error = "Invalid attribute page size.";
+        return false;
+    }
+
+    // Components are stored in groups of the packing sizes, and a group can have a single
+    // tuple for a page whose values are all the same
+    std::vector<int> packing;
+    if (const BJsonValue* packing_value = values.get("packing"))
+    {
+        if (!isNumberArray(packing_value))
+        {
+            error = "Invalid attribute packing.";
+            return false;
+        }
+        packing.resize((size_t)packing_value->size());
+        copyRows(*packing_value, 0, packing_value->size(), 1, packing.data(), 1);
+    }
+    else
+        packing.push_back(tuple_size);
+
+    int packed_size = 0;
+    for (int group_size : packing)
+    {
+        if (group_size <= 0)
+        {
+            error = "Invalid attribute packing.";
+            return false;
+        }
+        packed_size += group_size;
+    }
+    if (packed_size != tuple_size)
+    {
+        error = "Invalid attribute packing.";
+        return false;
+    }
+
+    const int64_t page_count = (count + page_size - 1) / page_size;
+    std::vector<std::vector<char>> constant_pages(packing.size());
+    if (const BJsonValue* flags = values.get("constantpageflags"))
+    {
+        if (flags->type != BJsonValue::ArrayType || flags->size() != (int64_t)packing.size())
+        {
+            error = "Invalid attribute constant page flags.";
+            return false;
+        }
+        for (size_t group = 0; group < packing.size(); ++group)
+        {
+            if (!readFlags(flags->children[group], constant_pages[group]) ||
+                (!constant_pages[group].empty() && (int64_t)constant_pages[group].size() < page_count))
+            {
+                error = "Invalid attribute constant page flags.";
+                return false;
+            }
+        }
+    }
+
+    // Find where each page starts, and check that the data covers them all
+    std::vector<int64_t> page_offsets((size_t)page_count);
+    int64_t offset = 0;
+    for (int64_t page = 0; page < page_count; ++page)
+    {
+        page_offsets[page] = offset;
+        const int64_t page_elements = std::min(page_size, count - page * page_size);
+        for (size_t group = 0; group < packing.size(); ++group)
+        {
+            const bool constant = !constant_pages[group].empty() && constant_pages[group][page];
+            offset += (constant ? 1 : page_elements) * packing[group];
+        }
+    }
+    if (offset != data->size())
+    {
+        error = "Attribute page data does not match its element count.";
+        return false;
+    }
+
+    parallelFor(page_count, [&](int64_t begin, int64_t end)
+    {
+        for (int64_t page = begin; page < end; ++page)
+        {
+            const int64_t first_element = page * page_size;
+            const int64_t page_elements = std::min(page_size, count - first_element);
+            int64_t source = page_offsets[page];
+            int component = 0;
+            for (size_t group = 0; group < packing.size(); ++group)
+            {
+                Out* target = out + first_element * tuple_size + component;
+                if (!constant_pages[group].empty() && constant_pages[group][page])
+                {
+                    for (int64_t element = 0; element < page_elements; ++element)
+                        copyRows(*data, source, 1, packing[group], target + element * tuple_size, tuple_size);
+                    source += packing[group];
+                }
+                else
+                {
+                    copyRows(*data, source, page_elements, packing[group], target, tuple_size);
+                    source += page_elements * packing[group];
+                }
+                component += packing[group];
+            }
+        }
+    }, BGEO_MIN_VALUES_PER_TASK / (page_size * tuple_size));
+    return true;
+}
+
+// Append the vertices of the polygons of a primitive entry, as vertex numbers
+static bool
+appendPrimitives(const BJsonValue& primitive, std::vector<int>& face_counts,
+                 std::vector<int>& face_vertices, std::string& error)
+{
+    const BJsonValue* header = primitive.size() == 2 ? &primitive.children[0] : nullptr;
+    const BJsonValue* body = primitive.size() == 2 ? &primitive.children[1] : nullptr;
+    const BJsonValue* type = header ? header->get("type") : nullptr;
+    if (primitive.type != BJsonValue::ArrayType || !type || type->type != BJsonValue::StringType)
+    {
+        error = "Invalid primitive.";
+        return false;
+    }
+
+    auto appendPolygon = [&](const BJsonValue* vertices)
+    {
+        if (!isNumberArray(vertices))
+            return false;
+        const int64_t count = vertices->size();
+        face_counts.push_back((int)count);
+        face_vertices.resize(face_vertices.size() + (size_t)count);
+        copyRows(*vertices, 0, count, 1, face_vertices.data() + face_vertices.size() - count, 1);
+        return true;
+    };
+
+    if (type->string == "Poly")
+    {
+        if (!appendPolygon(body->get("vertex")))
+        {
+            error = "Invalid polygon.";
+            return false;
+        }
+        return true;
+    }
+
+    if (type->string == "Polygon_run")
+    {
+        // Polygons using consecutive vertices from startvertex
+        const int64_t start_vertex = getInteger(body->get("startvertex"), -1);
+        const int64_t polygon_count = getInteger(body->get("nprimitives"), -1);
+        std::vector<int> counts;
+        if (const BJsonValue* rle = body->get("nvertices_rle"))
+        {
+            // Pairs of vertex count and number of polygons
+            std::vector<int64_t> pairs((size_t)rle->size());
+            if (!isNumberArray(rle) || pairs.size() % 2 != 0)
+            {
+                error = "Invalid polygon run.";
+                return false;
+            }
+            copyRows(*rle, 0, rle->size(), 1, pairs.data(), 1);
+            for (size_t i = 0; i < pairs.size(); i += 2)
+            {
+                if (pairs[i + 1] < 0 || (int64_t)counts.size() + pairs[i + 1] > polygon_count)
+                {
+                    error = "Invalid polygon run.";
+                    return false;
+                }
+                counts.insert(counts.end(), (size_t)pairs[i + 1], (int)pairs[i]);
+            }
+        }
+        else if (const BJsonValue* nvertices = body->get("nvertices"))
+        {
+            if (!isNumberArray(nvertices) || nvertices->size() != polygon_count)
+            {
+                error = "Invalid polygon run.";
+                return false;
+            }
+            counts.resize((size_t)polygon_count);
+            copyRows(*nvertices, 0, polygon_count, 1, counts.data(), 1);
+        }
+
+        if (start_vertex < 0 || polygon_count < 0 || (int64_t)counts.size() != polygon_count)
+        {
+            error = "Invalid polygon run.";
+            return false;
+        }
+
+        int64_t vertex = start_vertex;
+        for (int count : counts)
+        {
+            if (count < 0)
+            {
+                error = "Invalid polygon run.";
+                return false;
+            }
+            face_counts.push_back(count);
+            for (int i = 0; i < count; ++i)
+                face_vertices.push_back((int)vertex++);
+        }
+        return true;
+    }
+
+    if (type->string == "run")
+    {
+        // Primitives of runtype sharing their uniform fields, with a list of varying fields each
+        const BJsonValue* run_type = header->get("runtype");
+        const BJsonValue* varying = header->get("varyingfields");
+        if (!run_type || run_type->string != "Poly")
+        {
+            error = "Unsupported primitive run type " + (run_type ? run_type->string : std::string()) + ".";
+            return false;
+        }
+
+        int vertex_field = -1;
+        for (int64_t i = 0; varying && varying->type == BJsonValue::ArrayType && i < varying->size(); ++i)
+        {
+            if (varying->children[i].string == "vertex")
+                vertex_field = (int)i;
+        }
+        if (vertex_field < 0 || body->type != BJsonValue::ArrayType)
+        {
+            error = "Invalid polygon run.";
+            return false;
+        }
+
+        for (const BJsonValue& fields : body->children)
+        {
+            if (fields.type != BJsonValue::ArrayType || fields.size() <= vertex_field ||
+                !appendPolygon(&fields.children[vertex_field]))
+            {
+                error = "Invalid polygon run.";
+                return false;
+            }
+        }
+        return true;
+    }
+
+    error = "Unsupported primitive type " + type->string + ".";
+    return false;
+}
+
+// Read the point, vertex or primitive attributes of a section into the mesh. Vertex attributes
+// are reordered from vertex numbers to face traversal order.
+static bool
+readAttributes(const BJsonValue* section, HAPI_AttributeOwner owner, int64_t count,
+               const std::vector<int>& face_vertices, HoudiniEngineMesh& mesh, std::string& error)
+{
+    if (!section)
+        return true;
+    if (section->type != BJsonValue::ArrayType)
+    {
+        error = "Invalid attribute list.";
+        return false;
+    }
+
+    for (const BJsonValue& entry : section->children)
+    {
+        const BJsonValue* header = entry.size() == 2 ? &entry.children[0] : nullptr;
+        const BJsonValue* body = entry.size() == 2 ? &entry.children[1] : nullptr;
+        const BJsonValue* name = header ? header->get("name") : nullptr;
+        const BJsonValue* type = header ? header->get("type") : nullptr;
+        if (entry.type != BJsonValue::ArrayType || !name || !type)
+        {
+            error = "Invalid attribute.";
+            return false;
+        }
+
+        HoudiniEngineMeshAttribute attribute;
+        attribute.name = name->string;
+        attribute.owner = owner;
+
+        // Values indexed by vertex number, remapped below for vertex attributes
+        std::vector<float> values;
+        std::vector<int> int_values;
+        std::vector<int> indices;
+        if (type->string == "numeric")
+        {
+            const BJsonValue* data = body->get("values");
+            if (!data)
+            {
+                error = "Attribute " + attribute.name + " has no values.";
+                return false;
+            }
+            attribute.tupleSize = (int)getInteger(data->get("size"), getInteger(body->get("size"), 1));
+            if (attribute.tupleSize <= 0)
+            {
+                error = "Attribute " + attribute.name + " has an invalid size.";
+                return false;
+            }
+
+            // Integers up to 32 bits are kept as integers; 64 bit ones are skipped, as by
+            // HoudiniEngineGeometry::readMeshFromHoudini
+            const BJsonValue* storage = data->get("storage");
+            if (!storage)
+                storage = body->get("storage");
+            const std::string storage_name = storage && storage->type == BJsonValue::StringType ? storage->string : "";
+            if (storage_name == "int64" || storage_name == "uint64")
+                continue;
+            attribute.isInt = storage_name.compare(0, 3, "int") == 0 || storage_name.compare(0, 4, "uint") == 0;
+
+            if (attribute.isInt)
+            {
+                int_values.resize((size_t)(count * attribute.tupleSize));
+                if (!readTuples(*data, attribute.tupleSize, count, int_values.data(), error))
+                    return false;
+            }
+            else
+            {
+                values.resize((size_t)(count * attribute.tupleSize));
+                if (!readTuples(*data, attribute.tupleSize, count, values.data(), error))
+                    return false;
+            }
+        }
+        else if (type->string == "string")
+        {
+            const BJsonValue* strings = body->get("strings");
+            const BJsonValue* data = body->get("indices");
+            if (!strings || strings->type != BJsonValue::ArrayType || !data)
+            {
+                error = "Attribute " + attribute.name + " has no strings.";
+                return false;
+            }
+            attribute.isString = true;
+            for (const BJsonValue& string : strings->children)
+                attribute.strings.push_back(string.string);
+
+            indices.resize((size_t)count);
+            if (!readTuples(*data, 1, count, indices.data(), error))
+                return false;
+            for (int index : indices)
+            {
+                if (index < -1 || index >= (int)attribute.strings.size())
+                {
+                    error = "Attribute " + attribute.name + " has an invalid string index.";
+                    return false;
+                }
+            }
+        }
+        else
+        {
+            // Groups, dictionaries and array attributes are not represented in the mesh
+            continue;
+        }
+
+        if (owner == HAPI_ATTROWNER_VERTEX)
+        {
+            const int tuple_size = attribute.tupleSize;
+            const int64_t traversal_count = (int64_t)face_vertices.size();
+            if (attribute.isString)
+                attribute.indices.resize((size_t)traversal_count);
+            else if (attribute.isInt)
+                attribute.intValues.resize((size_t)(traversal_count * tuple_size));
+            else
+                attribute.values.resize((size_t)(traversal_count * tuple_size));
+            parallelFor(traversal_count, [&](int64_t begin, int64_t end)
+            {
+                for (int64_t i = begin; i < end; ++i)
+                {
+                    const int64_t vertex = face_vertices[i];
+                    if (attribute.isString)
+                        attribute.indices[i] = indices[vertex];
+                    else if (attribute.isInt)
+                        std::copy(int_values.begin() + vertex * tuple_size, int_values.begin() + (vertex + 1) * tuple_size,
+                                  attribute.intValues.begin() + i * tuple_size);
+                    else
+                        std::copy(values.begin() + vertex * tuple_size, values.begin() + (vertex + 1) * tuple_size,
+                                  attribute.values.begin() + i * tuple_size);
+                }
+            });
+        }
+        else
+        {
+            attribute.values.swap(values);
+            attribute.intValues.swap(int_values);
+            attribute.indices.swap(indices);
+        }
+        mesh.attributes.push_back(std::move(attribute));
+    }
+    return true;
+}
+
+bool
+HoudiniEngineBgeo::decode(const char* data, size_t size, HoudiniEngineMesh& mesh, std::string& error)
+{
+    mesh = HoudiniEngineMesh();
+
+    if (size >= 2 && (unsigned char)data[0] == 0x1f && (unsigned char)data[1] == 0x8b)
+    {
+        error = "Compressed (.bgeo.gz) geometry is not supported.";
+        return false;
+    }
+
+    BJsonValue root;
+    BJsonReader reader(data, size);
+    if (!reader.parse(root, error))
+        return false;
+
+    const int64_t point_count = getInteger(root.get("pointcount"), -1);
+    const int64_t vertex_count = getInteger(root.get("vertexcount"), -1);
+    const int64_t primitive_count = getInteger(root.get("primitivecount"), -1);
+    if (point_count < 0 || vertex_count < 0 || primitive_count < 0 ||
+        point_count > INT32_MAX || vertex_count > INT32_MAX || primitive_count > INT32_MAX)
+    {
+        error = "Invalid element counts.";
+        return false;
+    }
+    mesh.pointCount = (int)point_count;
+
+    // Point of each vertex number
+    std::vector<int> point_refs((size_t)vertex_count);
+    const BJsonValue* topology = root.get("topology");
+    const BJsonValue* point_ref = topology ? topology->get("pointref") : nullptr;
+    if (vertex_count > 0 && !readArray(point_ref ? point_ref->get("indices") : nullptr, vertex_count, point_refs.data()))
+    {
+        error = "Invalid topology.";
+        return false;
+    }
+
+    // Vertex numbers of each face, in traversal order
+    std::vector<int> face_vertices;
+    face_vertices.reserve((size_t)vertex_count);
+    if (const BJsonValue* primitives = root.get("primitives"))
+    {
+        if (primitives->type != BJsonValue::ArrayType)
+        {
+            error = "Invalid primitives.";
+            return false;
+        }
+        for (const BJsonValue& primitive : primitives->children)
+        {
+            if (!appendPrimitives(primitive, mesh.faceCounts, face_vertices, error))
+                return false;
+        }
+    }
+    if ((int64_t)mesh.faceCounts.size() != primitive_count)
+    {
+        error = "Primitive count does not match the primitives.";
+        return false;
+    }
+
+    bool valid = true;
+    for (int vertex : face_vertices)
+    {
+        if (vertex < 0 || vertex >= vertex_count || point_refs[vertex] < 0 || point_refs[vertex] >= point_count)
+            valid = false;
+    }
+    if (!valid)
+    {
+        error = "Invalid vertex or point reference.";
+        return false;
+    }
+
+    mesh.vertexList.resize(face_vertices.size());
+    parallelFor((int64_t)face_vertices.size(), [&](int64_t begin, int64_t end)
+    {
+        for (int64_t i = begin; i < end; ++i)
+            mesh.vertexList[i] = point_refs[face_vertices[i]];
+    });
+
+    if (const BJsonValue* attributes = root.get("attributes"))
+    {
+        if (!readAttributes(attributes->get("pointattributes"), HAPI_ATTROWNER_POINT, point_count,
+                            face_vertices, mesh, error) ||
+            !readAttributes(attributes->get("vertexattributes"), HAPI_ATTROWNER_VERTEX, vertex_count,
+                            face_vertices, mesh, error) ||
+            !readAttributes(attributes->get("primitiveattributes"), HAPI_ATTROWNER_PRIM, primitive_count,
+                            face_vertices, mesh, error))
+            return false;
+    }
+    return true;
+}
+
+// Writer of binary JSON, defining a token for each distinct key
+class BJsonWriter
+{
+public:
+    explicit BJsonWriter(std::vector<char>& data)
+        : myData(data)
+    {
+    }
+
+    void magic()
+    {
+        put(BJSON_MAGIC);
+        putRaw(BJSON_MAGIC_NUMBER);
+    }
+
+    void beginArray() { put(BJSON_ARRAY_BEGIN); }
+    void endArray() { put(BJSON_ARRAY_END); }
+    void beginMap() { put(BJSON_MAP_BEGIN); }
+    void endMap() { put(BJSON_MAP_END); }
+
+    void key(const char* value)
+    {
+        auto found = myTokens.find(value);
+        if (found == myTokens.end())
+        {
+            found = myTokens.emplace(value, (int64_t)myTokens.size()).first;
+            put(BJSON_TOKENDEF);
+            length(found->second);
+            putString(value);
+        }
+        put(BJSON_TOKENREF);
+        length(found->second);
+    }
+
+    void string(const std::string& value)
+    {
+        put(BJSON_STRING);
+        putString(value);
+    }
+
+    void boolean(bool value) { put(value ? BJSON_TRUE : BJSON_FALSE); }
+
+    void integer(int64_t value)
+    {
+        if (value >= INT8_MIN && value <= INT8_MAX)
+        {
+            put(BJSON_INT8);
+            putRaw((int8_t)value);
+        }
+        else if (value >= INT32_MIN && value <= INT32_MAX)
+        {
+            put(BJSON_INT32);
+            putRaw((int32_t)value);
+        }
+        else
+        {
+            put(BJSON_INT64);
+            putRaw(value);
+        }
+    }
+
+    template <typename T>
+    void uniform(unsigned char id, const T* values, size_t count)
+    {
+        put(BJSON_UNIFORM_ARRAY);
+        put(id);
+        length((int64_t)count);
+        const size_t offset = myData.size();
+        myData.resize(offset + count * sizeof(T));
+        if (count > 0)
+            std::memcpy(myData.data() + offset, values, count * sizeof(T));
+    }
+
+private:
+    void put(unsigned char id) { myData.push_back((char)id); }
+
+    template <typename T>
+    void putRaw(T value)
+    {
+        const char* bytes = reinterpret_cast<const char*>(&value);
+        myData.insert(myData.end(), bytes, bytes + sizeof(T));
+    }
+
+    void length(int64_t value)
+    {
+        if (value < 0xf1)
+            put((unsigned char)value);
+        else if (value <= UINT16_MAX)
+        {
+            put(0xf2);
+            putRaw((uint16_t)value);
+        }
+        else if (value <= UINT32_MAX)
+        {
+            put(0xf4);
+            putRaw((uint32_t)value);
+        }
+        else
+        {
+            put(0xf8);
+            putRaw(value);
+        }
+    }
+
+    void putString(const std::string& value)
+    {
+        length((int64_t)value.size());
+        myData.insert(myData.end(), value.begin(), value.end());
+    }
+
+    std::vector<char>& myData;
+    std::map<std::string, int64_t> myTokens;
+};
+
+// Write the "values" of a numeric attribute, or the "indices" of a string one, as a single
+// group of paged raw data without constant pages
+template <typename T>
+static void
+writePagedData(BJsonWriter& writer, int tuple_size, const char* storage, unsigned char id, const std::vector<T>& data)
+{
+    writer.beginArray();
+    writer.key("size");
+    writer.integer(tuple_size);
+    writer.key("storage");
+    writer.string(storage);
+    writer.key("pagesize");
+    writer.integer(BGEO_PAGE_SIZE);
+    writer.key("packing");
+    writer.beginArray();
+    writer.integer(tuple_size);
+    writer.endArray();
+    writer.key("constantpageflags");
+    writer.beginArray();
+    writer.beginArray();
+    writer.endArray();
+    writer.endArray();
+    writer.key("rawpagedata");
+    writer.uniform(id, data.data(), data.size());
+    writer.endArray();
+}
+
+static void
+writeAttributes(BJsonWriter& writer, const char* section, HAPI_AttributeOwner owner, const HoudiniEngineMesh& mesh)
+{
+    bool any = false;
+    for (const HoudiniEngineMeshAttribute& attribute : mesh.attributes)
+        any = any || attribute.owner == owner;
+    if (!any)
+        return;
+
+    writer.key(section);
+    writer.beginArray();
+    for (const HoudiniEngineMeshAttribute& attribute : mesh.attributes)
+    {
+        if (attribute.owner != owner)
+            continue;
+
+        writer.beginArray();
+
+        writer.beginArray();
+        writer.key("scope");
+        writer.string("public");
+        writer.key("type");
+        writer.string(attribute.isString ? "string" : "numeric");
+        writer.key("name");
+        writer.string(attribute.name);
+        writer.endArray();
+
+        writer.beginArray();
+        if (attribute.isString)
+        {
+            writer.key("size");
+            writer.integer(1);
+            writer.key("storage");
+            writer.string("int32");
+            writer.key("strings");
+            writer.beginArray();
+            for (const std::string& string : attribute.strings)
+                writer.string(string);
+            writer.endArray();
+            writer.key("indices");
+            writePagedData(writer, 1, "int32", BJSON_INT32, attribute.indices);
+        }
+        else if (attribute.isInt)
+        {
+            writer.key("size");
+            writer.integer(attribute.tupleSize);
+            writer.key("storage");
+            writer.string("int32");
+            writer.key("values");
+            writePagedData(writer, attribute.tupleSize, "int32", BJSON_INT32, attribute.intValues);
+        }
+        else
+        {
+            writer.key("size");
+            writer.integer(attribute.tupleSize);
+            writer.key("storage");
+            writer.string("fpreal32");
+            writer.key("values");
+            writePagedData(writer, attribute.tupleSize, "fpreal32", BJSON_REAL32, attribute.values);
+        }
+        writer.endArray();
+
+        writer.endArray();
+    }
+    writer.endArray();
+}
+
+void
+HoudiniEngineBgeo::encode(const HoudiniEngineMesh& mesh, std::vector<char>& data)
+{
+    size_t reserve = 1024 + (mesh.faceCounts.size() + mesh.vertexList.size()) * sizeof(int);
+    for (const HoudiniEngineMeshAttribute& attribute : mesh.attributes)
+        reserve += attribute.values.size() * sizeof(float) + (attribute.intValues.size() + attribute.indices.size()) * sizeof(int);
+    data.clear();
+    data.reserve(reserve);
+
+    BJsonWriter writer(data);
+    writer.magic();
+    writer.beginArray();
+
+    writer.key("fileversion");
+    writer.string("20.0.0");
+    writer.key("hasindex");
+    writer.boolean(false);
+    writer.key("pointcount");
+    writer.integer(mesh.pointCount);
+    writer.key("vertexcount");
+    writer.integer((int64_t)mesh.vertexList.size());
+    writer.key("primitivecount");
+    writer.integer((int64_t)mesh.faceCounts.size());
+
+    // Vertices are numbered in face traversal order, so each vertex's point is the vertex list
+    writer.key("topology");
+    writer.beginArray();
+    writer.key("pointref");
+    writer.beginArray();
+    writer.key("indices");
+    writer.uniform(BJSON_INT32, mesh.vertexList.data(), mesh.vertexList.size());
+    writer.endArray();
+    writer.endArray();
+
+    writer.key("attributes");
+    writer.beginArray();
+    writeAttributes(writer, "vertexattributes", HAPI_ATTROWNER_VERTEX, mesh);
+    writeAttributes(writer, "pointattributes", HAPI_ATTROWNER_POINT, mesh);
+    writeAttributes(writer, "primitiveattributes", HAPI_ATTROWNER_PRIM, mesh);
+    writer.endArray();
+
+    // A single polygon run, with the vertex counts run length encoded
+    std::vector<int> runs;
+    for (int count : mesh.faceCounts)
+    {
+        if (!runs.empty() && runs[runs.size() - 2] == count)
+            ++runs.back();
+        else
+        {
+            runs.push_back(count);
+            runs.push_back(1);
+        }
+    }
+
+    writer.key("primitives");
+    writer.beginArray();
+    if (!mesh.faceCounts.empty())
+    {
+        writer.beginArray();
+        writer.beginArray();
+        writer.key("type");
+        writer.string("Polygon_run");
+        writer.endArray();
+        writer.beginArray();
+        writer.key("startvertex");
+        writer.integer(0);
+        writer.key("nprimitives");
+        writer.integer((int64_t)mesh.faceCounts.size());
+        writer.key("nvertices_rle");
+        writer.uniform(BJSON_INT32, runs.data(), runs.size());
+        writer.endArray();
+        writer.endArray();
+    }
+    writer.endArray();
+
+    writer.endArray();
+}
@@ -0,0 +1,51 @@
+/*
+* Copyright (c) <2023> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#pragma once
+
+#include "HoudiniEngineMesh.h"
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+// Reads and writes polygon meshes in Houdini's binary geometry format (.bgeo), which is the
+// .geo JSON schema stored as binary JSON.
+//
+// Decoding supports the point reference topology, Poly, Polygon_run and Poly run primitives,
+// and numeric and string point, vertex and primitive attributes stored as values, tuples,
+// arrays or paged raw data. Other primitive types are rejected and other attribute types are
+// skipped. Compressed variants (.bgeo.sc, .bgeo.gz) are not supported.
+struct HoudiniEngineBgeo
+{
+public:
+    // Decode a .bgeo buffer in a single pass, without copying its arrays. Large numeric
+    // arrays are then converted into the mesh on worker threads.
+    static bool decode(const char* data, size_t size, HoudiniEngineMesh& mesh, std::string& error);
+
+    // Encode a mesh as a .bgeo buffer, with every face in a single polygon run
+    static void encode(const HoudiniEngineMesh& mesh, std::vector<char>& data);
+};
@@ -25,56 +25,301 @@
 */
 
 #include "HoudiniApi.h"
+#include "HoudiniEngineBgeo.h"
 #include "HoudiniEngineGeometry.h"
+#include "HoudiniEngineMeshProcessing.h"
+#include "HoudiniEngineNodeGraph.h"
+#include "HoudiniEngineTrace.h"
 #include "HoudiniEngineUtility.h"
 
+#include <algorithm>
+#include <chrono>
+#include <climits>
+#include <cmath>
+#include <cstring>
+#include <future>
 #include <iostream>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
 #include <vector>
 
-bool 
-HoudiniEngineGeometry::sendGeometryToHoudini(const HAPI_Session * session, const HAPI_CookOptions * cook_options, HAPI_NodeId * output_node)
+// Number of heightfield samples fetched per GetHeightFieldData call
+static const int HEIGHTFIELD_STRIPE_SAMPLES = 1024 * 1024;
+
+// Bounds of the auto-tuned attribute transfer chunk size
+static const long long MIN_TRANSFER_CHUNK_BYTES = 256 * 1024;
+static const long long MAX_TRANSFER_CHUNK_BYTES = 256 * 1024 * 1024;
+
+// Hill-climbs the transfer chunk size of a session from the throughput of completed chunks:
+// keep stepping (x2 or /2) while throughput improves, turn around when it drops.
+struct TransferChunkTuner
+{
+    long long chunkBytes = 8 * 1024 * 1024;
+    double bestThroughput = 0.0;
+    bool growing = true;
+
+    void record(long long bytes, double seconds)
+    {
+        // Partial tail chunks say little about the chunk size
+        if (seconds <= 0.0 || bytes < chunkBytes / 2)
+            return;
+
+        double throughput = bytes / seconds;
+        if (throughput > bestThroughput * 1.05)
+        {
+            bestThroughput = throughput;
+        }
+        else if (throughput < bestThroughput * 0.9)
+        {
+            growing = !growing;
+        }
+        else
+        {
+            return;
+        }
+
+        chunkBytes = growing ? chunkBytes * 2 : chunkBytes / 2;
+        chunkBytes = std::max(MIN_TRANSFER_CHUNK_BYTES, std::min(MAX_TRANSFER_CHUNK_BYTES, chunkBytes));
+    }
+};
+
+static std::mutex theTransferChunkMutex;
+static std::map<std::pair<int, HAPI_SessionId>, TransferChunkTuner> theTransferChunkTuners;
+
+// Material infos fetched per session, keyed by material node
+static std::mutex theMaterialInfoMutex;
+static std::map<std::pair<int, HAPI_SessionId>, std::unordered_map<HAPI_NodeId, HAPI_MaterialInfo>> theMaterialInfoCache;
+
+// Input mesh network built by sendGeometryToHoudini, and the input node it uploads to
+struct InputMeshNetwork
+{
+    HoudiniEngineNodeGraph graph;
+    HoudiniEngineInputNode input;
+};
+
+static std::mutex theInputMeshNetworkMutex;
+static std::map<std::pair<int, HAPI_SessionId>, InputMeshNetwork> theInputMeshNetworks;
+
+// Faces handled by each worker of the material counting sort
+static const int MATERIAL_SORT_MIN_FACES_PER_TASK = 64 * 1024;
+
+// 64-bit FNV-1a hash of a buffer, continuing from hash when given
+static uint64_t
+hashBytes(const char* data, size_t size, uint64_t hash = 14695981039346656037ULL)
+{
+    for (size_t i = 0; i < size; ++i)
+    {
+        hash ^= (unsigned char)data[i];
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+// The counts of a mesh part, which must match for a cached read of the part to be reused
+struct TopologyFingerprint
+{
+    HAPI_PartType type = HAPI_PARTTYPE_INVALID;
+    int faceCount = -1;
+    int vertexCount = -1;
+    int pointCount = -1;
+
+    bool sameCounts(const TopologyFingerprint& other) const
+    {
+        return type == other.type && faceCount == other.faceCount &&
+               vertexCount == other.vertexCount && pointCount == other.pointCount;
+    }
+};
+
+// The last mesh read from a part, reused by later reads of the part when unchanged
+struct CachedMeshPart
+{
+    TopologyFingerprint fingerprint;
+    std::vector<int> faceCounts;
+    std::vector<int> vertexList;
+
+    // Float attributes keyed by owner and name
+    std::map<std::pair<int, std::string>, std::pair<HAPI_AttributeInfo, std::vector<float>>> attributes;
+
+    // Primitive names, and the attribute info they were read with
+    HAPI_AttributeInfo nameInfo{};
+    HoudiniEngineStringColumn names;
+
+    // Groups, and the point, primitive and edge group counts they were read with
+    bool hasGroups = false;
+    int groupCounts[3] = { -1, -1, -1 };
+    std::vector<HoudiniEngineGroup> groups;
+
+    bool hasMaterials = false;
+    HoudiniEngineMaterialBuckets materials;
+
+    // Forget everything read along with the topology
+    void clearTopologyData()
+    {
+        attributes.clear();
+        nameInfo = HAPI_AttributeInfo{};
+        names = HoudiniEngineStringColumn();
+        hasGroups = false;
+        groups.clear();
+        hasMaterials = false;
+        materials = HoudiniEngineMaterialBuckets();
+    }
+};
+
+static std::mutex theMeshPartMutex;
+static std::map<std::tuple<int, HAPI_SessionId, HAPI_NodeId, HAPI_PartId>, CachedMeshPart> theMeshPartCache;
+
+// Hash of the first part of a node's display geometry: its counts, its whole topology and all
+// of its positions, so that any topology change or deform changes the hash
+static bool
+hashDisplayGeometry(const HAPI_Session* session, HAPI_NodeId node_id, uint64_t& hash)
 {
-    HAPI_NodeId input_cube = -1;
-    std::cout << "\nCreating geometry input node 'input_Cube'..." << std::endl;
+    HOUDINI_TRACE_SCOPE("hashDisplayGeometry");
+
+    HAPI_GeoInfo geo_info;
     HOUDINI_CHECK_ERROR_RETURN(
-        HoudiniApi::CreateInputNode(session, -1, &input_cube, "Cube"), false);
+        HoudiniApi::GetDisplayGeoInfo(session, node_id, &geo_info), false);
 
+    HAPI_PartInfo part_info;
     HOUDINI_CHECK_ERROR_RETURN(
-        HoudiniApi::CookNode(session, input_cube, cook_options), false);
+        HoudiniApi::GetPartInfo(session, geo_info.nodeId, 0, &part_info), false);
 
-    int cook_status = HAPI_STATE_MAX;
-    HAPI_Result result;
-    do
+    const int counts[4] = { (int)part_info.type, part_info.faceCount, part_info.vertexCount, part_info.pointCount };
+    hash = hashBytes((const char*)counts, sizeof(counts), hash);
+
+    std::vector<int> topology(part_info.faceCount);
+    if (!topology.empty())
     {
-        result = HoudiniApi::GetStatus(session, HAPI_STATUS_COOK_STATE, &cook_status);
+        HOUDINI_CHECK_ERROR_RETURN(
+            HoudiniApi::GetFaceCounts(session, geo_info.nodeId, part_info.id, topology.data(), 0, part_info.faceCount), false);
+        hash = hashBytes((const char*)topology.data(), topology.size() * sizeof(int), hash);
     }
-    while (cook_status > HAPI_STATE_MAX_READY_STATE && result == HAPI_RESULT_SUCCESS);
-    
-    HOUDINI_CHECK_ERROR_RETURN(result, false);
-    
-    // Use the Geometry Setters API to define a cube mesh
-    HAPI_PartInfo node_part = HoudiniApi::PartInfo_Create();
-    node_part.type = HAPI_PARTTYPE_MESH;
-    node_part.faceCount = 6;
-    node_part.vertexCount = 24;
-    node_part.pointCount = 8;
 
-    HOUDINI_CHECK_ERROR_RETURN(
-        HoudiniApi::SetPartInfo(session, input_cube, 0, &node_part), false);
-    
-    // Add 'P' (position) point attributes
-    std::cout << "  Setting position (P) point attributes" << std::endl;
+    topology.resize(part_info.vertexCount);
+    if (!topology.empty())
+    {
+        HOUDINI_CHECK_ERROR_RETURN(
+            HoudiniApi::GetVertexList(session, geo_info.nodeId, part_info.id, topology.data(), 0, part_info.vertexCount), false);
+        hash = hashBytes((const char*)topology.data(), topology.size() * sizeof(int), hash);
+    }
 
-    HAPI_AttributeInfo node_point_info = HoudiniApi::AttributeInfo_Create();
-    node_point_info.count = 8;
-    node_point_info.tupleSize = 3;
-    node_point_info.exists = true;
-    node_point_info.storage = HAPI_STORAGETYPE_FLOAT;
-    node_point_info.owner = HAPI_ATTROWNER_POINT;
-    
+    HAPI_AttributeInfo attrib_info = HoudiniApi::AttributeInfo_Create();
     HOUDINI_CHECK_ERROR_RETURN(
-        HoudiniApi::AddAttribute(session, input_cube, 0, "P", &node_point_info), false);
-    
+        HoudiniApi::GetAttributeInfo(session, geo_info.nodeId, part_info.id, "P", HAPI_ATTROWNER_POINT, &attrib_info), false);
+    if (!attrib_info.exists || attrib_info.count <= 0)
+        return true;
+
+    std::vector<float> positions((size_t)attrib_info.count * attrib_info.tupleSize);
+    if (!HoudiniEngineGeometry::readAttributeFloatDataChunked(
+            session, geo_info.nodeId, part_info.id, "P", attrib_info, positions.data()))
+        return false;
+
+    hash = hashBytes((const char*)positions.data(), positions.size() * sizeof(float), hash);
+    return true;
+}
+
+// True when two reads of a part's groups hold the same names, types and members
+static bool
+sameGroups(const std::vector<HoudiniEngineGroup>& left, const std::vector<HoudiniEngineGroup>& right)
+{
+    if (left.size() != right.size())
+        return false;
+
+    for (size_t i = 0; i < left.size(); ++i)
+    {
+        const HoudiniEngineGroup& a = left[i];
+        const HoudiniEngineGroup& b = right[i];
+        if (a.name != b.name || a.type != b.type || a.elementCount != b.elementCount || a.memberCount != b.memberCount ||
+            a.bits != b.bits || a.ranges != b.ranges || a.edgePoints != b.edgePoints)
+            return false;
+    }
+    return true;
+}
+
+// Elements of element_bytes each that fit in the session's current chunk
+static int
+getTransferChunkElements(const HAPI_Session* session, int element_bytes)
+{
+    // In-process calls do not serialize, so a single call is always fastest
+    if (session && session->type == HAPI_SESSION_INPROCESS)
+        return INT_MAX;
+
+    long long chunk_bytes = HoudiniEngineGeometry::getTransferChunkBytes(session);
+    return (int)std::max(1LL, chunk_bytes / std::max(1, element_bytes));
+}
+
+// True when all count tuples of tuple_size values are bitwise identical
+template <typename T>
+static bool
+isUniformAttribute(const T* data, int count, int tuple_size)
+{
+    const size_t tuple_bytes = tuple_size * sizeof(T);
+    for (int i = 1; i < count; ++i)
+    {
+        if (std::memcmp(data, data + (size_t)i * tuple_size, tuple_bytes) != 0)
+            return false;
+    }
+    return true;
+}
+
+static void
+recordTransferChunk(const HAPI_Session* session, long long bytes, double seconds)
+{
+    if (!session)
+        return;
+
+    std::lock_guard<std::mutex> lock(theTransferChunkMutex);
+    theTransferChunkTuners[{ (int)session->type, session->id }].record(bytes, seconds);
+}
+
+bool 
+HoudiniEngineGeometry::sendGeometryToHoudini(const HAPI_Session * session, const HAPI_CookOptions * cook_options, HAPI_NodeId * output_node,
+                                             float twist)
+{
+    // The input node and its SOP chain are built once per session and reused for later uploads
+    InputMeshNetwork* network = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(theInputMeshNetworkMutex);
+        network = &theInputMeshNetworks[{ (int)session->type, session->id }];
+    }
+
+    HoudiniEngineNodeGraph* graph = &network->graph;
+    if (!graph->isBuilt(session))
+    {
+        std::cout << "\nCreating geometry input node 'input_Cube'..." << std::endl;
+
+        // Cd (colour) and uv attributes are added by SOPs after the input. Normals are not:
+        // readGeometryFromHoudini computes them on the host instead. What is left of an
+        // earlier network, if one of its nodes was deleted, goes first.
+        graph->destroy(session);
+        *graph = HoudiniEngineNodeGraph();
+        graph->addInputNode("input", "Cube");
+        graph->addNode("color", "color", "Cube_Color");
+        graph->addNode("uv", "uvproject", "Cube_UV");
+        graph->addNode("output", "output", "OUT");
+        graph->connect("input", "color");
+        graph->connect("color", "uv");
+        graph->connect("uv", "output");
+        graph->setOutput("output");
+
+        if (!graph->build(session, -1))
+            return false;
+
+        // A new input node has nothing committed yet
+        network->input = HoudiniEngineInputNode();
+        network->input.nodeId = graph->getNodeId("input");
+    }
+    else
+    {
+        std::cout << "\nReusing geometry input node 'input_Cube'..." << std::endl;
+    }
+
+    // Use the Geometry Setters API to define a cube mesh
     float positions[24] = { 0.0f, 0.0f, 0.0f,
                             0.0f, 0.0f, 1.0f,
                             0.0f, 1.0f, 0.0f,
@@ -83,13 +328,22 @@ HoudiniEngineGeometry::sendGeometryToHoudini(const HAPI_Session * session, const
                             1.0f, 0.0f, 1.0f,
                             1.0f, 1.0f, 0.0f,
                             1.0f, 1.0f, 1.0f };
-    
-    HOUDINI_CHECK_ERROR_RETURN(
-        HoudiniApi::SetAttributeFloatData(
-            session, input_cube,
-            0, "P", &node_point_info,
-            positions, 0, 8), false );
-    
+
+    // Rotate the top points around the cube's vertical axis
+    const float cos_twist = std::cos(twist);
+    const float sin_twist = std::sin(twist);
+    for (int point = 0; point < 8; ++point)
+    {
+        float* position = &positions[point * 3];
+        if (position[1] < 1.0f)
+            continue;
+
+        float x = position[0] - 0.5f;
+        float z = position[2] - 0.5f;
+        position[0] = 0.5f + x * cos_twist - z * sin_twist;
+        position[2] = 0.5f + x * sin_twist + z * cos_twist;
+    }
+
     // Define the list of vertices
     int vertices[24] = { 0, 2, 6, 4,
                          2, 3, 7, 6,
@@ -97,73 +351,148 @@ HoudiniEngineGeometry::sendGeometryToHoudini(const HAPI_Session * session, const
                          1, 5, 7, 3,
                          5, 4, 6, 7,
                          0, 4, 5, 1 };
-    
-    std::cout << "  Setting vertex list and face count" << std::endl;
-    HOUDINI_CHECK_ERROR_RETURN(
-        HoudiniApi::SetVertexList(session, input_cube, 0, vertices, 0, 24), false);
-   
-    // Set face counts
+
     int face_counts [ 6 ] = { 4, 4, 4, 4, 4, 4 };
-    HOUDINI_CHECK_ERROR_RETURN(
-        HoudiniApi::SetFaceCounts(session, input_cube, 0, face_counts, 0, 6), false);
-    
-    std::cout << "Sending data to the Houdini cook engine" << std::endl;
-    HOUDINI_CHECK_ERROR_RETURN(
-        HoudiniApi::CommitGeo(session, input_cube), false);
 
-    // Add 'Cd' (Colour) point attributes
-    std::cout << "  Connecting a Color SOP node" << std::endl;
+    std::vector<std::string> prim_names(6, "Cube");
 
-    HAPI_NodeInfo node_info = HoudiniApi::NodeInfo_Create();
-    HOUDINI_CHECK_ERROR_RETURN(
-        HoudiniApi::GetNodeInfo(session, input_cube, &node_info), false);
+    HoudiniEngineMeshInput mesh;
+    mesh.pointCount = 8;
+    mesh.positions = positions;
+    mesh.faceCount = 6;
+    mesh.faceCounts = face_counts;
+    mesh.vertexList = vertices;
+    mesh.primNames = prim_names.data();
 
-    HAPI_NodeId parent_id = node_info.parentId;
-    HAPI_NodeId color_node = -1;
-    HOUDINI_CHECK_ERROR_RETURN(
-        HoudiniApi::CreateNode(session, parent_id, "color", "Cube_Color", true, &color_node), false);
+    if (!setInputMesh(session, mesh, network->input))
+        return false;
 
-    HOUDINI_CHECK_ERROR_RETURN(
-        HoudiniApi::ConnectNodeInput(session, color_node, 0, input_cube, 0), false);
+    // A single cook at the output pulls the new geometry through the chain
+    if (!graph->cook(session, cook_options))
+        return false;
 
-    // Add 'N' (Normal) point attributes
-    std::cout << "  Connecting a Normal SOP node" << std::endl;
+    *output_node = graph->getNodeId("output");
+    return true;
+}
 
-    HAPI_NodeId normal_node = -1;
-    HOUDINI_CHECK_ERROR_RETURN(
-        HoudiniApi::CreateNode(session, parent_id, "normal", "Cube_Normal", true, &normal_node), false);
+bool
+HoudiniEngineGeometry::setInputMesh(const HAPI_Session * session, const HoudiniEngineMeshInput& mesh, HoudiniEngineInputNode& input_node)
+{
+    HOUDINI_TRACE_SCOPE("setInputMesh");
 
-    HOUDINI_CHECK_ERROR_RETURN(
-        HoudiniApi::ConnectNodeInput(session, normal_node, 0, color_node, 0), false);
+    int vertex_count = 0;
+    for (int face = 0; face < mesh.faceCount; ++face)
+        vertex_count += mesh.faceCounts[face];
+
+    if (input_node.nodeId < 0)
+    {
+        HOUDINI_CHECK_ERROR_RETURN(
+            HoudiniApi::CreateInputNode(session, -1, &input_node.nodeId, input_node.name.c_str()), false);
+        input_node.committed = false;
+    }
+
+    // Same points, faces, vertices and names as the committed geometry: only P moved
+    bool same_topology =
+        input_node.committed &&
+        input_node.pointCount == mesh.pointCount &&
+        input_node.faceCounts.size() == (size_t)mesh.faceCount &&
+        input_node.vertexList.size() == (size_t)vertex_count &&
+        std::equal(input_node.faceCounts.begin(), input_node.faceCounts.end(), mesh.faceCounts) &&
+        std::equal(input_node.vertexList.begin(), input_node.vertexList.end(), mesh.vertexList) &&
+        (mesh.primNames ? input_node.primNames.size() == (size_t)mesh.faceCount &&
+                          std::equal(input_node.primNames.begin(), input_node.primNames.end(), mesh.primNames)
+                        : input_node.primNames.empty());
+
+    HAPI_NodeId node_id = input_node.nodeId;
+
+    HAPI_AttributeInfo node_point_info = HoudiniApi::AttributeInfo_Create();
+    node_point_info.count = mesh.pointCount;
+    node_point_info.tupleSize = 3;
+    node_point_info.exists = true;
+    node_point_info.storage = HAPI_STORAGETYPE_FLOAT;
+    node_point_info.owner = HAPI_ATTROWNER_POINT;
 
-    // Add 'UV' point attributes
-    std::cout << "  Connecting a UV Project SOP node" << std::endl;
+    if (same_topology)
+    {
+        std::cout << "  Updating position (P) point attributes only" << std::endl;
+        if (!setAttributeFloatDataCompact(session, node_id, 0, "P", node_point_info, mesh.positions))
+            return false;
+
+        HOUDINI_CHECK_ERROR_RETURN(
+            HoudiniApi::CommitGeo(session, node_id), false);
+        return true;
+    }
+
+    input_node.committed = false;
+
+    HAPI_PartInfo node_part = HoudiniApi::PartInfo_Create();
+    node_part.type = HAPI_PARTTYPE_MESH;
+    node_part.faceCount = mesh.faceCount;
+    node_part.vertexCount = vertex_count;
+    node_part.pointCount = mesh.pointCount;
 
-    HAPI_NodeId uv_project_node = -1;
     HOUDINI_CHECK_ERROR_RETURN(
-        HoudiniApi::CreateNode(session, parent_id, "uvproject", "Cube_UV", true, &uv_project_node), false);
-    
+        HoudiniApi::SetPartInfo(session, node_id, 0, &node_part), false);
+
+    // Add 'P' (position) point attributes
+    std::cout << "  Setting position (P) point attributes" << std::endl;
+
     HOUDINI_CHECK_ERROR_RETURN(
-        HoudiniApi::ConnectNodeInput(session, uv_project_node, 0, normal_node, 0), false);
+        HoudiniApi::AddAttribute(session, node_id, 0, "P", &node_point_info), false);
+
+    if (!setAttributeFloatDataCompact(session, node_id, 0, "P", node_point_info, mesh.positions))
+        return false;
 
-    // Add Output node & enable its display flag
+    std::cout << "  Setting vertex list and face count" << std::endl;
     HOUDINI_CHECK_ERROR_RETURN(
-        HoudiniApi::CreateNode(session, parent_id, "output", "OUT", true, output_node), false);
+        HoudiniApi::SetVertexList(session, node_id, 0, mesh.vertexList, 0, vertex_count), false);
 
     HOUDINI_CHECK_ERROR_RETURN(
-        HoudiniApi::ConnectNodeInput(session, *output_node, 0, uv_project_node, 0), false);
+        HoudiniApi::SetFaceCounts(session, node_id, 0, mesh.faceCounts, 0, mesh.faceCount), false);
+
+    std::vector<std::string> prim_names;
+    if (mesh.primNames)
+    {
+        // Add a 'name' primitive attribute, sent as a single value when uniform
+        std::cout << "  Setting name primitive attributes" << std::endl;
+
+        HAPI_AttributeInfo node_prim_info = HoudiniApi::AttributeInfo_Create();
+        node_prim_info.count = mesh.faceCount;
+        node_prim_info.tupleSize = 1;
+        node_prim_info.exists = true;
+        node_prim_info.storage = HAPI_STORAGETYPE_STRING;
+        node_prim_info.owner = HAPI_ATTROWNER_PRIM;
 
+        HOUDINI_CHECK_ERROR_RETURN(
+            HoudiniApi::AddAttribute(session, node_id, 0, "name", &node_prim_info), false);
+
+        prim_names.assign(mesh.primNames, mesh.primNames + mesh.faceCount);
+        if (!setAttributeStringDataCompact(session, node_id, 0, "name", node_prim_info, prim_names))
+            return false;
+    }
+
+    std::cout << "Sending data to the Houdini cook engine" << std::endl;
     HOUDINI_CHECK_ERROR_RETURN(
-        HoudiniApi::SetNodeDisplay(session, *output_node, 1), false);
+        HoudiniApi::CommitGeo(session, node_id), false);
 
+    input_node.committed = true;
+    input_node.pointCount = mesh.pointCount;
+    input_node.faceCounts.assign(mesh.faceCounts, mesh.faceCounts + mesh.faceCount);
+    input_node.vertexList.assign(mesh.vertexList, mesh.vertexList + vertex_count);
+    input_node.primNames = std::move(prim_names);
     return true;
 }
 
 bool 
 HoudiniEngineGeometry::readGeometryFromHoudini(const HAPI_Session * session, const HAPI_NodeId node_id, const HAPI_CookOptions * cook_options)
 {
-    HOUDINI_CHECK_ERROR_RETURN(
-        HoudiniApi::CookNode(session, node_id, cook_options), false);
+    HOUDINI_TRACE_SCOPE("readGeometryFromHoudini");
+
+    {
+        HOUDINI_TRACE_SCOPE("CookNode");
+        HOUDINI_CHECK_ERROR_RETURN(
+            HoudiniApi::CookNode(session, node_id, cook_options), false);
+    }
 
     // Get mesh geo info.
     std::cout << "\nGetting mesh geometry info:" << std::endl;
@@ -176,38 +505,86 @@ HoudiniEngineGeometry::readGeometryFromHoudini(const HAPI_Session * session, con
     HOUDINI_CHECK_ERROR_RETURN(
         HoudiniApi::GetPartInfo(session, mesh_geo_info.nodeId, 0, &mesh_part_info), false);
 
-    // Get mesh face counts.
-    std::vector<int> mesh_face_counts(mesh_part_info.faceCount);
-    HOUDINI_CHECK_ERROR_RETURN(
-        HoudiniApi::GetFaceCounts(
-            session,
-            mesh_geo_info.nodeId,
-            mesh_part_info.id,
-            mesh_face_counts.data(),
-            0, mesh_part_info.faceCount
-        ),
-        false);
+    // The last read of this part, whose topology and attributes are reused when unchanged
+    CachedMeshPart* cached_part = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(theMeshPartMutex);
+        cached_part = &theMeshPartCache[std::make_tuple((int)session->type, session->id, mesh_geo_info.nodeId, mesh_part_info.id)];
+    }
 
-    std::cout << "  Face count: " << mesh_face_counts.size() << std::endl;
+    TopologyFingerprint fingerprint;
+    fingerprint.type = mesh_part_info.type;
+    fingerprint.faceCount = mesh_part_info.faceCount;
+    fingerprint.vertexCount = mesh_part_info.vertexCount;
+    fingerprint.pointCount = mesh_part_info.pointCount;
 
-    // Get mesh vertex list.
-    std::vector<int> mesh_vertex_list(mesh_part_info.vertexCount);
-    HOUDINI_CHECK_ERROR_RETURN(
-        HoudiniApi::GetVertexList(
-            session, 
-            mesh_geo_info.nodeId,
-            mesh_part_info.id,
-            mesh_vertex_list.data(),
-            0, mesh_part_info.vertexCount
-        ), 
-        false);
+    // The last read is reused as is only when Houdini reports that the part did not change
+    // (checkPartChanges). Otherwise everything is fetched again, and reported as unchanged
+    // only when it compares equal to the last read.
+    const bool part_unchanged =
+        cook_options && cook_options->checkPartChanges && !mesh_part_info.hasChanged &&
+        fingerprint.sameCounts(cached_part->fingerprint);
+
+    std::vector<int>& mesh_face_counts = cached_part->faceCounts;
+    std::vector<int>& mesh_vertex_list = cached_part->vertexList;
+    bool same_topology = part_unchanged;
+    if (!part_unchanged)
+    {
+        // Forget the previous read until this one succeeds
+        const bool same_counts = fingerprint.sameCounts(cached_part->fingerprint);
+        cached_part->fingerprint = TopologyFingerprint();
+
+        // Get mesh face counts.
+        std::vector<int> face_counts(mesh_part_info.faceCount);
+        {
+            HOUDINI_TRACE_SCOPE("GetFaceCounts");
+            HOUDINI_CHECK_ERROR_RETURN(
+                HoudiniApi::GetFaceCounts(
+                    session,
+                    mesh_geo_info.nodeId,
+                    mesh_part_info.id,
+                    face_counts.data(),
+                    0, mesh_part_info.faceCount
+                ),
+                false);
+        }
 
-    std::cout << "  Vertex count: " << mesh_vertex_list.size() << std::endl;
+        // Get mesh vertex list.
+        std::vector<int> vertex_list(mesh_part_info.vertexCount);
+        {
+            HOUDINI_TRACE_SCOPE("GetVertexList");
+            HOUDINI_CHECK_ERROR_RETURN(
+                HoudiniApi::GetVertexList(
+                    session, 
+                    mesh_geo_info.nodeId,
+                    mesh_part_info.id,
+                    vertex_list.data(),
+                    0, mesh_part_info.vertexCount
+                ), 
+                false);
+        }
 
-    // Fetch mesh attributes of the given name
+        same_topology = same_counts && face_counts == mesh_face_counts && vertex_list == mesh_vertex_list;
+        if (!same_topology)
+        {
+            cached_part->clearTopologyData();
+            mesh_face_counts.swap(face_counts);
+            mesh_vertex_list.swap(vertex_list);
+        }
+        cached_part->fingerprint = fingerprint;
+    }
+
+    const char* topology_state = same_topology ? " (unchanged)" : "";
+    std::cout << "  Face count: " << mesh_face_counts.size() << topology_state << std::endl;
+    std::cout << "  Vertex count: " << mesh_vertex_list.size() << topology_state << std::endl;
+
+    // Fetch mesh attributes of the given name. Attributes other than those always fetched are
+    // reused when the part is unchanged and their attribute info matches the last read.
+    // process_chunk, when given, runs on each fetched chunk while the next one is in flight.
     auto fetchPointAttrib = [&](HAPI_AttributeOwner owner, 
                                 const char* attrib_name,
-                                std::vector<float>& mesh_attrib_data)
+                                bool always_fetch,
+                                const std::function<void(const float* data, int start, int length)>& process_chunk) -> std::vector<float>&
     {
         HAPI_AttributeInfo mesh_attrib_info;
         HOUDINI_CHECK_ERROR(
@@ -218,33 +595,142 @@ HoudiniEngineGeometry::readGeometryFromHoudini(const HAPI_Session * session, con
                 attrib_name, owner,
                 &mesh_attrib_info
             ));
-        
-        mesh_attrib_data.resize(mesh_attrib_info.count * mesh_attrib_info.tupleSize);
-        HOUDINI_CHECK_ERROR(
-            HoudiniApi::GetAttributeFloatData(
-                session, 
-                mesh_geo_info.nodeId, 
-                mesh_part_info.id, 
+
+        auto& cached_attrib = cached_part->attributes[{ (int)owner, attrib_name }];
+        const HAPI_AttributeInfo& cached_info = cached_attrib.first;
+        std::vector<float>& mesh_attrib_data = cached_attrib.second;
+
+        const bool same_info =
+            mesh_attrib_info.exists && cached_info.exists && cached_info.storage == mesh_attrib_info.storage &&
+            cached_info.count == mesh_attrib_info.count && cached_info.tupleSize == mesh_attrib_info.tupleSize;
+        bool unchanged = !always_fetch && part_unchanged && same_info;
+        if (!unchanged)
+        {
+            std::vector<float> attrib_data(mesh_attrib_info.count * mesh_attrib_info.tupleSize);
+            float* data = attrib_data.data();
+            const bool read = readAttributeFloatDataChunked(
+                session,
+                mesh_geo_info.nodeId,
+                mesh_part_info.id,
                 attrib_name,
-                &mesh_attrib_info, -1, 
-                mesh_attrib_data.data(),
-                0, mesh_attrib_info.count
-            ));
+                mesh_attrib_info,
+                data,
+                process_chunk ? [&](int start, int length) { process_chunk(data, start, length); }
+                              : std::function<void(int, int)>());
+
+            unchanged = read && same_info && attrib_data == mesh_attrib_data;
+            cached_attrib.first = mesh_attrib_info;
+            cached_attrib.first.exists = read && mesh_attrib_info.exists;
+            mesh_attrib_data.swap(attrib_data);
+        }
 
-        std::cout << "  " <<attrib_name << " attribute count: " << mesh_attrib_data.size() << std::endl;
+        std::cout << "  " <<attrib_name << " attribute count: " << mesh_attrib_data.size()
+                  << (unchanged ? " (unchanged)" : "") << std::endl;
+        return mesh_attrib_data;
     };
 
-    std::vector<float> mesh_p_attrib_info;
-    fetchPointAttrib(HAPI_ATTROWNER_POINT, "P", mesh_p_attrib_info);
+    // Positions are expected to move between reads, so they are always fetched. Their bounds
+    // are grown chunk by chunk, overlapping the transfer of the next chunk.
+    HoudiniEngineBounds mesh_bounds;
+    std::vector<float>& mesh_p_attrib_info = fetchPointAttrib(HAPI_ATTROWNER_POINT, "P", true,
+        [&](const float* data, int start, int length)
+        {
+            HoudiniEngineMeshProcessing::expandBounds(mesh_bounds, data + (size_t)start * 3, length);
+        });
+    fetchPointAttrib(HAPI_ATTROWNER_POINT, "Cd", false, nullptr);
+    std::vector<float>& mesh_uv_attrib_data = fetchPointAttrib(HAPI_ATTROWNER_VERTEX , "uv", false, nullptr);
+
+    // Bounds, normals and tangents are computed here rather than cooked and transferred
+    {
+        HOUDINI_TRACE_SCOPE("processMesh");
+
+        if (!mesh_bounds.isEmpty())
+        {
+            std::cout << "  Bounds: (" << mesh_bounds.min[0] << ", " << mesh_bounds.min[1] << ", " << mesh_bounds.min[2] << ") - ("
+                      << mesh_bounds.max[0] << ", " << mesh_bounds.max[1] << ", " << mesh_bounds.max[2] << ")" << std::endl;
+        }
+
+        std::vector<float> mesh_normals;
+        if (HoudiniEngineMeshProcessing::computeNormals(mesh_p_attrib_info, mesh_face_counts, mesh_vertex_list, mesh_normals))
+            std::cout << "  N computed: " << mesh_normals.size() << std::endl;
+
+        std::vector<float> mesh_tangents;
+        int uv_tuple_size = mesh_vertex_list.empty() ? 0 : (int)(mesh_uv_attrib_data.size() / mesh_vertex_list.size());
+        if (!mesh_normals.empty() && uv_tuple_size >= 2 &&
+            HoudiniEngineMeshProcessing::computeTangents(mesh_p_attrib_info, mesh_normals, mesh_uv_attrib_data, uv_tuple_size,
+                                                         mesh_face_counts, mesh_vertex_list, mesh_tangents))
+            std::cout << "  Tangents computed: " << mesh_tangents.size() << std::endl;
+    }
+
+    // Fetch the primitive names, if any, as a dictionary-encoded column. Like the attributes
+    // above, the names and groups of the last read are reused only for an unchanged part.
+    HAPI_AttributeInfo mesh_name_info;
+    HoudiniApi::AttributeInfo_Init(&mesh_name_info);
+    HoudiniApi::GetAttributeInfo(
+        session, mesh_geo_info.nodeId, mesh_part_info.id,
+        "name", HAPI_ATTROWNER_PRIM, &mesh_name_info);
+
+    HoudiniEngineStringColumn& mesh_name_data = cached_part->names;
+    HAPI_AttributeInfo& cached_name_info = cached_part->nameInfo;
+    const bool same_name_info =
+        mesh_name_info.exists && cached_name_info.exists &&
+        cached_name_info.storage == mesh_name_info.storage && cached_name_info.count == mesh_name_info.count &&
+        cached_name_info.tupleSize == mesh_name_info.tupleSize;
+    bool same_names = part_unchanged && same_name_info;
+    if (!same_names)
+    {
+        HoudiniEngineStringColumn name_data;
+        const bool read =
+            mesh_name_info.exists && mesh_name_info.storage == HAPI_STORAGETYPE_STRING &&
+            readAttributeStringData(session, mesh_geo_info.nodeId, mesh_part_info.id, "name", mesh_name_info, name_data);
+
+        same_names = read && same_name_info &&
+            name_data.dictionary == mesh_name_data.dictionary && name_data.indices == mesh_name_data.indices;
+        cached_name_info = read ? mesh_name_info : HAPI_AttributeInfo{};
+        mesh_name_data = std::move(name_data);
+    }
+
+    if (cached_name_info.exists)
+    {
+        std::cout << "  name attribute count: " << mesh_name_data.indices.size()
+                  << " (" << mesh_name_data.dictionary.size() << " unique)"
+                  << (same_names ? " (unchanged)" : "") << std::endl;
+    }
+
+    // Fetch the groups and split the mesh by its primitive groups
+    const int group_counts[3] = { mesh_geo_info.pointGroupCount, mesh_geo_info.primitiveGroupCount, mesh_geo_info.edgeGroupCount };
+    const bool same_group_counts =
+        cached_part->hasGroups && std::equal(group_counts, group_counts + 3, cached_part->groupCounts);
+    bool same_groups = part_unchanged && same_group_counts;
+    if (!same_groups)
+    {
+        std::vector<HoudiniEngineGroup> groups;
+        const bool read = readGroupsFromHoudini(session, mesh_geo_info, mesh_part_info, groups);
+
+        same_groups = read && same_group_counts && sameGroups(groups, cached_part->groups);
+        cached_part->hasGroups = read;
+        cached_part->groups.swap(groups);
+        std::copy(group_counts, group_counts + 3, cached_part->groupCounts);
+    }
+
+    if (cached_part->hasGroups)
+    {
+        std::vector<HoudiniEngineMeshSplit> mesh_splits;
+        splitMeshByGroups(mesh_face_counts, mesh_vertex_list, cached_part->groups, mesh_splits);
 
-    std::vector<float> mesh_cd_attrib_data;
-    fetchPointAttrib(HAPI_ATTROWNER_POINT, "Cd", mesh_cd_attrib_data);
+        for (const HoudiniEngineMeshSplit& split : mesh_splits)
+            std::cout << "  Group " << split.name << " face count: " << split.faceCounts.size()
+                      << (same_groups ? " (unchanged)" : "") << std::endl;
+    }
 
-    std::vector<float> mesh_N_attrib_data;
-    fetchPointAttrib(HAPI_ATTROWNER_VERTEX , "N", mesh_N_attrib_data);
+    // Bucket the faces by material
+    bool same_materials = same_topology && cached_part->hasMaterials && !mesh_geo_info.hasMaterialChanged;
+    if (!same_materials)
+        cached_part->hasMaterials = readMaterialBucketsFromHoudini(session, mesh_geo_info, mesh_part_info, cached_part->materials);
 
-    std::vector<float> mesh_uv_attrib_data;
-    fetchPointAttrib(HAPI_ATTROWNER_VERTEX , "uv", mesh_uv_attrib_data);
+    if (cached_part->hasMaterials)
+        std::cout << "  Material count: " << cached_part->materials.materials.size()
+                  << (same_materials ? " (unchanged)" : "") << std::endl;
 
     // Now  that you have all the required mesh data, you can now create
     // a native mesh using your DCC/engine's dedicated functions:"
@@ -252,3 +738,1602 @@ HoudiniEngineGeometry::readGeometryFromHoudini(const HAPI_Session * session, con
 
     return true;
 }
+
+bool
+HoudiniEngineGeometry::readMeshFromHoudini(const HAPI_Session * session, HAPI_NodeId node_id, HoudiniEngineMesh& mesh)
+{
+    HOUDINI_TRACE_SCOPE("readMeshFromHoudini");
+
+    HAPI_GeoInfo geo_info;
+    HOUDINI_CHECK_ERROR_RETURN(
+        HoudiniApi::GetDisplayGeoInfo(session, node_id, &geo_info), false);
+
+    HAPI_PartInfo part_info;
+    HOUDINI_CHECK_ERROR_RETURN(
+        HoudiniApi::GetPartInfo(session, geo_info.nodeId, 0, &part_info), false);
+
+    mesh = HoudiniEngineMesh();
+    mesh.pointCount = part_info.pointCount;
+
+    mesh.faceCounts.resize(part_info.faceCount);
+    if (part_info.faceCount > 0)
+    {
+        HOUDINI_TRACE_SCOPE("GetFaceCounts");
+        HOUDINI_CHECK_ERROR_RETURN(
+            HoudiniApi::GetFaceCounts(
+                session, geo_info.nodeId, part_info.id,
+                mesh.faceCounts.data(), 0, part_info.faceCount), false);
+    }
+
+    mesh.vertexList.resize(part_info.vertexCount);
+    if (part_info.vertexCount > 0)
+    {
+        HOUDINI_TRACE_SCOPE("GetVertexList");
+        HOUDINI_CHECK_ERROR_RETURN(
+            HoudiniApi::GetVertexList(
+                session, geo_info.nodeId, part_info.id,
+                mesh.vertexList.data(), 0, part_info.vertexCount), false);
+    }
+
+    const HAPI_AttributeOwner owners[] = { HAPI_ATTROWNER_POINT, HAPI_ATTROWNER_VERTEX, HAPI_ATTROWNER_PRIM };
+    for (HAPI_AttributeOwner owner : owners)
+    {
+        const int name_count = part_info.attributeCounts[owner];
+        if (name_count == 0)
+            continue;
+
+        std::vector<HAPI_StringHandle> name_handles(name_count);
+        HOUDINI_CHECK_ERROR_RETURN(
+            HoudiniApi::GetAttributeNames(
+                session, geo_info.nodeId, part_info.id, owner,
+                name_handles.data(), name_count), false);
+
+        std::vector<std::string> names;
+        if (!HoudiniEngineUtility::getStrings(session, name_handles, names))
+            return false;
+
+        for (const std::string& name : names)
+        {
+            HAPI_AttributeInfo attrib_info;
+            HOUDINI_CHECK_ERROR_RETURN(
+                HoudiniApi::GetAttributeInfo(
+                    session, geo_info.nodeId, part_info.id,
+                    name.c_str(), owner, &attrib_info), false);
+
+            HoudiniEngineMeshAttribute attribute;
+            attribute.name = name;
+            attribute.owner = owner;
+            attribute.tupleSize = std::max(1, attrib_info.tupleSize);
+            const size_t value_count = (size_t)attrib_info.count * attribute.tupleSize;
+
+            // 32 bit integers are kept as they are, other numeric storages are converted to float.
+            // 64 bit integers would lose precision either way, so they are skipped like arrays.
+            switch (attrib_info.storage)
+            {
+                case HAPI_STORAGETYPE_FLOAT:
+                {
+                    attribute.values.resize(value_count);
+                    if (!readAttributeFloatDataChunked(
+                            session, geo_info.nodeId, part_info.id, name.c_str(), attrib_info, attribute.values.data()))
+                        return false;
+                    break;
+                }
+                case HAPI_STORAGETYPE_FLOAT64:
+                {
+                    std::vector<double> data(value_count);
+                    HOUDINI_CHECK_ERROR_RETURN(
+                        HoudiniApi::GetAttributeFloat64Data(
+                            session, geo_info.nodeId, part_info.id, name.c_str(), &attrib_info, -1,
+                            data.data(), 0, attrib_info.count), false);
+                    attribute.values.assign(data.begin(), data.end());
+                    break;
+                }
+                case HAPI_STORAGETYPE_INT:
+                {
+                    attribute.isInt = true;
+                    attribute.intValues.resize(value_count);
+                    HOUDINI_CHECK_ERROR_RETURN(
+                        HoudiniApi::GetAttributeIntData(
+                            session, geo_info.nodeId, part_info.id, name.c_str(), &attrib_info, -1,
+                            attribute.intValues.data(), 0, attrib_info.count), false);
+                    break;
+                }
+                case HAPI_STORAGETYPE_INT64:
+                {
+                    std::cout << "Skipping the 64 bit integer attribute " << name << std::endl;
+                    continue;
+                }
+                case HAPI_STORAGETYPE_STRING:
+                {
+                    HoudiniEngineStringColumn column;
+                    if (!readAttributeStringData(session, geo_info.nodeId, part_info.id, name.c_str(), attrib_info, column))
+                        return false;
+                    attribute.isString = true;
+                    attribute.strings = std::move(column.dictionary);
+                    attribute.indices = std::move(column.indices);
+                    break;
+                }
+                default:
+                    continue;
+            }
+
+            mesh.attributes.push_back(std::move(attribute));
+        }
+    }
+
+    return true;
+}
+
+bool
+HoudiniEngineGeometry::readMeshBgeoFromHoudini(const HAPI_Session * session, HAPI_NodeId node_id, HoudiniEngineMesh& mesh)
+{
+    HOUDINI_TRACE_SCOPE("readMeshBgeoFromHoudini");
+
+    HAPI_GeoInfo geo_info;
+    HOUDINI_CHECK_ERROR_RETURN(
+        HoudiniApi::GetDisplayGeoInfo(session, node_id, &geo_info), false);
+
+    // GetGeoSize serializes the geometry, SaveGeoToMemory then copies it out in one transfer
+    int size = 0;
+    {
+        HOUDINI_TRACE_SCOPE("GetGeoSize");
+        HOUDINI_CHECK_ERROR_RETURN(
+            HoudiniApi::GetGeoSize(session, geo_info.nodeId, ".bgeo", &size), false);
+    }
+
+    std::vector<char> buffer(size);
+    {
+        HOUDINI_TRACE_SCOPE("SaveGeoToMemory");
+        HOUDINI_CHECK_ERROR_RETURN(
+            HoudiniApi::SaveGeoToMemory(session, geo_info.nodeId, buffer.data(), size), false);
+    }
+
+    HOUDINI_TRACE_SCOPE("decodeBgeo");
+    std::string error;
+    if (!HoudiniEngineBgeo::decode(buffer.data(), buffer.size(), mesh, error))
+    {
+        std::cerr << "Failed to decode the .bgeo geometry of node " << geo_info.nodeId << ": " << error << std::endl;
+        return false;
+    }
+
+    return true;
+}
+
+bool
+HoudiniEngineGeometry::getMeshCacheKey(const HAPI_Session * session, HAPI_NodeId node_id, uint64_t& key)
+{
+    HOUDINI_TRACE_SCOPE("getMeshCacheKey");
+
+    HAPI_NodeInfo node_info;
+    HOUDINI_CHECK_ERROR_RETURN(
+        HoudiniApi::GetNodeInfo(session, node_id, &node_info), false);
+
+    // Every value of each type in a single call
+    std::vector<int> int_values(node_info.parmIntValueCount);
+    if (!int_values.empty())
+    {
+        HOUDINI_CHECK_ERROR_RETURN(
+            HoudiniApi::GetParmIntValues(session, node_id, int_values.data(), 0, (int)int_values.size()), false);
+    }
+
+    std::vector<float> float_values(node_info.parmFloatValueCount);
+    if (!float_values.empty())
+    {
+        HOUDINI_CHECK_ERROR_RETURN(
+            HoudiniApi::GetParmFloatValues(session, node_id, float_values.data(), 0, (int)float_values.size()), false);
+    }
+
+    std::vector<std::string> string_values;
+    if (node_info.parmStringValueCount > 0)
+    {
+        std::vector<HAPI_StringHandle> handles(node_info.parmStringValueCount);
+        HOUDINI_CHECK_ERROR_RETURN(
+            HoudiniApi::GetParmStringValues(session, node_id, true, handles.data(), 0, (int)handles.size()), false);
+        if (!HoudiniEngineUtility::getStrings(session, handles, string_values))
+            return false;
+    }
+
+    key = hashBytes((const char*)int_values.data(), int_values.size() * sizeof(int));
+    key = hashBytes((const char*)float_values.data(), float_values.size() * sizeof(float), key);
+    for (const std::string& value : string_values)
+    {
+        // Hash the length too, so that the boundaries between strings count
+        const uint64_t length = value.size();
+        key = hashBytes((const char*)&length, sizeof(length), key);
+        key = hashBytes(value.data(), value.size(), key);
+    }
+
+    // The asset the node was instantiated from, when it is one
+    HAPI_AssetInfo asset_info;
+    if (HoudiniApi::GetAssetInfo(session, node_id, &asset_info) == HAPI_RESULT_SUCCESS)
+    {
+        const std::string op_name = HoudiniEngineUtility::getString(session, asset_info.fullOpNameSH);
+        key = hashBytes(op_name.c_str(), op_name.size() + 1, key);
+    }
+
+    // The geometry of each connected input, which covers everything upstream of it
+    for (int input = 0; input < node_info.inputCount; ++input)
+    {
+        HAPI_NodeId input_node_id = -1;
+        HOUDINI_CHECK_ERROR_RETURN(
+            HoudiniApi::QueryNodeInput(session, node_id, input, &input_node_id), false);
+
+        key = hashBytes((const char*)&input, sizeof(input), key);
+        if (input_node_id >= 0 && !hashDisplayGeometry(session, input_node_id, key))
+            return false;
+    }
+    return true;
+}
+
+bool
+HoudiniEngineGeometry::addMeshNormalsAndTangents(HoudiniEngineMesh& mesh)
+{
+    HOUDINI_TRACE_SCOPE("addMeshNormalsAndTangents");
+
+    const HoudiniEngineMeshAttribute* positions = mesh.findAttribute(HAPI_ATTROWNER_POINT, "P");
+    if (!positions || positions->isString || positions->isInt || positions->tupleSize != 3)
+        return false;
+
+    const HoudiniEngineMeshAttribute* normals = mesh.findAttribute(HAPI_ATTROWNER_POINT, "N");
+    std::vector<float> normal_values;
+    if (normals)
+    {
+        if (normals->isString || normals->isInt || normals->tupleSize != 3)
+            return false;
+        normal_values = normals->values;
+    }
+    else
+    {
+        if (!HoudiniEngineMeshProcessing::computeNormals(positions->values, mesh.faceCounts, mesh.vertexList, normal_values))
+            return false;
+    }
+
+    // Tangents follow vertex uvs, so point uvs are spread to the vertices first
+    std::vector<float> tangent_values;
+    auto isFloatUV = [](const HoudiniEngineMeshAttribute* uv)
+    {
+        return uv && !uv->isString && !uv->isInt && uv->tupleSize >= 2;
+    };
+    const HoudiniEngineMeshAttribute* uvs = mesh.findAttribute(HAPI_ATTROWNER_VERTEX, "uv");
+    const HoudiniEngineMeshAttribute* point_uvs = mesh.findAttribute(HAPI_ATTROWNER_POINT, "uv");
+    const bool add_tangents = !mesh.findAttribute(HAPI_ATTROWNER_VERTEX, "tangent") && (isFloatUV(uvs) || isFloatUV(point_uvs));
+    if (add_tangents)
+    {
+        std::vector<float> vertex_uvs;
+        int uv_tuple_size = 0;
+        if (isFloatUV(uvs))
+        {
+            vertex_uvs = uvs->values;
+            uv_tuple_size = uvs->tupleSize;
+        }
+        else
+        {
+            uv_tuple_size = point_uvs->tupleSize;
+            vertex_uvs.resize(mesh.vertexList.size() * uv_tuple_size);
+            for (size_t vertex = 0; vertex < mesh.vertexList.size(); ++vertex)
+            {
+                const int point = mesh.vertexList[vertex];
+                if (point < 0 || point >= mesh.pointCount)
+                    return false;
+                std::copy_n(point_uvs->values.begin() + (size_t)point * uv_tuple_size, uv_tuple_size,
+                            vertex_uvs.begin() + vertex * uv_tuple_size);
+            }
+        }
+
+        if (!HoudiniEngineMeshProcessing::computeTangents(positions->values, normal_values, vertex_uvs, uv_tuple_size,
+                                                          mesh.faceCounts, mesh.vertexList, tangent_values))
+            return false;
+    }
+
+    // Pointers into the attributes are not used past here, as adding to them may reallocate
+    if (!normals)
+    {
+        HoudiniEngineMeshAttribute attribute;
+        attribute.name = "N";
+        attribute.owner = HAPI_ATTROWNER_POINT;
+        attribute.tupleSize = 3;
+        attribute.values = std::move(normal_values);
+        mesh.attributes.push_back(std::move(attribute));
+    }
+    if (add_tangents)
+    {
+        HoudiniEngineMeshAttribute attribute;
+        attribute.name = "tangent";
+        attribute.owner = HAPI_ATTROWNER_VERTEX;
+        attribute.tupleSize = 4;
+        attribute.values = std::move(tangent_values);
+        mesh.attributes.push_back(std::move(attribute));
+    }
+    return true;
+}
+
+bool
+HoudiniEngineGeometry::readMeshCached(const HAPI_Session * session, HAPI_NodeId node_id, const std::string& cache_path, uint64_t key,
+                                      bool compress, HoudiniEngineMeshCache& cache)
+{
+    HOUDINI_TRACE_SCOPE("readMeshCached");
+
+    {
+        HOUDINI_TRACE_SCOPE("openMeshCache");
+        if (cache.open(cache_path) && cache.getKey() == key)
+            return true;
+        cache.close();
+    }
+
+    HoudiniEngineMesh mesh;
+    if (!readMeshFromHoudini(session, node_id, mesh))
+        return false;
+
+    // Cached along with the mesh, so that reopening the cache does not recompute them
+    if (!addMeshNormalsAndTangents(mesh))
+        std::cout << "No normals or tangents computed for the mesh cache " << cache_path << std::endl;
+
+    HOUDINI_TRACE_SCOPE("writeMeshCache");
+    if (!HoudiniEngineMeshCache::write(cache_path, mesh, key, compress) || !cache.open(cache_path))
+    {
+        std::cerr << "Failed to write the mesh cache " << cache_path << std::endl;
+        return false;
+    }
+    return true;
+}
+
+bool
+HoudiniEngineGeometry::sendMeshToHoudini(const HAPI_Session * session, HAPI_NodeId input_node_id, const HoudiniEngineMesh& mesh)
+{
+    HOUDINI_TRACE_SCOPE("sendMeshToHoudini");
+
+    HAPI_PartInfo part_info = HoudiniApi::PartInfo_Create();
+    part_info.type = HAPI_PARTTYPE_MESH;
+    part_info.faceCount = (int)mesh.faceCounts.size();
+    part_info.vertexCount = (int)mesh.vertexList.size();
+    part_info.pointCount = mesh.pointCount;
+
+    HOUDINI_CHECK_ERROR_RETURN(
+        HoudiniApi::SetPartInfo(session, input_node_id, 0, &part_info), false);
+
+    if (!mesh.faceCounts.empty())
+    {
+        HOUDINI_CHECK_ERROR_RETURN(
+            HoudiniApi::SetVertexList(session, input_node_id, 0, mesh.vertexList.data(), 0, part_info.vertexCount), false);
+
+        HOUDINI_CHECK_ERROR_RETURN(
+            HoudiniApi::SetFaceCounts(session, input_node_id, 0, mesh.faceCounts.data(), 0, part_info.faceCount), false);
+    }
+
+    for (const HoudiniEngineMeshAttribute& attribute : mesh.attributes)
+    {
+        HAPI_AttributeInfo attrib_info = HoudiniApi::AttributeInfo_Create();
+        attrib_info.count =
+            attribute.owner == HAPI_ATTROWNER_VERTEX ? part_info.vertexCount :
+            attribute.owner == HAPI_ATTROWNER_PRIM ? part_info.faceCount : part_info.pointCount;
+        attrib_info.tupleSize = attribute.tupleSize;
+        attrib_info.exists = true;
+        attrib_info.storage =
+            attribute.isString ? HAPI_STORAGETYPE_STRING :
+            attribute.isInt ? HAPI_STORAGETYPE_INT : HAPI_STORAGETYPE_FLOAT;
+        attrib_info.owner = attribute.owner;
+
+        HOUDINI_CHECK_ERROR_RETURN(
+            HoudiniApi::AddAttribute(session, input_node_id, 0, attribute.name.c_str(), &attrib_info), false);
+
+        if (attrib_info.count == 0)
+            continue;
+
+        if (attribute.isInt)
+        {
+            if (!setAttributeIntDataCompact(session, input_node_id, 0, attribute.name.c_str(), attrib_info, attribute.intValues.data()))
+                return false;
+            continue;
+        }
+
+        if (!attribute.isString)
+        {
+            if (!setAttributeFloatDataCompact(session, input_node_id, 0, attribute.name.c_str(), attrib_info, attribute.values.data()))
+                return false;
+            continue;
+        }
+
+        // String attributes are already dictionary encoded
+        std::vector<const char*> strings;
+        for (const std::string& string : attribute.strings)
+            strings.push_back(string.c_str());
+
+        HOUDINI_CHECK_ERROR_RETURN(
+            HoudiniApi::SetAttributeIndexedStringData(
+                session, input_node_id, 0, attribute.name.c_str(), &attrib_info,
+                strings.data(), (int)strings.size(),
+                attribute.indices.data(), 0, (int)attribute.indices.size()), false);
+    }
+
+    HOUDINI_CHECK_ERROR_RETURN(
+        HoudiniApi::CommitGeo(session, input_node_id), false);
+    return true;
+}
+
+bool
+HoudiniEngineGeometry::sendMeshBgeoToHoudini(const HAPI_Session * session, HAPI_NodeId input_node_id, const HoudiniEngineMesh& mesh)
+{
+    HOUDINI_TRACE_SCOPE("sendMeshBgeoToHoudini");
+
+    std::vector<char> buffer;
+    {
+        HOUDINI_TRACE_SCOPE("encodeBgeo");
+        HoudiniEngineBgeo::encode(mesh, buffer);
+    }
+
+    if (buffer.size() > (size_t)INT_MAX)
+    {
+        std::cerr << "The .bgeo geometry is too large for LoadGeoFromMemory (" << buffer.size() << " bytes)." << std::endl;
+        return false;
+    }
+
+    HOUDINI_TRACE_SCOPE("LoadGeoFromMemory");
+    HOUDINI_CHECK_ERROR_RETURN(
+        HoudiniApi::LoadGeoFromMemory(session, input_node_id, ".bgeo", buffer.data(), (int)buffer.size()), false);
+    return true;
+}
+
+bool
+HoudiniEngineGroup::contains(int index) const
+{
+    if (index < 0 || index >= elementCount)
+        return false;
+
+    if (!bits.empty())
+        return (bits[index >> 6] >> (index & 63)) & 1;
+
+    // Find the last run starting at or before the index
+    auto run = std::upper_bound(
+        ranges.begin(), ranges.end(), index,
+        [](int value, const std::pair<int, int>& range) { return value < range.first; });
+    if (run == ranges.begin())
+        return false;
+
+    --run;
+    return index < run->first + run->second;
+}
+
+// Encode a 0/1 membership array as runs, falling back to a bitset when that is smaller
+static void
+encodeGroupMembership(const std::vector<int>& membership, HoudiniEngineGroup& group)
+{
+    group.elementCount = (int)membership.size();
+    group.memberCount = 0;
+    group.bits.clear();
+    group.ranges.clear();
+
+    for (int i = 0; i < group.elementCount; )
+    {
+        if (!membership[i])
+        {
+            ++i;
+            continue;
+        }
+
+        int start = i;
+        while (i < group.elementCount && membership[i])
+            ++i;
+        group.ranges.emplace_back(start, i - start);
+        group.memberCount += i - start;
+    }
+
+    const size_t bitset_words = ((size_t)group.elementCount + 63) / 64;
+    if (group.ranges.size() * sizeof(std::pair<int, int>) <= bitset_words * sizeof(uint64_t))
+        return;
+
+    group.bits.assign(bitset_words, 0);
+    for (const std::pair<int, int>& range : group.ranges)
+    {
+        for (int i = range.first; i < range.first + range.second; ++i)
+            group.bits[i >> 6] |= uint64_t(1) << (i & 63);
+    }
+    group.ranges.clear();
+    group.ranges.shrink_to_fit();
+}
+
+bool
+HoudiniEngineGeometry::readGroupsFromHoudini(const HAPI_Session * session, const HAPI_GeoInfo& geo_info, const HAPI_PartInfo& part_info,
+                                             std::vector<HoudiniEngineGroup>& groups)
+{
+    groups.clear();
+
+    const std::pair<HAPI_GroupType, int> group_counts[] = {
+        { HAPI_GROUPTYPE_POINT, geo_info.pointGroupCount },
+        { HAPI_GROUPTYPE_PRIM, geo_info.primitiveGroupCount },
+        { HAPI_GROUPTYPE_EDGE, geo_info.edgeGroupCount } };
+
+    // Gather the names of all groups, resolving them in a single string batch
+    std::vector<HAPI_StringHandle> name_handles;
+    std::vector<HAPI_GroupType> group_types;
+    for (const std::pair<HAPI_GroupType, int>& group_count : group_counts)
+    {
+        if (group_count.second <= 0)
+            continue;
+
+        std::vector<HAPI_StringHandle> handles(group_count.second);
+        HOUDINI_CHECK_ERROR_RETURN(
+            HoudiniApi::GetGroupNames(
+                session, geo_info.nodeId, group_count.first, handles.data(), group_count.second), false);
+
+        name_handles.insert(name_handles.end(), handles.begin(), handles.end());
+        group_types.insert(group_types.end(), handles.size(), group_count.first);
+    }
+
+    std::vector<std::string> names;
+    if (!HoudiniEngineUtility::getStrings(session, name_handles, names))
+        return false;
+
+    // Fetch each membership in one call, encoding the previous ones while the next is in flight.
+    // At most one encoder per hardware thread runs at once; the oldest is waited on first.
+    groups.resize(names.size());
+    std::vector<std::vector<int>> memberships(names.size());
+    std::vector<std::future<void>> encoders;
+    const size_t max_encoders = std::max(1u, std::thread::hardware_concurrency());
+    size_t finished_encoders = 0;
+    for (size_t i = 0; i < names.size(); ++i)
+    {
+        HoudiniEngineGroup& group = groups[i];
+        group.name = names[i];
+        group.type = group_types[i];
+
+        int length = 0;
+        if (group.type == HAPI_GROUPTYPE_POINT)
+            length = part_info.pointCount;
+        else if (group.type == HAPI_GROUPTYPE_PRIM)
+            length = part_info.faceCount;
+        else
+        {
+            int edge_count = 0;
+            HOUDINI_CHECK_ERROR_RETURN(
+                HoudiniApi::GetEdgeCountOfEdgeGroup(
+                    session, geo_info.nodeId, part_info.id, group.name.c_str(), &edge_count), false);
+            length = edge_count * 2;
+        }
+
+        if (length <= 0)
+            continue;
+
+        std::vector<int>& membership = memberships[i];
+        membership.resize(length);
+        HAPI_Bool all_equal = false;
+        HOUDINI_CHECK_ERROR_RETURN(
+            HoudiniApi::GetGroupMembership(
+                session, geo_info.nodeId, part_info.id, group.type, group.name.c_str(),
+                &all_equal, membership.data(), 0, length), false);
+
+        if (group.type == HAPI_GROUPTYPE_EDGE)
+        {
+            group.edgePoints.swap(membership);
+            group.memberCount = length / 2;
+            continue;
+        }
+
+        if (encoders.size() - finished_encoders >= max_encoders)
+            encoders[finished_encoders++].get();
+
+        encoders.push_back(std::async(std::launch::async, [&group, &membership]()
+        {
+            encodeGroupMembership(membership, group);
+            std::vector<int>().swap(membership);
+        }));
+    }
+
+    for (size_t i = finished_encoders; i < encoders.size(); ++i)
+        encoders[i].get();
+
+    return true;
+}
+
+void
+HoudiniEngineGeometry::splitMeshByGroups(const std::vector<int>& face_counts, const std::vector<int>& vertex_list,
+                                         const std::vector<HoudiniEngineGroup>& groups, std::vector<HoudiniEngineMeshSplit>& splits)
+{
+    splits.clear();
+
+    // Offset of each face's first vertex, shared by all groups
+    std::vector<int> face_offsets(face_counts.size() + 1, 0);
+    for (size_t i = 0; i < face_counts.size(); ++i)
+        face_offsets[i + 1] = face_offsets[i] + face_counts[i];
+
+    std::vector<const HoudiniEngineGroup*> prim_groups;
+    for (const HoudiniEngineGroup& group : groups)
+    {
+        if (group.type == HAPI_GROUPTYPE_PRIM && group.elementCount == (int)face_counts.size())
+            prim_groups.push_back(&group);
+    }
+
+    // Each task splits a range of groups, with one task per hardware thread at most
+    splits.resize(prim_groups.size());
+    HoudiniEngineUtility::parallelFor((int64_t)prim_groups.size(), [&](int64_t begin, int64_t end)
+    {
+        for (int64_t i = begin; i < end; ++i)
+        {
+            const HoudiniEngineGroup& group = *prim_groups[i];
+            HoudiniEngineMeshSplit& split = splits[i];
+            split.name = group.name;
+            split.faceIndices.reserve(group.memberCount);
+            split.faceCounts.reserve(group.memberCount);
+
+            auto addFace = [&](int face)
+            {
+                split.faceIndices.push_back(face);
+                split.faceCounts.push_back(face_counts[face]);
+                split.vertexList.insert(
+                    split.vertexList.end(),
+                    vertex_list.begin() + face_offsets[face],
+                    vertex_list.begin() + face_offsets[face + 1]);
+            };
+
+            if (group.bits.empty())
+            {
+                for (const std::pair<int, int>& range : group.ranges)
+                {
+                    for (int face = range.first; face < range.first + range.second; ++face)
+                        addFace(face);
+                }
+            }
+            else
+            {
+                for (int face = 0; face < group.elementCount; ++face)
+                {
+                    if (group.contains(face))
+                        addFace(face);
+                }
+            }
+        }
+    }, 1);
+}
+
+bool
+HoudiniEngineGeometry::readMaterialBucketsFromHoudini(const HAPI_Session * session, const HAPI_GeoInfo& geo_info, const HAPI_PartInfo& part_info,
+                                                      HoudiniEngineMaterialBuckets& buckets)
+{
+    buckets = HoudiniEngineMaterialBuckets();
+    buckets.offsets.push_back(0);
+
+    const int face_count = part_info.faceCount;
+    if (face_count <= 0)
+        return true;
+
+    HAPI_Bool all_same = false;
+    std::vector<HAPI_NodeId> face_materials(face_count);
+    HOUDINI_CHECK_ERROR_RETURN(
+        HoudiniApi::GetMaterialNodeIdsOnFaces(
+            session, geo_info.nodeId, part_info.id, &all_same, face_materials.data(), 0, face_count), false);
+
+    if (all_same)
+    {
+        buckets.materials.push_back(face_materials[0]);
+        buckets.offsets.push_back(face_count);
+        buckets.faces.resize(face_count);
+        for (int i = 0; i < face_count; ++i)
+            buckets.faces[i] = i;
+    }
+    else
+    {
+        // Parallel counting sort: count per task, lay out the ranges, then scatter per task
+        const int task_count = std::max(1, std::min(
+            (int)std::max(1u, std::thread::hardware_concurrency()),
+            face_count / MATERIAL_SORT_MIN_FACES_PER_TASK));
+        const int faces_per_task = (face_count + task_count - 1) / task_count;
+
+        std::vector<std::unordered_map<HAPI_NodeId, int>> task_counts(task_count);
+        std::vector<std::future<void>> jobs;
+        for (int task = 0; task < task_count; ++task)
+        {
+            jobs.push_back(std::async(std::launch::async, [&, task]()
+            {
+                const int end = std::min(face_count, (task + 1) * faces_per_task);
+                for (int face = task * faces_per_task; face < end; ++face)
+                    ++task_counts[task][face_materials[face]];
+            }));
+        }
+        for (std::future<void>& job : jobs)
+            job.get();
+        jobs.clear();
+
+        std::map<HAPI_NodeId, int> material_indices;
+        for (const std::unordered_map<HAPI_NodeId, int>& counts : task_counts)
+        {
+            for (const std::pair<const HAPI_NodeId, int>& count : counts)
+                material_indices.emplace(count.first, 0);
+        }
+
+        // Each task writes its faces of a material after those of the previous tasks
+        std::vector<std::vector<int>> task_offsets(task_count, std::vector<int>(material_indices.size()));
+        int offset = 0;
+        for (std::pair<const HAPI_NodeId, int>& material : material_indices)
+        {
+            material.second = (int)buckets.materials.size();
+            buckets.materials.push_back(material.first);
+            for (int task = 0; task < task_count; ++task)
+            {
+                task_offsets[task][material.second] = offset;
+                auto count = task_counts[task].find(material.first);
+                if (count != task_counts[task].end())
+                    offset += count->second;
+            }
+            buckets.offsets.push_back(offset);
+        }
+
+        buckets.faces.resize(face_count);
+        for (int task = 0; task < task_count; ++task)
+        {
+            jobs.push_back(std::async(std::launch::async, [&, task]()
+            {
+                std::vector<int>& next = task_offsets[task];
+                const int end = std::min(face_count, (task + 1) * faces_per_task);
+                for (int face = task * faces_per_task; face < end; ++face)
+                    buckets.faces[next[material_indices.at(face_materials[face])]++] = face;
+            }));
+        }
+        for (std::future<void>& job : jobs)
+            job.get();
+    }
+
+    // Fetch the infos of materials not yet cached, or of all of them if the materials changed
+    std::unique_lock<std::mutex> lock(theMaterialInfoMutex);
+    std::unordered_map<HAPI_NodeId, HAPI_MaterialInfo>& material_infos =
+        theMaterialInfoCache[{ (int)session->type, session->id }];
+    lock.unlock();
+
+    for (HAPI_NodeId material : buckets.materials)
+    {
+        HAPI_MaterialInfo material_info{};
+        material_info.nodeId = material;
+
+        lock.lock();
+        auto cached = material_infos.find(material);
+        bool is_cached = cached != material_infos.end();
+        if (is_cached)
+            material_info = cached->second;
+        lock.unlock();
+
+        if (material >= 0 && (!is_cached || geo_info.hasMaterialChanged))
+        {
+            HOUDINI_CHECK_ERROR_RETURN(
+                HoudiniApi::GetMaterialInfo(session, material, &material_info), false);
+
+            lock.lock();
+            material_infos[material] = material_info;
+            lock.unlock();
+        }
+
+        buckets.materialInfos.push_back(material_info);
+    }
+
+    return true;
+}
+
+bool
+HoudiniEngineGeometry::readTexturesFromHoudini(const HAPI_Session * session, HAPI_NodeId node_id,
+                                               const std::vector<std::string>& texture_parms, const char* image_format,
+                                               HoudiniEngineTextures& textures)
+{
+    HOUDINI_TRACE_SCOPE("readTexturesFromHoudini");
+
+    HAPI_GeoInfo geo_info;
+    HOUDINI_CHECK_ERROR_RETURN(
+        HoudiniApi::GetDisplayGeoInfo(session, node_id, &geo_info), false);
+
+    // Materials shared by several parts are extracted once
+    std::vector<HAPI_MaterialInfo> material_infos;
+    std::unordered_set<HAPI_NodeId> seen_materials;
+    for (int part_id = 0; part_id < geo_info.partCount; ++part_id)
+    {
+        HAPI_PartInfo part_info;
+        HOUDINI_CHECK_ERROR_RETURN(
+            HoudiniApi::GetPartInfo(session, geo_info.nodeId, part_id, &part_info), false);
+
+        if (part_info.type != HAPI_PARTTYPE_MESH)
+            continue;
+
+        HoudiniEngineMaterialBuckets buckets;
+        if (!readMaterialBucketsFromHoudini(session, geo_info, part_info, buckets))
+            return false;
+
+        for (const HAPI_MaterialInfo& material_info : buckets.materialInfos)
+        {
+            if (seen_materials.insert(material_info.nodeId).second)
+                material_infos.push_back(material_info);
+        }
+    }
+
+    return extractTexturesFromHoudini(session, material_infos, texture_parms, image_format, textures);
+}
+
+bool
+HoudiniEngineGeometry::extractTexturesFromHoudini(const HAPI_Session * session, const std::vector<HAPI_MaterialInfo>& material_infos,
+                                                  const std::vector<std::string>& texture_parms, const char* image_format,
+                                                  HoudiniEngineTextures& textures)
+{
+    textures = HoudiniEngineTextures();
+
+    // Extracted images, hashed on worker threads while the next texture renders
+    std::vector<std::vector<char>> extracted;
+    std::vector<std::future<uint64_t>> hashes;
+    for (const HAPI_MaterialInfo& material_info : material_infos)
+    {
+        if (!material_info.exists)
+            continue;
+
+        for (const std::string& parm_name : texture_parms)
+        {
+            // Materials only have some of the texture parameters
+            HAPI_ParmId parm_id = -1;
+            if (HoudiniApi::GetParmIdFromName(session, material_info.nodeId, parm_name.c_str(), &parm_id) != HAPI_RESULT_SUCCESS ||
+                parm_id < 0)
+                continue;
+
+            if (HoudiniApi::RenderTextureToImage(session, material_info.nodeId, parm_id) != HAPI_RESULT_SUCCESS)
+                continue;
+
+            HAPI_ImageInfo image_info;
+            HOUDINI_CHECK_ERROR_RETURN(
+                HoudiniApi::GetImageInfo(session, material_info.nodeId, &image_info), false);
+
+            int buffer_size = 0;
+            HOUDINI_CHECK_ERROR_RETURN(
+                HoudiniApi::ExtractImageToMemory(
+                    session, material_info.nodeId, image_format, "C A", &buffer_size), false);
+
+            std::vector<char> buffer(buffer_size);
+            HOUDINI_CHECK_ERROR_RETURN(
+                HoudiniApi::GetImageMemoryBuffer(session, material_info.nodeId, buffer.data(), buffer_size), false);
+
+            HoudiniEngineTexture texture;
+            texture.materialNode = material_info.nodeId;
+            texture.parmName = parm_name;
+            texture.xRes = image_info.xRes;
+            texture.yRes = image_info.yRes;
+            textures.textures.push_back(texture);
+
+            // Moving the buffer into the list keeps its storage in place for the hashing task
+            const char* image_data = buffer.data();
+            extracted.push_back(std::move(buffer));
+            hashes.push_back(std::async(std::launch::async, [image_data, buffer_size]()
+            {
+                return hashBytes(image_data, buffer_size);
+            }));
+        }
+    }
+
+    // Keep the first image of each content hash
+    std::unordered_map<uint64_t, int> image_indices;
+    for (size_t i = 0; i < extracted.size(); ++i)
+    {
+        uint64_t hash = hashes[i].get();
+        auto image = image_indices.find(hash);
+        if (image != image_indices.end() && textures.images[image->second] == extracted[i])
+        {
+            textures.textures[i].imageIndex = image->second;
+            continue;
+        }
+
+        textures.textures[i].imageIndex = (int)textures.images.size();
+        image_indices.emplace(hash, textures.textures[i].imageIndex);
+        textures.images.push_back(std::move(extracted[i]));
+        textures.imageHashes.push_back(hash);
+    }
+
+    return true;
+}
+
+void
+HoudiniEngineGeometry::clearSessionCaches(const HAPI_Session * session)
+{
+    if (!session)
+        return;
+
+    const std::pair<int, HAPI_SessionId> session_key((int)session->type, session->id);
+    {
+        std::lock_guard<std::mutex> lock(theMeshPartMutex);
+        for (auto part = theMeshPartCache.begin(); part != theMeshPartCache.end();)
+        {
+            if (std::get<0>(part->first) == session_key.first && std::get<1>(part->first) == session_key.second)
+                part = theMeshPartCache.erase(part);
+            else
+                ++part;
+        }
+    }
+    {
+        std::lock_guard<std::mutex> lock(theMaterialInfoMutex);
+        theMaterialInfoCache.erase(session_key);
+    }
+    {
+        std::lock_guard<std::mutex> lock(theInputMeshNetworkMutex);
+        theInputMeshNetworks.erase(session_key);
+    }
+}
+
+void
+HoudiniEngineGeometry::clearNodeCaches(const HAPI_Session * session, HAPI_NodeId node_id)
+{
+    if (!session)
+        return;
+
+    // Parts are cached under the SOP node holding the geometry, which an object node only knows
+    // while it exists
+    HAPI_NodeId geo_node_id = node_id;
+    HAPI_GeoInfo geo_info;
+    if (HoudiniApi::GetDisplayGeoInfo(session, node_id, &geo_info) == HAPI_RESULT_SUCCESS)
+        geo_node_id = geo_info.nodeId;
+
+    std::lock_guard<std::mutex> lock(theMeshPartMutex);
+    for (auto part = theMeshPartCache.begin(); part != theMeshPartCache.end();)
+    {
+        const HAPI_NodeId part_node_id = std::get<2>(part->first);
+        if (std::get<0>(part->first) == (int)session->type && std::get<1>(part->first) == session->id &&
+            (part_node_id == node_id || part_node_id == geo_node_id))
+            part = theMeshPartCache.erase(part);
+        else
+            ++part;
+    }
+}
+
+long long
+HoudiniEngineGeometry::getTransferChunkBytes(const HAPI_Session * session)
+{
+    if (!session)
+        return TransferChunkTuner().chunkBytes;
+
+    std::lock_guard<std::mutex> lock(theTransferChunkMutex);
+    return theTransferChunkTuners[{ (int)session->type, session->id }].chunkBytes;
+}
+
+bool
+HoudiniEngineGeometry::readAttributeFloatDataChunked(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id,
+                                                     const char* attrib_name, const HAPI_AttributeInfo& attrib_info, float* data,
+                                                     const std::function<void(int start, int length)>& process_chunk)
+{
+    HOUDINI_TRACE_SCOPE("GetAttributeFloatData");
+
+    const int tuple_size = std::max(1, attrib_info.tupleSize);
+    const int element_bytes = tuple_size * (int)sizeof(float);
+
+    // Fetch [start, start + length) and feed its timing back to the tuner
+    auto fetchChunk = [=](int start, int length)
+    {
+        HAPI_AttributeInfo chunk_info = attrib_info;
+        auto begin = std::chrono::steady_clock::now();
+        HAPI_Result result = HoudiniApi::GetAttributeFloatData(
+            session, node_id, part_id, attrib_name, &chunk_info, -1,
+            data + (size_t)start * tuple_size, start, length);
+        auto end = std::chrono::steady_clock::now();
+
+        recordTransferChunk(session, (long long)length * element_bytes, std::chrono::duration<double>(end - begin).count());
+        return result;
+    };
+
+    auto nextLength = [&](int start)
+    {
+        return std::min(getTransferChunkElements(session, element_bytes), attrib_info.count - start);
+    };
+
+    if (!process_chunk)
+    {
+        for (int start = 0; start < attrib_info.count; )
+        {
+            const int length = nextLength(start);
+            HOUDINI_CHECK_ERROR_RETURN(fetchChunk(start, length), false);
+            start += length;
+        }
+        return true;
+    }
+
+    // Keep one fetch in flight while the previous chunk is processed
+    int start = 0;
+    int length = nextLength(start);
+    std::future<HAPI_Result> pending = std::async(std::launch::async, fetchChunk, start, length);
+    while (start < attrib_info.count)
+    {
+        HOUDINI_CHECK_ERROR_RETURN(pending.get(), false);
+
+        const int next_start = start + length;
+        int next_length = 0;
+        if (next_start < attrib_info.count)
+        {
+            next_length = nextLength(next_start);
+            pending = std::async(std::launch::async, fetchChunk, next_start, next_length);
+        }
+
+        process_chunk(start, length);
+        start = next_start;
+        length = next_length;
+    }
+
+    return true;
+}
+
+bool
+HoudiniEngineGeometry::readAttributeStringData(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id,
+                                               const char* attrib_name, const HAPI_AttributeInfo& attrib_info,
+                                               HoudiniEngineStringColumn& column)
+{
+    HOUDINI_TRACE_SCOPE("GetAttributeStringData");
+
+    const int value_count = attrib_info.count * std::max(1, attrib_info.tupleSize);
+    std::vector<HAPI_StringHandle> handles(value_count);
+
+    HAPI_AttributeInfo string_info = attrib_info;
+    HOUDINI_CHECK_ERROR_RETURN(
+        HoudiniApi::GetAttributeStringData(
+            session, node_id, part_id, attrib_name, &string_info,
+            handles.data(), 0, attrib_info.count), false);
+
+    // Deduplicate handles on the host, so only unique strings cross the session
+    std::unordered_map<HAPI_StringHandle, int> handle_index;
+    std::vector<HAPI_StringHandle> unique_handles;
+    column.indices.resize(value_count);
+    for (int i = 0; i < value_count; ++i)
+    {
+        auto entry = handle_index.emplace(handles[i], (int)unique_handles.size());
+        if (entry.second)
+            unique_handles.push_back(handles[i]);
+        column.indices[i] = entry.first->second;
+    }
+
+    if (!HoudiniEngineUtility::getStrings(session, unique_handles, column.dictionary))
+
+        return false;
+
+    return true;
+}
+
+bool
+HoudiniEngineGeometry::writeAttributeFloatDataChunked(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id,
+                                                      const char* attrib_name, const HAPI_AttributeInfo& attrib_info, const float* data)
+{
+    HOUDINI_TRACE_SCOPE("SetAttributeFloatData");
+
+    const int tuple_size = std::max(1, attrib_info.tupleSize);
+    const int element_bytes = tuple_size * (int)sizeof(float);
+
+    for (int start = 0; start < attrib_info.count; )
+    {
+        const int length = std::min(getTransferChunkElements(session, element_bytes), attrib_info.count - start);
+
+        auto begin = std::chrono::steady_clock::now();
+        HOUDINI_CHECK_ERROR_RETURN(
+            HoudiniApi::SetAttributeFloatData(
+                session, node_id, part_id, attrib_name, &attrib_info,
+                data + (size_t)start * tuple_size, start, length), false);
+        auto end = std::chrono::steady_clock::now();
+
+        recordTransferChunk(session, (long long)length * element_bytes, std::chrono::duration<double>(end - begin).count());
+        start += length;
+    }
+
+    return true;
+}
+
+bool
+HoudiniEngineGeometry::setAttributeFloatDataCompact(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id,
+                                                    const char* attrib_name, const HAPI_AttributeInfo& attrib_info, const float* data)
+{
+    if (attrib_info.count > 1 && isUniformAttribute(data, attrib_info.count, attrib_info.tupleSize))
+    {
+        HOUDINI_CHECK_ERROR_RETURN(
+            HoudiniApi::SetAttributeFloatUniqueData(
+                session, node_id, part_id, attrib_name, &attrib_info,
+                data, attrib_info.tupleSize, 0, attrib_info.count), false);
+        return true;
+    }
+
+    return writeAttributeFloatDataChunked(session, node_id, part_id, attrib_name, attrib_info, data);
+}
+
+bool
+HoudiniEngineGeometry::setAttributeIntDataCompact(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id,
+                                                  const char* attrib_name, const HAPI_AttributeInfo& attrib_info, const int* data)
+{
+    if (attrib_info.count > 1 && isUniformAttribute(data, attrib_info.count, attrib_info.tupleSize))
+    {
+        HOUDINI_CHECK_ERROR_RETURN(
+            HoudiniApi::SetAttributeIntUniqueData(
+                session, node_id, part_id, attrib_name, &attrib_info,
+                data, attrib_info.tupleSize, 0, attrib_info.count), false);
+        return true;
+    }
+
+    HOUDINI_CHECK_ERROR_RETURN(
+        HoudiniApi::SetAttributeIntData(
+            session, node_id, part_id, attrib_name, &attrib_info,
+            data, 0, attrib_info.count), false);
+    return true;
+}
+
+bool
+HoudiniEngineGeometry::setAttributeStringDataCompact(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id,
+                                                     const char* attrib_name, const HAPI_AttributeInfo& attrib_info,
+                                                     const std::vector<std::string>& data)
+{
+    const int value_count = (int)data.size();
+    if (value_count == 0)
+        return true;
+
+    // Dictionary-encode the column: unique strings in order of first use, plus indices
+    std::unordered_map<std::string, int> dictionary_index;
+    std::vector<const char*> dictionary;
+    std::vector<int> indices(value_count);
+    for (int i = 0; i < value_count; ++i)
+    {
+        auto entry = dictionary_index.emplace(data[i], (int)dictionary.size());
+        if (entry.second)
+            dictionary.push_back(entry.first->first.c_str());
+        indices[i] = entry.first->second;
+    }
+
+    if (dictionary.size() == 1 && attrib_info.tupleSize == 1)
+    {
+        HOUDINI_CHECK_ERROR_RETURN(
+            HoudiniApi::SetAttributeStringUniqueData(
+                session, node_id, part_id, attrib_name, &attrib_info,
+                dictionary[0], attrib_info.tupleSize, 0, attrib_info.count), false);
+    }
+    else if (dictionary.size() < data.size())
+    {
+        HOUDINI_CHECK_ERROR_RETURN(
+            HoudiniApi::SetAttributeIndexedStringData(
+                session, node_id, part_id, attrib_name, &attrib_info,
+                dictionary.data(), (int)dictionary.size(),
+                indices.data(), 0, value_count), false);
+    }
+    else
+    {
+        // Every value is distinct, indices would only add overhead
+        std::vector<const char*> values(value_count);
+        for (int i = 0; i < value_count; ++i)
+            values[i] = data[i].c_str();
+
+        HOUDINI_CHECK_ERROR_RETURN(
+            HoudiniApi::SetAttributeStringData(
+                session, node_id, part_id, attrib_name, &attrib_info,
+                values.data(), 0, attrib_info.count), false);
+    }
+
+    return true;
+}
+
+bool
+HoudiniEngineGeometry::sendCurveToHoudini(const HAPI_Session * session, const HAPI_CookOptions * cook_options,
+                                          const float* positions, const float* rotations, const float* scales, int point_count,
+                                          HAPI_CurveType curve_type, int order, bool closed, HAPI_NodeId * curve_node)
+{
+    std::cout << "\nCreating input curve node 'input_Curve'..." << std::endl;
+    HOUDINI_CHECK_ERROR_RETURN(
+        HoudiniApi::CreateInputCurveNode(session, -1, curve_node, "Curve"), false);
+
+    HAPI_InputCurveInfo curve_info = HoudiniApi::InputCurveInfo_Create();
+    curve_info.curveType = curve_type;
+    curve_info.order = order;
+    curve_info.closed = closed;
+    curve_info.reverse = false;
+    curve_info.inputMethod = HAPI_CURVEMETHOD_CVS;
+    curve_info.breakpointParameterization = HAPI_CURVEPARAMETERIZATION_UNIFORM;
+    HOUDINI_CHECK_ERROR_RETURN(
+        HoudiniApi::SetInputCurveInfo(session, *curve_node, 0, &curve_info), false);
+
+    // All points are sent in a single call, rotations and scales included
+    std::cout << "  Setting " << point_count << " curve points" << std::endl;
+    HOUDINI_CHECK_ERROR_RETURN(
+        HoudiniApi::SetInputCurvePositionsRotationsScales(
+            session, *curve_node, 0,
+            positions, 0, point_count * 3,
+            rotations, 0, rotations ? point_count * 4 : 0,
+            scales, 0, scales ? point_count * 3 : 0), false);
+
+    HOUDINI_CHECK_ERROR_RETURN(
+        HoudiniApi::CookNode(session, *curve_node, cook_options), false);
+
+    return true;
+}
+
+bool
+HoudiniEngineGeometry::sendCurvesToHoudini(const HAPI_Session * session, const HAPI_CookOptions * cook_options,
+                                           const HoudiniEngineCurves& curves, HAPI_NodeId * input_node)
+{
+    const int curve_count = (int)curves.counts.size();
+    const int vertex_count = (int)curves.positions.size() / 3;
+
+    std::cout << "\nCreating geometry input node 'input_Curves' (" << curve_count << " curves)..." << std::endl;
+    HOUDINI_CHECK_ERROR_RETURN(
+        HoudiniApi::CreateInputNode(session, -1, input_node, "Curves"), false);
+
+    HAPI_PartInfo curve_part = HoudiniApi::PartInfo_Create();
+    curve_part.type = HAPI_PARTTYPE_CURVE;
+    curve_part.faceCount = curve_count;
+    curve_part.vertexCount = vertex_count;
+    curve_part.pointCount = vertex_count;
+    HOUDINI_CHECK_ERROR_RETURN(
+        HoudiniApi::SetPartInfo(session, *input_node, 0, &curve_part), false);
+
+    // Curves sharing one order only need it in the curve info
+    bool uniform_order = !curves.orders.empty() &&
+        std::all_of(curves.orders.begin(), curves.orders.end(),
+                    [&](int order) { return order == curves.orders[0]; });
+
+    HAPI_CurveInfo curve_info = HoudiniApi::CurveInfo_Create();
+    curve_info.curveType = curves.curveType;
+    curve_info.curveCount = curve_count;
+    curve_info.vertexCount = vertex_count;
+    curve_info.knotCount = (int)curves.knots.size();
+    curve_info.isPeriodic = curves.isPeriodic;
+    curve_info.isRational = false;
+    curve_info.isClosed = curves.isClosed;
+    curve_info.order = uniform_order ? curves.orders[0] : HAPI_CURVE_ORDER_VARYING;
+    curve_info.hasKnots = !curves.knots.empty();
+    HOUDINI_CHECK_ERROR_RETURN(
+        HoudiniApi::SetCurveInfo(session, *input_node, 0, &curve_info), false);
+
+    std::cout << "  Setting curve counts, orders and knots" << std::endl;
+    HOUDINI_CHECK_ERROR_RETURN(
+        HoudiniApi::SetCurveCounts(session, *input_node, 0, curves.counts.data(), 0, curve_count), false);
+
+    if (!uniform_order && !curves.orders.empty())
+        HOUDINI_CHECK_ERROR_RETURN(
+            HoudiniApi::SetCurveOrders(session, *input_node, 0, curves.orders.data(), 0, curve_count), false);
+
+    if (curve_info.hasKnots)
+        HOUDINI_CHECK_ERROR_RETURN(
+            HoudiniApi::SetCurveKnots(session, *input_node, 0, curves.knots.data(), 0, curve_info.knotCount), false);
+
+    std::cout << "  Setting position (P) point attributes" << std::endl;
+    HAPI_AttributeInfo point_info = HoudiniApi::AttributeInfo_Create();
+    point_info.count = vertex_count;
+    point_info.tupleSize = 3;
+    point_info.exists = true;
+    point_info.storage = HAPI_STORAGETYPE_FLOAT;
+    point_info.owner = HAPI_ATTROWNER_POINT;
+    HOUDINI_CHECK_ERROR_RETURN(
+        HoudiniApi::AddAttribute(session, *input_node, 0, "P", &point_info), false);
+
+    if (!setAttributeFloatDataCompact(session, *input_node, 0, "P", point_info, curves.positions.data()))
+        return false;
+
+    std::cout << "Sending curves to the Houdini cook engine" << std::endl;
+    HOUDINI_CHECK_ERROR_RETURN(
+        HoudiniApi::CommitGeo(session, *input_node), false);
+
+    HOUDINI_CHECK_ERROR_RETURN(
+        HoudiniApi::CookNode(session, *input_node, cook_options), false);
+
+    return true;
+}
+
+bool
+HoudiniEngineGeometry::readCurvesFromHoudini(const HAPI_Session * session, const HAPI_NodeId node_id, const HAPI_CookOptions * cook_options,
+                                             std::vector<HoudiniEngineCurves>& curve_parts)
+{
+    HOUDINI_CHECK_ERROR_RETURN(
+        HoudiniApi::CookNode(session, node_id, cook_options), false);
+
+    std::cout << "\nGetting curve info:" << std::endl;
+    HAPI_GeoInfo geo_info;
+    HOUDINI_CHECK_ERROR_RETURN(
+        HoudiniApi::GetDisplayGeoInfo(session, node_id, &geo_info), false);
+
+    curve_parts.clear();
+    for (int part_id = 0; part_id < geo_info.partCount; ++part_id)
+    {
+        HAPI_PartInfo part_info;
+        HOUDINI_CHECK_ERROR_RETURN(
+            HoudiniApi::GetPartInfo(session, geo_info.nodeId, part_id, &part_info), false);
+
+        if (part_info.type != HAPI_PARTTYPE_CURVE)
+            continue;
+
+        HAPI_CurveInfo curve_info;
+        HOUDINI_CHECK_ERROR_RETURN(
+            HoudiniApi::GetCurveInfo(session, geo_info.nodeId, part_info.id, &curve_info), false);
+
+        HoudiniEngineCurves curves;
+        curves.curveType = curve_info.curveType;
+        curves.isPeriodic = curve_info.isPeriodic;
+        curves.isClosed = curve_info.isClosed;
+
+        // Every curve of the part is fetched with a single ranged call per array
+        curves.counts.resize(curve_info.curveCount);
+        HOUDINI_CHECK_ERROR_RETURN(
+            HoudiniApi::GetCurveCounts(
+                session, geo_info.nodeId, part_info.id,
+                curves.counts.data(), 0, curve_info.curveCount), false);
+
+        if (curve_info.order != HAPI_CURVE_ORDER_VARYING && curve_info.order != HAPI_CURVE_ORDER_INVALID)
+        {
+            curves.orders.assign(curve_info.curveCount, curve_info.order);
+        }
+        else
+        {
+            curves.orders.resize(curve_info.curveCount);
+            HOUDINI_CHECK_ERROR_RETURN(
+                HoudiniApi::GetCurveOrders(
+                    session, geo_info.nodeId, part_info.id,
+                    curves.orders.data(), 0, curve_info.curveCount), false);
+        }
+
+        if (curve_info.hasKnots)
+        {
+            curves.knots.resize(curve_info.knotCount);
+            HOUDINI_CHECK_ERROR_RETURN(
+                HoudiniApi::GetCurveKnots(
+                    session, geo_info.nodeId, part_info.id,
+                    curves.knots.data(), 0, curve_info.knotCount), false);
+        }
+
+        HAPI_AttributeInfo p_info;
+        HOUDINI_CHECK_ERROR_RETURN(
+            HoudiniApi::GetAttributeInfo(
+                session, geo_info.nodeId, part_info.id,
+                "P", HAPI_ATTROWNER_POINT, &p_info), false);
+
+        curves.positions.resize((size_t)p_info.count * p_info.tupleSize);
+        HOUDINI_CHECK_ERROR_RETURN(
+            HoudiniApi::GetAttributeFloatData(
+                session, geo_info.nodeId, part_info.id,
+                "P", &p_info, -1,
+                curves.positions.data(), 0, p_info.count), false);
+
+        std::cout << "  Part " << part_info.id << ": " << curves.counts.size() << " curves, "
+                  << curve_info.vertexCount << " vertices" << std::endl;
+        curve_parts.push_back(std::move(curves));
+    }
+
+    if (curve_parts.empty())
+        std::cout << "  No curve parts found." << std::endl;
+
+    return true;
+}
+
+bool
+HoudiniEngineGeometry::sendHeightFieldToHoudini(const HAPI_Session * session, const HAPI_CookOptions * cook_options,
+                                                const char* name, int x_size, int y_size, float voxel_size,
+                                                const float* height_values, const float* mask_values,
+                                                const std::vector<HoudiniEngineHeightFieldLayerInput>& extra_layers,
+                                                HAPI_NodeId * output_node)
+{
+    if (!height_values || x_size <= 0 || y_size <= 0)
+    {
+        std::cerr << "Cannot send an empty heightfield." << std::endl;
+        return false;
+    }
+
+    std::cout << "\nCreating heightfield input node '" << name << "' (" << x_size << " x " << y_size << ")..." << std::endl;
+    HAPI_NodeId heightfield_node = -1;
+    HAPI_NodeId height_node = -1;
+    HAPI_NodeId mask_node = -1;
+    HAPI_NodeId merge_node = -1;
+    HOUDINI_CHECK_ERROR_RETURN(
+        HoudiniApi::CreateHeightFieldInput(
+            session, -1, name,
+            x_size, y_size, voxel_size,
+            HAPI_HEIGHTFIELD_SAMPLING_CENTER,
+            &heightfield_node, &height_node, &mask_node, &merge_node), false);
+
+    // All layers share the same 2D volume layout
+    HAPI_VolumeInfo volume_info = HoudiniApi::VolumeInfo_Create();
+    volume_info.type = HAPI_VOLUMETYPE_HOUDINI;
+    volume_info.xLength = x_size;
+    volume_info.yLength = y_size;
+    volume_info.zLength = 1;
+    volume_info.minX = 0;
+    volume_info.minY = 0;
+    volume_info.minZ = 0;
+    volume_info.tupleSize = 1;
+    volume_info.storage = HAPI_STORAGETYPE_FLOAT;
+    volume_info.tileSize = 1;
+    volume_info.hasTaper = false;
+    volume_info.transform = HAPI_Transform{};
+    volume_info.transform.rotationQuaternion[3] = 1.0f;
+    volume_info.transform.scale[0] = 0.5f * x_size * voxel_size;
+    volume_info.transform.scale[1] = 0.5f * y_size * voxel_size;
+    volume_info.transform.scale[2] = 0.5f * voxel_size;
+
+    const int sample_count = x_size * y_size;
+    const int rows_per_stripe = std::max(1, HEIGHTFIELD_STRIPE_SAMPLES / x_size);
+    const int stripe_samples = rows_per_stripe * x_size;
+
+    // Push a layer in stripes of whole rows, reading directly from the caller's buffer.
+    // A null buffer sends zeros from a single reusable stripe.
+    std::vector<float> zero_stripe;
+    auto setLayer = [&](HAPI_NodeId volume_node, const char* layer_name, const float* values)
+    {
+        HOUDINI_CHECK_ERROR_RETURN(
+            HoudiniApi::SetVolumeInfo(session, volume_node, 0, &volume_info), false);
+
+        if (!values && zero_stripe.empty())
+            zero_stripe.assign(std::min(stripe_samples, sample_count), 0.0f);
+
+        for (int start = 0; start < sample_count; start += stripe_samples)
+        {
+            const int length = std::min(stripe_samples, sample_count - start);
+            HOUDINI_CHECK_ERROR_RETURN(
+                HoudiniApi::SetHeightFieldData(
+                    session, volume_node, 0, layer_name,
+                    values ? values + start : zero_stripe.data(),
+                    start, length), false);
+        }
+
+        HOUDINI_CHECK_ERROR_RETURN(
+            HoudiniApi::CommitGeo(session, volume_node), false);
+
+        std::cout << "  Set heightfield layer '" << layer_name << "'" << std::endl;
+        return true;
+    };
+
+    if (!setLayer(height_node, "height", height_values))
+        return false;
+
+    if (!setLayer(mask_node, "mask", mask_values))
+        return false;
+
+    // Additional masks get their own volume node, merged after height (0) and mask (1)
+    int merge_input = 2;
+    for (const HoudiniEngineHeightFieldLayerInput& layer : extra_layers)
+    {
+        HAPI_NodeId layer_node = -1;
+        HOUDINI_CHECK_ERROR_RETURN(
+            HoudiniApi::CreateHeightfieldInputVolumeNode(
+                session, heightfield_node, &layer_node, layer.name,
+                x_size, y_size, voxel_size), false);
+
+        if (!setLayer(layer_node, layer.name, layer.values))
+            return false;
+
+        HOUDINI_CHECK_ERROR_RETURN(
+            HoudiniApi::ConnectNodeInput(session, merge_node, merge_input++, layer_node, 0), false);
+    }
+
+    std::cout << "Sending heightfield to the Houdini cook engine" << std::endl;
+    HOUDINI_CHECK_ERROR_RETURN(
+        HoudiniApi::CookNode(session, merge_node, cook_options), false);
+
+    int cook_status = HAPI_STATE_MAX;
+    HAPI_Result result;
+    do
+    {
+        result = HoudiniApi::GetStatus(session, HAPI_STATUS_COOK_STATE, &cook_status);
+    }
+    while (cook_status > HAPI_STATE_MAX_READY_STATE && result == HAPI_RESULT_SUCCESS);
+
+    HOUDINI_CHECK_ERROR_RETURN(result, false);
+
+    *output_node = merge_node;
+    return true;
+}
+
+bool
+HoudiniEngineGeometry::readHeightFieldFromHoudini(const HAPI_Session * session, const HAPI_NodeId node_id, const HAPI_CookOptions * cook_options,
+                                                  std::vector<HoudiniEngineHeightField>& layers)
+{
+    HOUDINI_CHECK_ERROR_RETURN(
+        HoudiniApi::CookNode(session, node_id, cook_options), false);
+
+    std::cout << "\nGetting heightfield info:" << std::endl;
+    HAPI_GeoInfo geo_info;
+    HOUDINI_CHECK_ERROR_RETURN(
+        HoudiniApi::GetDisplayGeoInfo(session, node_id, &geo_info), false);
+
+    layers.clear();
+    for (int part_id = 0; part_id < geo_info.partCount; ++part_id)
+    {
+        HAPI_PartInfo part_info;
+        HOUDINI_CHECK_ERROR_RETURN(
+            HoudiniApi::GetPartInfo(session, geo_info.nodeId, part_id, &part_info), false);
+
+        if (part_info.type != HAPI_PARTTYPE_VOLUME)
+            continue;
+
+        // Heightfields are flat, single-channel float volumes
+        HAPI_VolumeInfo volume_info;
+        HOUDINI_CHECK_ERROR_RETURN(
+            HoudiniApi::GetVolumeInfo(session, geo_info.nodeId, part_info.id, &volume_info), false);
+
+        if (volume_info.zLength != 1 || volume_info.tupleSize != 1 ||
+            volume_info.storage != HAPI_STORAGETYPE_FLOAT)
+            continue;
+
+        HoudiniEngineHeightField layer;
+        layer.name = HoudiniEngineUtility::getString(session, volume_info.nameSH);
+        layer.xSize = volume_info.xLength;
+        layer.ySize = volume_info.yLength;
+        layer.transform = volume_info.transform;
+        layer.values.resize((size_t)layer.xSize * layer.ySize);
+
+        // Pull whole rows at a time, straight into the destination grid
+        const int rows_per_stripe = std::max(1, HEIGHTFIELD_STRIPE_SAMPLES / std::max(1, layer.xSize));
+        for (int row = 0; row < layer.ySize; row += rows_per_stripe)
+        {
+            const int start = row * layer.xSize;
+            const int length = std::min(rows_per_stripe, layer.ySize - row) * layer.xSize;
+            HOUDINI_CHECK_ERROR_RETURN(
+                HoudiniApi::GetHeightFieldData(
+                    session,
+                    geo_info.nodeId,
+                    part_info.id,
+                    layer.values.data() + start,
+                    start, length
+                ),
+                false);
+        }
+
+        std::cout << "  Layer '" << layer.name << "': " << layer.xSize << " x " << layer.ySize << std::endl;
+        layers.push_back(std::move(layer));
+    }
+
+    if (layers.empty())
+        std::cout << "  No heightfield layers found." << std::endl;
+
+    return true;
+}
+
+void
+HoudiniEngineGeometry::buildHeightFieldLODs(const HoudiniEngineHeightField& layer, int tile_size, int lod_count,
+                                            std::vector<HoudiniEngineHeightFieldTile>& tiles)
+{
+    tiles.clear();
+    if (layer.xSize <= 0 || layer.ySize <= 0 || tile_size <= 0)
+        return;
+
+    int x_size = layer.xSize;
+    int y_size = layer.ySize;
+    std::vector<float> level = layer.values;
+
+    for (int lod = 0; lod < lod_count; ++lod)
+    {
+        // Cut the current level into tiles of (tile_size + 1)^2 samples so
+        // neighbouring tiles share their border and stitch without cracks
+        const int tiles_x = std::max(1, (x_size - 1 + tile_size - 1) / tile_size);
+        const int tiles_y = std::max(1, (y_size - 1 + tile_size - 1) / tile_size);
+        for (int ty = 0; ty < tiles_y; ++ty)
+        {
+            for (int tx = 0; tx < tiles_x; ++tx)
+            {
+                HoudiniEngineHeightFieldTile tile;
+                tile.lod = lod;
+                tile.tileX = tx;
+                tile.tileY = ty;
+                tile.xSize = tile_size + 1;
+                tile.ySize = tile_size + 1;
+                tile.values.resize((size_t)tile.xSize * tile.ySize);
+
+                for (int y = 0; y < tile.ySize; ++y)
+                {
+                    const int src_y = std::min(ty * tile_size + y, y_size - 1);
+                    for (int x = 0; x < tile.xSize; ++x)
+                    {
+                        const int src_x = std::min(tx * tile_size + x, x_size - 1);
+                        tile.values[(size_t)y * tile.xSize + x] = level[(size_t)src_y * x_size + src_x];
+                    }
+                }
+
+                tiles.push_back(std::move(tile));
+            }
+        }
+
+        if (x_size <= 1 && y_size <= 1)
+            break;
+
+        // Downsample by averaging 2x2 blocks, clamping at the odd edges
+        const int next_x = std::max(1, (x_size + 1) / 2);
+        const int next_y = std::max(1, (y_size + 1) / 2);
+        std::vector<float> next((size_t)next_x * next_y);
+        for (int y = 0; y < next_y; ++y)
+        {
+            const int y0 = std::min(y * 2, y_size - 1);
+            const int y1 = std::min(y * 2 + 1, y_size - 1);
+            for (int x = 0; x < next_x; ++x)
+            {
+                const int x0 = std::min(x * 2, x_size - 1);
+                const int x1 = std::min(x * 2 + 1, x_size - 1);
+                next[(size_t)y * next_x + x] = 0.25f * (
+                    level[(size_t)y0 * x_size + x0] + level[(size_t)y0 * x_size + x1] +
+                    level[(size_t)y1 * x_size + x0] + level[(size_t)y1 * x_size + x1]);
+            }
+        }
+
+        level.swap(next);
+        x_size = next_x;
+        y_size = next_y;
+    }
+}
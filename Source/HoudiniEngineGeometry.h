@@ -26,14 +26,300 @@
 
 #pragma once
 
+#include "HoudiniEngineMesh.h"
+#include "HoudiniEngineMeshCache.h"
+
 #include <HAPI/HAPI.h>
 
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <utility>
+#include <vector>
+
+// A single heightfield layer (height or mask) extracted from a 2D volume
+struct HoudiniEngineHeightField
+{
+    std::string name;
+    int xSize = 0;
+    int ySize = 0;
+    HAPI_Transform transform{};
+
+    // xSize * ySize samples, stored as ySize rows of xSize values
+    std::vector<float> values;
+};
+
+// A tile of a heightfield LOD pyramid, sharing its border samples with its neighbours
+struct HoudiniEngineHeightFieldTile
+{
+    int lod = 0;
+    int tileX = 0;
+    int tileY = 0;
+    int xSize = 0;
+    int ySize = 0;
+    std::vector<float> values;
+};
+
+// A caller-owned heightfield layer to send to Houdini; the values are not copied
+struct HoudiniEngineHeightFieldLayerInput
+{
+    const char* name = nullptr;
+
+    // xSize * ySize samples laid out as in HoudiniEngineHeightField
+    const float* values = nullptr;
+};
+
+// A caller-owned mesh to send to Houdini; the arrays are not copied
+struct HoudiniEngineMeshInput
+{
+    // 3 floats per point
+    int pointCount = 0;
+    const float* positions = nullptr;
+
+    // Vertices of each face, and the point of each vertex face after face
+    int faceCount = 0;
+    const int* faceCounts = nullptr;
+    const int* vertexList = nullptr;
+
+    // Optional 'name' of each face
+    const std::string* primNames = nullptr;
+};
+
+// A persistent input node. Each upload overwrites its geometry in place, and the topology
+// of the last upload is kept to detect updates where only the positions moved.
+struct HoudiniEngineInputNode
+{
+    // Created by the first upload when -1
+    HAPI_NodeId nodeId = -1;
+    std::string name;
+
+    // What was last committed to the node
+    bool committed = false;
+    int pointCount = 0;
+    std::vector<int> faceCounts;
+    std::vector<int> vertexList;
+    std::vector<std::string> primNames;
+};
+
+// All curves of a single part, stored as flat per-curve and per-vertex arrays
+struct HoudiniEngineCurves
+{
+    HAPI_CurveType curveType = HAPI_CURVETYPE_LINEAR;
+    bool isPeriodic = false;
+    bool isClosed = false;
+
+    // Number of vertices in each curve
+    std::vector<int> counts;
+
+    // Order of each curve
+    std::vector<int> orders;
+
+    // Knots of all curves back to back, empty if the curves have none
+    std::vector<float> knots;
+
+    // 3 floats per vertex, curve after curve
+    std::vector<float> positions;
+};
+
+// A string attribute column stored as its unique values plus one index per element
+struct HoudiniEngineStringColumn
+{
+    std::vector<std::string> dictionary;
+    std::vector<int> indices;
+};
+
+// A point, primitive or edge group of a part. Point and primitive memberships are kept
+// either as a bitset or as (start, length) runs of members, whichever is smaller.
+struct HoudiniEngineGroup
+{
+    std::string name;
+    HAPI_GroupType type = HAPI_GROUPTYPE_INVALID;
+
+    // Number of points or primitives the membership covers, and how many are members
+    int elementCount = 0;
+    int memberCount = 0;
+
+    std::vector<uint64_t> bits;
+    std::vector<std::pair<int, int>> ranges;
+
+    // Point index pairs, one pair per edge, for edge groups only
+    std::vector<int> edgePoints;
+
+    bool contains(int index) const;
+};
+
+// The faces of a mesh belonging to one primitive group. Vertices still index the
+// points of the source mesh, and faceIndices map back to its primitives.
+struct HoudiniEngineMeshSplit
+{
+    std::string name;
+    std::vector<int> faceIndices;
+    std::vector<int> faceCounts;
+    std::vector<int> vertexList;
+};
+
+// The faces of a part sorted by material into contiguous ranges: the faces of
+// materials[i] are faces[offsets[i]] .. faces[offsets[i + 1] - 1]
+struct HoudiniEngineMaterialBuckets
+{
+    std::vector<HAPI_NodeId> materials;
+    std::vector<HAPI_MaterialInfo> materialInfos;
+    std::vector<int> offsets;
+    std::vector<int> faces;
+};
+
+// A texture rendered from a material parameter; its encoded image is images[imageIndex]
+// of the owning HoudiniEngineTextures
+struct HoudiniEngineTexture
+{
+    HAPI_NodeId materialNode = -1;
+    std::string parmName;
+    int xRes = 0;
+    int yRes = 0;
+    int imageIndex = -1;
+};
+
+// Textures extracted in memory, sharing one image per distinct content hash
+struct HoudiniEngineTextures
+{
+    std::vector<HoudiniEngineTexture> textures;
+    std::vector<std::vector<char>> images;
+    std::vector<uint64_t> imageHashes;
+};
+
 class HoudiniEngineGeometry
 {
 public:
-    // Marshal a mesh (with position, colour, normal and uv data) to Houdini as input
-	static bool sendGeometryToHoudini(const HAPI_Session* session, const HAPI_CookOptions * cook_options, HAPI_NodeId * output_node);
+    // Marshal a cube mesh to Houdini as input, with colour and uv data added by SOPs after it. The
+    // top of the cube is rotated by twist radians, so repeated calls can animate a deformation.
+	static bool sendGeometryToHoudini(const HAPI_Session* session, const HAPI_CookOptions * cook_options, HAPI_NodeId * output_node,
+	                                  float twist = 0.0f);
+
+    // Write a mesh into a persistent input node and commit it. When the topology matches the
+    // last upload only P is rewritten; SetPartInfo, SetVertexList and SetFaceCounts are skipped.
+    static bool setInputMesh(const HAPI_Session* session, const HoudiniEngineMeshInput& mesh, HoudiniEngineInputNode& input_node);
 
     // Read mesh data from Houdini for processing
     static bool readGeometryFromHoudini(const HAPI_Session* session, const HAPI_NodeId node_id, const HAPI_CookOptions * cook_options);
+
+    // Read the first part of the node's display geometry with one ranged call per array and
+    // attribute. Float, int and string point, vertex and primitive attributes are read.
+    static bool readMeshFromHoudini(const HAPI_Session* session, HAPI_NodeId node_id, HoudiniEngineMesh& mesh);
+
+    // Read the node's display geometry as a single .bgeo blob (SaveGeoToMemory), decoded on the host
+    static bool readMeshBgeoFromHoudini(const HAPI_Session* session, HAPI_NodeId node_id, HoudiniEngineMesh& mesh);
+
+    // Identify what a node's geometry was cooked from, for keying a mesh cache: a hash of all of
+    // its parameter values, its asset and the counts, topology and positions of each input.
+    static bool getMeshCacheKey(const HAPI_Session* session, HAPI_NodeId node_id, uint64_t& key);
+
+    // Add unit point normals (N) and xyzw vertex tangents (tangent) computed on the host to a
+    // mesh that lacks them. Tangents need a uv attribute; point uvs are spread to the vertices.
+    static bool addMeshNormalsAndTangents(HoudiniEngineMesh& mesh);
+
+    // Open the mesh cache file of a node when it was written with the same key, without any call
+    // to Houdini. Otherwise read the mesh (readMeshFromHoudini), add its normals and tangents
+    // (addMeshNormalsAndTangents), write the file and open it.
+    static bool readMeshCached(const HAPI_Session* session, HAPI_NodeId node_id, const std::string& cache_path, uint64_t key,
+                               bool compress, HoudiniEngineMeshCache& cache);
+
+    // Write a mesh into an input node and commit it, with one call per array and attribute
+    static bool sendMeshToHoudini(const HAPI_Session* session, HAPI_NodeId input_node_id, const HoudiniEngineMesh& mesh);
+
+    // Write a mesh into an input node as a single .bgeo blob (LoadGeoFromMemory)
+    static bool sendMeshBgeoToHoudini(const HAPI_Session* session, HAPI_NodeId input_node_id, const HoudiniEngineMesh& mesh);
+
+    // Read the names and memberships of every point, primitive and edge group of a part
+    static bool readGroupsFromHoudini(const HAPI_Session* session, const HAPI_GeoInfo& geo_info, const HAPI_PartInfo& part_info,
+                                      std::vector<HoudiniEngineGroup>& groups);
+
+    // Split a mesh into one piece per primitive group, processing the groups in parallel
+    static void splitMeshByGroups(const std::vector<int>& face_counts, const std::vector<int>& vertex_list,
+                                  const std::vector<HoudiniEngineGroup>& groups, std::vector<HoudiniEngineMeshSplit>& splits);
+
+    // Bucket the faces of a part by material, with one GetMaterialNodeIdsOnFaces call per part.
+    // Material infos are cached per session and only refetched when the geometry's materials changed.
+    static bool readMaterialBucketsFromHoudini(const HAPI_Session* session, const HAPI_GeoInfo& geo_info, const HAPI_PartInfo& part_info,
+                                               HoudiniEngineMaterialBuckets& buckets);
+
+    // Render and extract the given texture parameters of each material into memory, in the
+    // given image format ("PNG", "JPEG", ...). Identical images are stored only once.
+    static bool extractTexturesFromHoudini(const HAPI_Session* session, const std::vector<HAPI_MaterialInfo>& material_infos,
+                                           const std::vector<std::string>& texture_parms, const char* image_format,
+                                           HoudiniEngineTextures& textures);
+
+    // Render and extract the given texture parameters of the materials on the mesh parts of the
+    // node's display geometry (readMaterialBucketsFromHoudini, then extractTexturesFromHoudini)
+    static bool readTexturesFromHoudini(const HAPI_Session* session, HAPI_NodeId node_id,
+                                        const std::vector<std::string>& texture_parms, const char* image_format,
+                                        HoudiniEngineTextures& textures);
+
+    // Read a float attribute in ranged chunks sized for the session's transport. When given,
+    // process_chunk(start, length) runs on each chunk while the next one is being fetched.
+    static bool readAttributeFloatDataChunked(const HAPI_Session* session, HAPI_NodeId node_id, HAPI_PartId part_id,
+                                              const char* attrib_name, const HAPI_AttributeInfo& attrib_info, float* data,
+                                              const std::function<void(int start, int length)>& process_chunk = nullptr);
+
+    // Read a string attribute, resolving each distinct string handle only once
+    static bool readAttributeStringData(const HAPI_Session* session, HAPI_NodeId node_id, HAPI_PartId part_id,
+                                        const char* attrib_name, const HAPI_AttributeInfo& attrib_info,
+                                        HoudiniEngineStringColumn& column);
+
+    // Write a float attribute in ranged chunks sized for the session's transport
+    static bool writeAttributeFloatDataChunked(const HAPI_Session* session, HAPI_NodeId node_id, HAPI_PartId part_id,
+                                               const char* attrib_name, const HAPI_AttributeInfo& attrib_info, const float* data);
+
+    // Upload a float attribute, sending a single tuple when every element shares it
+    static bool setAttributeFloatDataCompact(const HAPI_Session* session, HAPI_NodeId node_id, HAPI_PartId part_id,
+                                             const char* attrib_name, const HAPI_AttributeInfo& attrib_info, const float* data);
+
+    // Upload an int attribute, sending a single tuple when every element shares it
+    static bool setAttributeIntDataCompact(const HAPI_Session* session, HAPI_NodeId node_id, HAPI_PartId part_id,
+                                           const char* attrib_name, const HAPI_AttributeInfo& attrib_info, const int* data);
+
+    // Upload a string attribute as a single value when uniform, or as a dictionary of
+    // unique strings plus per-element indices when values repeat
+    static bool setAttributeStringDataCompact(const HAPI_Session* session, HAPI_NodeId node_id, HAPI_PartId part_id,
+                                              const char* attrib_name, const HAPI_AttributeInfo& attrib_info,
+                                              const std::vector<std::string>& data);
+
+    // Forget everything cached for a session (the parts read by readGeometryFromHoudini, material
+    // infos and the input mesh network), once it is closed or replaced. A later session can
+    // reuse its session and node ids.
+    static void clearSessionCaches(const HAPI_Session* session);
+
+    // Forget the parts cached for a node and its display geometry. Call it before deleting the node.
+    static void clearNodeCaches(const HAPI_Session* session, HAPI_NodeId node_id);
+
+    // Current auto-tuned chunk size for the session, in bytes
+    static long long getTransferChunkBytes(const HAPI_Session* session);
+
+    // Marshal a heightfield (height, optional mask and extra mask layers) to Houdini as input
+    static bool sendHeightFieldToHoudini(const HAPI_Session* session, const HAPI_CookOptions * cook_options,
+                                         const char* name, int x_size, int y_size, float voxel_size,
+                                         const float* height_values, const float* mask_values,
+                                         const std::vector<HoudiniEngineHeightFieldLayerInput>& extra_layers,
+                                         HAPI_NodeId * output_node);
+
+    // Marshal a single editable curve through an input curve node. Rotations (quaternions)
+    // and scales are optional and, when given, hold one entry per point.
+    static bool sendCurveToHoudini(const HAPI_Session* session, const HAPI_CookOptions * cook_options,
+                                   const float* positions, const float* rotations, const float* scales, int point_count,
+                                   HAPI_CurveType curve_type, int order, bool closed, HAPI_NodeId * curve_node);
+
+    // Marshal any number of curves to Houdini as a single curve part
+    static bool sendCurvesToHoudini(const HAPI_Session* session, const HAPI_CookOptions * cook_options,
+                                    const HoudiniEngineCurves& curves, HAPI_NodeId * input_node);
+
+    // Read the curve parts of the node's display geometry, one ranged call per array
+    static bool readCurvesFromHoudini(const HAPI_Session* session, const HAPI_NodeId node_id, const HAPI_CookOptions * cook_options,
+                                      std::vector<HoudiniEngineCurves>& curve_parts);
+
+    // Read every heightfield layer of the node's display geometry as a 2D float grid
+    static bool readHeightFieldFromHoudini(const HAPI_Session* session, const HAPI_NodeId node_id, const HAPI_CookOptions * cook_options,
+                                           std::vector<HoudiniEngineHeightField>& layers);
+
+    // Build a tiled LOD pyramid from a heightfield layer, halving the resolution at each level
+    static void buildHeightFieldLODs(const HoudiniEngineHeightField& layer, int tile_size, int lod_count,
+                                     std::vector<HoudiniEngineHeightFieldTile>& tiles);
 };
\ No newline at end of file
@@ -25,9 +25,14 @@
 */
 
 #include "HoudiniApi.h"
+#include "HoudiniEngineGeometry.h"
 #include "HoudiniEngineManager.h"
+#include "HoudiniEngineTrace.h"
 #include "HoudiniEngineUtility.h"
 
+#include <algorithm>
+#include <chrono>
+#include <fstream>
 #include <iostream>
 #include <vector>
 
@@ -37,12 +42,20 @@ HoudiniEngineManager::HoudiniEngineManager() : mySession{}, myCookOptions{}
 {
 }
 
+HoudiniEngineManager::~HoudiniEngineManager()
+{
+    cancelPdgCook();
+    stopStandby();
+}
+
 bool 
 HoudiniEngineManager::startSession(SessionType session_type,
                                    const std::string& named_pipe,
                                    int tcp_port,
                                    const std::string& shared_mem_name)
 {
+    HOUDINI_TRACE_SCOPE("startSession");
+
     // Only start a new Session if we dont already have a valid one
     if (HAPI_RESULT_SUCCESS == HoudiniApi::IsSessionValid(&mySession))
         return true;
@@ -50,16 +63,52 @@ HoudiniEngineManager::startSession(SessionType session_type,
     // Clear the connection error before starting a new session
     HoudiniApi::ClearConnectionError();
 
-    // Init the thrift server options
-    HAPI_ThriftServerOptions server_options = HoudiniApi::ThriftServerOptions_Create();
-    server_options.autoClose = true;
-    server_options.timeoutMs = 3000.0f;
+    // Cooks recorded on an earlier session say nothing about the nodes of this one
+    myCookRecords.clear();
 
     mySessionType = session_type;
     myNamedPipe = named_pipe;
     myTcpPort = tcp_port;
     mySharedMemoryName = shared_mem_name;
 
+    return createSession(&mySession, session_type, named_pipe, tcp_port, shared_mem_name,
+                         mySharedMemoryBufferType, mySharedMemoryBufferSize);
+}
+
+void
+HoudiniEngineManager::setSharedMemoryBuffer(HAPI_ThriftSharedMemoryBufferType buffer_type, HAPI_Int64 buffer_size)
+{
+    mySharedMemoryBufferType = buffer_type;
+    mySharedMemoryBufferSize = buffer_size;
+}
+
+bool
+HoudiniEngineManager::parseSharedMemoryBufferType(const std::string& name, HAPI_ThriftSharedMemoryBufferType& buffer_type)
+{
+    if (name == "fixed")
+        buffer_type = HAPI_THRIFT_SHARED_MEMORY_FIXED_LENGTH_BUFFER;
+    else if (name == "ring")
+        buffer_type = HAPI_THRIFT_SHARED_MEMORY_RING_BUFFER;
+    else
+        return false;
+
+    return true;
+}
+
+bool
+HoudiniEngineManager::createSession(HAPI_Session* session,
+                                    SessionType session_type,
+                                    const std::string& named_pipe,
+                                    int tcp_port,
+                                    const std::string& shared_mem_name,
+                                    HAPI_ThriftSharedMemoryBufferType shared_mem_buffer_type,
+                                    HAPI_Int64 shared_mem_buffer_size)
+{
+    // Init the thrift server options
+    HAPI_ThriftServerOptions server_options = HoudiniApi::ThriftServerOptions_Create();
+    server_options.autoClose = true;
+    server_options.timeoutMs = 3000.0f;
+
     HAPI_Result SessionResult = HAPI_RESULT_FAILURE;
     if (session_type == SessionType::InProcess)
     {
@@ -67,7 +116,7 @@ HoudiniEngineManager::startSession(SessionType session_type,
 
         // In-Process HAPI
 		HAPI_SessionInfo SessionInfo = HoudiniApi::SessionInfo_Create();
-        SessionResult = HoudiniApi::CreateInProcessSession(&mySession, &SessionInfo);
+        SessionResult = HoudiniApi::CreateInProcessSession(session, &SessionInfo);
     }
     else if (session_type == SessionType::NewNamedPipe)
     {
@@ -75,13 +124,13 @@ HoudiniEngineManager::startSession(SessionType session_type,
         std::cout << "Starting a named-pipe server...\n";
         HAPI_ProcessId process_id;
         HOUDINI_CHECK_ERROR(HoudiniApi::StartThriftNamedPipeServer(
-            &server_options, myNamedPipe.c_str(), &process_id, nullptr));
+            &server_options, named_pipe.c_str(), &process_id, nullptr));
 
         // Connect to the newly started server
         std::cout << "Connecting to the named-pipe session...\n";
 		HAPI_SessionInfo SessionInfo = HoudiniApi::SessionInfo_Create();
         SessionResult = HoudiniApi::CreateThriftNamedPipeSession(
-            &mySession, myNamedPipe.c_str(), &SessionInfo);
+            session, named_pipe.c_str(), &SessionInfo);
     }
     else if (session_type == SessionType::NewTCPSocket)
     {
@@ -89,34 +138,53 @@ HoudiniEngineManager::startSession(SessionType session_type,
         std::cout << "Starting a TCP socket server...\n";
         HAPI_ProcessId process_id;
         HOUDINI_CHECK_ERROR(HoudiniApi::StartThriftSocketServer(
-            &server_options, myTcpPort, &process_id, nullptr));
+            &server_options, tcp_port, &process_id, nullptr));
 
         // Connect to the newly started server
         std::cout << "Connecting to the TCP socket session...\n";
 		HAPI_SessionInfo SessionInfo = HoudiniApi::SessionInfo_Create();
         SessionResult = HoudiniApi::CreateThriftSocketSession(
-            &mySession, DEFAULT_HOST_NAME, myTcpPort, &SessionInfo);
+            session, DEFAULT_HOST_NAME, tcp_port, &SessionInfo);
+    }
+    else if (session_type == SessionType::NewSharedMemory)
+    {
+        // Start our server with the requested buffer
+        std::cout << "Starting a shared memory server...\n";
+        server_options.sharedMemoryBufferType = shared_mem_buffer_type;
+        server_options.sharedMemoryBufferSize = shared_mem_buffer_size;
+
+        HAPI_ProcessId process_id;
+        HOUDINI_CHECK_ERROR(HoudiniApi::StartThriftSharedMemoryServer(
+            &server_options, shared_mem_name.c_str(), &process_id, nullptr));
+
+        // Connect to the newly started server
+        std::cout << "Connecting to the shared memory session...\n";
+        HAPI_SessionInfo session_info = HoudiniApi::SessionInfo_Create();
+        session_info.sharedMemoryBufferType = shared_mem_buffer_type;
+        session_info.sharedMemoryBufferSize = shared_mem_buffer_size;
+        SessionResult = HoudiniApi::CreateThriftSharedMemorySession(
+            session, shared_mem_name.c_str(), &session_info);
     }
     else if (session_type == SessionType::ExistingNamedPipe)
     {
         std::cout << "Connecting to an existing HAPI named pipe session...\n";
 		HAPI_SessionInfo SessionInfo = HoudiniApi::SessionInfo_Create();
         SessionResult = HoudiniApi::CreateThriftNamedPipeSession(
-            &mySession, myNamedPipe.c_str(), &SessionInfo);
+            session, named_pipe.c_str(), &SessionInfo);
     }
     else if (session_type == SessionType::ExistingTCPSocket)
     {
         std::cout << "Connecting to an existing HAPI TCP socket session...\n";
 		HAPI_SessionInfo SessionInfo = HoudiniApi::SessionInfo_Create();
         SessionResult = HoudiniApi::CreateThriftSocketSession(
-            &mySession, DEFAULT_HOST_NAME, myTcpPort, &SessionInfo);
+            session, DEFAULT_HOST_NAME, tcp_port, &SessionInfo);
     }
     else if (session_type == SessionType::ExistingSharedMemory)
     {
         std::cout << "Connecting to an existing HAPI shared memory session...\n";
         HAPI_SessionInfo session_info = HoudiniApi::SessionInfo_Create();
         SessionResult = HoudiniApi::CreateThriftSharedMemorySession(
-            &mySession, mySharedMemoryName.c_str(), &session_info);
+            session, shared_mem_name.c_str(), &session_info);
     }
     else
     {
@@ -145,6 +213,16 @@ HoudiniEngineManager::stopSession()
 {
     std::cout << "\nCleaning up and closing session..." << std::endl;
 
+    cancelPdgCook();
+    stopStandby();
+
+    // A later session can reuse this one's ids
+    HoudiniEngineGeometry::clearSessionCaches(&mySession);
+    myCookRecords.clear();
+
+    // The nodes go with the session, so there is nothing left to replay
+    myNodeRecords.clear();
+
     if (HAPI_RESULT_SUCCESS == HoudiniApi::IsSessionValid(&mySession))
     {
         // SessionPtr is valid, clean up and close the session
@@ -162,10 +240,19 @@ HoudiniEngineManager::stopSession()
 }
 
 bool
-HoudiniEngineManager::restartSession(SessionType session_type, bool use_cooking_thread)
+HoudiniEngineManager::restartSession(SessionType session_type, bool use_cooking_thread,
+                                     std::map<HAPI_NodeId, HAPI_NodeId>* replayed_nodes)
 {
     std::cout << "Restarting the Houdini Engine session...\n";
 
+    // Swap in the warm standby rather than cold-starting a new session
+    if (myWarmStandby && session_type == mySessionType && failover(replayed_nodes))
+        return true;
+
+    // A cold start replays nothing
+    if (replayed_nodes)
+        replayed_nodes->clear();
+
     // Make sure we stop the current session if it is still valid
     bool bSuccess = false;
     stopSession();
@@ -184,6 +271,9 @@ HoudiniEngineManager::restartSession(SessionType session_type, bool use_cooking_
         else
         {
             bSuccess = true;
+
+            if (myWarmStandby)
+                startStandby();
         }
     }
 
@@ -193,6 +283,8 @@ HoudiniEngineManager::restartSession(SessionType session_type, bool use_cooking_
 bool
 HoudiniEngineManager::initializeHAPI(bool use_cooking_thread)
 {
+    HOUDINI_TRACE_SCOPE("initializeHAPI");
+
     // We need a Valid Session
     if (HAPI_RESULT_SUCCESS != HoudiniApi::IsSessionValid(getSession()))
     {
@@ -203,31 +295,11 @@ HoudiniEngineManager::initializeHAPI(bool use_cooking_thread)
     if (HoudiniApi::IsInitialized(getSession()) == HAPI_RESULT_NOT_INITIALIZED)
     {
         // Initialize HAPI
-        HAPI_CookOptions cook_options = HoudiniApi::CookOptions_Create();
-
-        cook_options.curveRefineLOD = 8.0f;
-        cook_options.clearErrorsAndWarnings = false;
-        cook_options.maxVerticesPerPrimitive = 3;
-        cook_options.splitGeosByGroup = false;
-        cook_options.refineCurveToLinear = true;
-        cook_options.handleBoxPartTypes = false;
-        cook_options.handleSpherePartTypes = false;
-        cook_options.splitPointsByVertexAttributes = false;
-        cook_options.packedPrimInstancingMode = HAPI_PACKEDPRIM_INSTANCING_MODE_FLAT;
-
-        HAPI_Result Result = HoudiniApi::Initialize(
-            getSession(),           // session
-            &cook_options,
-            use_cooking_thread,     // use_cooking_thread
-            -1,                     // cooking_thread_stack_size
-            "",                     // houdini_environment_files
-            nullptr,                // otl_search_path
-            nullptr,                // dso_search_path
-            nullptr,                // image_dso_search_path
-            nullptr                 // audio_dso_search_path
-        );
+        HAPI_CookOptions cook_options = createDefaultCookOptions();
+        HAPI_Result Result = initializeSession(getSession(), cook_options, use_cooking_thread);
 
         myCookOptions = cook_options;
+        myUseCookingThread = use_cooking_thread;
 
         if (Result == HAPI_RESULT_SUCCESS)
         {
@@ -245,10 +317,253 @@ HoudiniEngineManager::initializeHAPI(bool use_cooking_thread)
             return false;
         }
     }
+    else
+    {
+        // An existing session was initialized by someone else, with options we cannot query
+        myCookOptions = createDefaultCookOptions();
+        myUseCookingThread = use_cooking_thread;
+    }
+
+    // Built-in profiles, all derived from the session defaults
+    setCookProfile(DEFAULT_COOK_PROFILE, myCookOptions);
+
+    HAPI_CookOptions triangulated = myCookOptions;
+    triangulated.maxVerticesPerPrimitive = 3;
+    setCookProfile("triangulated", triangulated);
+
+    HAPI_CookOptions quads = myCookOptions;
+    quads.maxVerticesPerPrimitive = 4;
+    setCookProfile("quads", quads);
+
+    HAPI_CookOptions ngons = myCookOptions;
+    ngons.maxVerticesPerPrimitive = -1;
+    setCookProfile("ngons", ngons);
+
+    HAPI_CookOptions split_by_group = myCookOptions;
+    split_by_group.splitGeosByGroup = true;
+    setCookProfile("splitbygroup", split_by_group);
+
+    return true;
+}
+
+bool
+HoudiniEngineManager::enableWarmStandby(bool enable)
+{
+    if (!enable)
+    {
+        myWarmStandby = false;
+        stopStandby();
+        return true;
+    }
+
+    if (mySessionType != NewNamedPipe && mySessionType != NewTCPSocket && mySessionType != NewSharedMemory)
+    {
+        std::cout << "A warm standby is only available for sessions that start their own server." << std::endl;
+        return false;
+    }
+
+    myWarmStandby = true;
+    if (!myStandby.valid())
+        startStandby();
+
+    return true;
+}
+
+bool
+HoudiniEngineManager::checkSessionHealth(std::map<HAPI_NodeId, HAPI_NodeId>* replayed_nodes)
+{
+    if (HAPI_RESULT_SUCCESS == HoudiniApi::IsSessionValid(&mySession))
+        return true;
+
+    std::cout << "The Houdini Engine session is no longer valid." << std::endl;
+    if (!myWarmStandby)
+        return false;
+
+    return failover(replayed_nodes);
+}
+
+bool
+HoudiniEngineManager::captureNodeState(HAPI_NodeId node_id)
+{
+    auto record = myNodeRecords.find(node_id);
+    if (record == myNodeRecords.end())
+        return false;
+
+    int buffer_length = 0;
+    HOUDINI_CHECK_ERROR_RETURN(
+        HoudiniApi::GetPresetBufLength(getSession(), node_id, HAPI_PRESETTYPE_BINARY, nullptr, &buffer_length), false);
+
+    record->second.preset.resize(buffer_length);
+    HOUDINI_CHECK_ERROR_RETURN(
+        HoudiniApi::GetPreset(getSession(), node_id, record->second.preset.data(), buffer_length), false);
 
     return true;
 }
 
+void
+HoudiniEngineManager::startStandby()
+{
+    // Each standby gets its own server endpoint, derived from the original session's,
+    // so it can run alongside the current session
+    ++myStandbyCount;
+    SessionType session_type = mySessionType;
+    std::string named_pipe = myNamedPipe + "_standby" + std::to_string(myStandbyCount);
+    int tcp_port = myTcpPort + myStandbyCount;
+    std::string shared_mem_name = mySharedMemoryName + "_standby" + std::to_string(myStandbyCount);
+    HAPI_ThriftSharedMemoryBufferType shared_mem_buffer_type = mySharedMemoryBufferType;
+    HAPI_Int64 shared_mem_buffer_size = mySharedMemoryBufferSize;
+    bool use_cooking_thread = myUseCookingThread;
+    std::vector<std::string> asset_paths;
+    {
+        std::lock_guard<std::mutex> lock(myAssetPathsMutex);
+        asset_paths = myAssetPaths;
+    }
+
+    std::cout << "Warming up a standby Houdini Engine session..." << std::endl;
+    myStandby = std::async(std::launch::async, [=]()
+    {
+        StandbySession standby{ HAPI_Session{}, false };
+        if (!createSession(&standby.session, session_type, named_pipe, tcp_port, shared_mem_name,
+                           shared_mem_buffer_type, shared_mem_buffer_size))
+            return standby;
+
+        HAPI_Result result = initializeSession(&standby.session, createDefaultCookOptions(), use_cooking_thread);
+        if (result != HAPI_RESULT_SUCCESS && result != HAPI_RESULT_ALREADY_INITIALIZED)
+        {
+            HoudiniApi::CloseSession(&standby.session);
+            return standby;
+        }
+
+        // Load the same libraries as the current session so failover skips that too
+        for (const std::string& asset_path : asset_paths)
+        {
+            HAPI_AssetLibraryId asset_library_id = -1;
+            HOUDINI_CHECK_ERROR(
+                HoudiniApi::LoadAssetLibraryFromFile(&standby.session, asset_path.c_str(), false, &asset_library_id));
+        }
+
+        standby.valid = true;
+        return standby;
+    });
+}
+
+void
+HoudiniEngineManager::stopStandby()
+{
+    if (!myStandby.valid())
+        return;
+
+    StandbySession standby = myStandby.get();
+    if (standby.valid)
+    {
+        HoudiniApi::Cleanup(&standby.session);
+        HoudiniApi::CloseSession(&standby.session);
+    }
+}
+
+bool
+HoudiniEngineManager::failover(std::map<HAPI_NodeId, HAPI_NodeId>* replayed_nodes)
+{
+    if (!myStandby.valid())
+        return false;
+
+    // Waits only if the standby is still warming up
+    std::cout << "Failing over to the standby Houdini Engine session..." << std::endl;
+    StandbySession standby = myStandby.get();
+    if (!standby.valid || HAPI_RESULT_SUCCESS != HoudiniApi::IsSessionValid(&standby.session))
+    {
+        std::cout << "The standby session is not available." << std::endl;
+        startStandby();
+        return false;
+    }
+
+    // The PDG threads use the session through getSession(), stop them before it changes
+    cancelPdgCook();
+
+    // Swap the sessions in one step; pointers from getSession() stay valid
+    HoudiniEngineGeometry::clearSessionCaches(&mySession);
+    HAPI_Session failed_session = mySession;
+    mySession = standby.session;
+    myCookOptions = createDefaultCookOptions();
+    myCookRecords.clear();
+
+    if (HAPI_RESULT_SUCCESS == HoudiniApi::IsSessionValid(&failed_session))
+        HoudiniApi::Cleanup(&failed_session);
+    HoudiniApi::CloseSession(&failed_session);
+
+    // Recreate the tracked nodes with their last parameter state
+    std::map<HAPI_NodeId, NodeRecord> node_records;
+    node_records.swap(myNodeRecords);
+    bool success = true;
+    for (auto& record : node_records)
+    {
+        HAPI_NodeId node_id = -1;
+        HAPI_Result result = HoudiniApi::CreateNode(
+            getSession(), -1, record.second.operatorName.c_str(), record.second.label.c_str(), false, &node_id);
+        if (result != HAPI_RESULT_SUCCESS)
+        {
+            std::cout << "Failed to replay node " << record.second.operatorName << ": " << HoudiniEngineUtility::getLastError() << std::endl;
+            success = false;
+            continue;
+        }
+
+        if (!record.second.preset.empty())
+            HOUDINI_CHECK_ERROR(
+                HoudiniApi::SetPreset(
+                    getSession(), node_id, HAPI_PRESETTYPE_BINARY, nullptr,
+                    record.second.preset.data(), (int)record.second.preset.size()));
+
+        myNodeRecords[node_id] = std::move(record.second);
+
+        HOUDINI_CHECK_ERROR(HoudiniApi::CookNode(getSession(), node_id, getCookOptions()));
+        if (waitForCook())
+            recordCook(node_id, *getCookOptions());
+
+        if (replayed_nodes)
+            (*replayed_nodes)[record.first] = node_id;
+    }
+
+    std::cout << "Failover complete, replayed " << myNodeRecords.size() << " node(s)." << std::endl;
+
+    // Get the next spare ready
+    startStandby();
+    return success;
+}
+
+HAPI_CookOptions
+HoudiniEngineManager::createDefaultCookOptions()
+{
+    HAPI_CookOptions cook_options = HoudiniApi::CookOptions_Create();
+
+    cook_options.curveRefineLOD = 8.0f;
+    cook_options.clearErrorsAndWarnings = false;
+    cook_options.maxVerticesPerPrimitive = 3;
+    cook_options.splitGeosByGroup = false;
+    cook_options.refineCurveToLinear = true;
+    cook_options.handleBoxPartTypes = false;
+    cook_options.handleSpherePartTypes = false;
+    cook_options.splitPointsByVertexAttributes = false;
+    cook_options.packedPrimInstancingMode = HAPI_PACKEDPRIM_INSTANCING_MODE_FLAT;
+
+    return cook_options;
+}
+
+HAPI_Result
+HoudiniEngineManager::initializeSession(HAPI_Session* session, const HAPI_CookOptions& cook_options, bool use_cooking_thread)
+{
+    return HoudiniApi::Initialize(
+        session,                // session
+        &cook_options,
+        use_cooking_thread,     // use_cooking_thread
+        -1,                     // cooking_thread_stack_size
+        "",                     // houdini_environment_files
+        nullptr,                // otl_search_path
+        nullptr,                // dso_search_path
+        nullptr,                // image_dso_search_path
+        nullptr                 // audio_dso_search_path
+    );
+}
+
 HAPI_Session* 
 HoudiniEngineManager::getSession()
 {
@@ -261,9 +576,365 @@ HoudiniEngineManager::getCookOptions()
     return &myCookOptions;
 }
 
+void
+HoudiniEngineManager::setCookProfile(const std::string& profile, const HAPI_CookOptions& cook_options)
+{
+    myCookProfiles[profile] = cook_options;
+}
+
+HAPI_CookOptions*
+HoudiniEngineManager::getCookOptions(const std::string& profile)
+{
+    auto it = myCookProfiles.find(profile);
+    if (it == myCookProfiles.end())
+        return nullptr;
+
+    return &it->second;
+}
+
+bool
+HoudiniEngineManager::cookNode(HAPI_NodeId node_id, const std::string& profile, bool force)
+{
+    HAPI_CookOptions* cook_options = getCookOptions(profile);
+    if (!cook_options)
+    {
+        std::cout << "Unknown cook profile: " << profile << std::endl;
+        return false;
+    }
+
+    if (!force && isCookCurrent(node_id, *cook_options))
+    {
+        std::cout << "Skipping cook, the last result used equivalent options (" << profile << ")." << std::endl;
+        return true;
+    }
+
+    std::cout << "\nCooking node with the '" << profile << "' profile..." << std::endl;
+    {
+        HOUDINI_TRACE_SCOPE("CookNode");
+        HOUDINI_CHECK_ERROR_RETURN(
+            HoudiniApi::CookNode(getSession(), node_id, cook_options), false);
+    }
+
+    if (!waitForCook())
+    {
+        invalidateCook(node_id);
+        return false;
+    }
+
+    std::cout << "Cook complete." << std::endl;
+    recordCook(node_id, *cook_options);
+    return true;
+}
+
+bool
+HoudiniEngineManager::profileCook(HAPI_NodeId node_id, const std::string& profile, const std::string& hperf_path,
+                                  CookProfile* cook_profile)
+{
+    HAPI_CookOptions* cook_options = getCookOptions(profile);
+    if (!cook_options)
+    {
+        std::cout << "Unknown cook profile: " << profile << std::endl;
+        return false;
+    }
+
+    CookProfile timings;
+    timings.hperfPath = hperf_path;
+    timings.startTime = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+
+    // The capture title carries the host start time, to line it up with our timings
+    std::string title = "HoudiniEngineSample cook (" + profile + ") @" + std::to_string(timings.startTime);
+
+    auto start = std::chrono::steady_clock::now();
+    auto elapsed = [&start]()
+    {
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    };
+
+    int profile_id = -1;
+    HOUDINI_CHECK_ERROR_RETURN(
+        HoudiniApi::StartPerformanceMonitorProfile(getSession(), title.c_str(), &profile_id), false);
+
+    std::cout << "\nProfiling cook with the '" << profile << "' profile..." << std::endl;
+    bool cooked = HoudiniApi::CookNode(getSession(), node_id, cook_options) == HAPI_RESULT_SUCCESS;
+    timings.cookSubmitted = elapsed();
+    cooked = cooked && waitForCook();
+    timings.cookCompleted = elapsed();
+
+    HOUDINI_CHECK_ERROR_RETURN(
+        HoudiniApi::StopPerformanceMonitorProfile(getSession(), profile_id, hperf_path.c_str()), false);
+    timings.captureStopped = elapsed();
+
+    if (cooked)
+        recordCook(node_id, *cook_options);
+    else
+        invalidateCook(node_id);
+
+    std::ofstream timings_file(hperf_path + ".json");
+    timings_file << "{\n"
+                 << "  \"title\": \"" << HoudiniEngineUtility::escapeJson(title) << "\",\n"
+                 << "  \"hperf\": \"" << HoudiniEngineUtility::escapeJson(hperf_path) << "\",\n"
+                 << "  \"node\": " << node_id << ",\n"
+                 << "  \"start_time_ms\": " << timings.startTime << ",\n"
+                 << "  \"cook_submitted_ms\": " << timings.cookSubmitted << ",\n"
+                 << "  \"cook_completed_ms\": " << timings.cookCompleted << ",\n"
+                 << "  \"capture_stopped_ms\": " << timings.captureStopped << ",\n"
+                 << "  \"cooked\": " << (cooked ? "true" : "false") << "\n"
+                 << "}" << std::endl;
+
+    std::cout << "Cook " << (cooked ? "complete" : "failed") << " in " << timings.cookCompleted << " ms"
+              << " (submitted after " << timings.cookSubmitted << " ms), profile written to " << hperf_path << std::endl;
+
+    if (cook_profile)
+        *cook_profile = timings;
+
+    return cooked;
+}
+
+void
+HoudiniEngineManager::invalidateCook(HAPI_NodeId node_id)
+{
+    myCookRecords.erase(node_id);
+}
+
+void
+HoudiniEngineManager::recordCook(HAPI_NodeId node_id, const HAPI_CookOptions& cook_options)
+{
+    HAPI_NodeInfo node_info;
+    if (HoudiniApi::GetNodeInfo(getSession(), node_id, &node_info) != HAPI_RESULT_SUCCESS)
+    {
+        invalidateCook(node_id);
+        return;
+    }
+
+    // Only a node created by the manager without inputs can skip a cook, see isCookCurrent
+    uint64_t parm_key = 0;
+    if (node_info.inputCount == 0 && myNodeRecords.count(node_id) &&
+        HoudiniEngineGeometry::getMeshCacheKey(getSession(), node_id, parm_key))
+        myCookRecords[node_id] = CookRecord{ cook_options, node_info.totalCookCount, parm_key };
+    else
+        invalidateCook(node_id);
+
+    // A failover replays the parameters of the last cook
+    captureNodeState(node_id);
+}
+
+bool
+HoudiniEngineManager::isCookCurrent(HAPI_NodeId node_id, const HAPI_CookOptions& cook_options)
+{
+    auto record = myCookRecords.find(node_id);
+    if (record == myCookRecords.end() || !HoudiniApi::CookOptions_AreEqual(&record->second.cookOptions, &cook_options))
+        return false;
+
+    // Nobody else cooked the node since, nothing was connected to it and its parameters
+    // were not edited behind our back
+    HAPI_NodeInfo node_info;
+    uint64_t parm_key = 0;
+    return HoudiniApi::GetNodeInfo(getSession(), node_id, &node_info) == HAPI_RESULT_SUCCESS &&
+           node_info.totalCookCount == record->second.totalCookCount && node_info.inputCount == 0 &&
+           HoudiniEngineGeometry::getMeshCacheKey(getSession(), node_id, parm_key) &&
+           parm_key == record->second.parmKey;
+}
+
+bool
+HoudiniEngineManager::startPdgCook(HAPI_NodeId top_node_id, const PdgWorkItemCallback& on_work_item)
+{
+    cancelPdgCook();
+
+    std::unique_ptr<PdgRunner> runner(new PdgRunner());
+    runner->onWorkItem = on_work_item;
+
+    HOUDINI_CHECK_ERROR_RETURN(
+        HoudiniApi::GetPDGGraphContextId(getSession(), top_node_id, &runner->graphContextId), false);
+
+    std::cout << "Starting PDG cook..." << std::endl;
+    HOUDINI_CHECK_ERROR_RETURN(
+        HoudiniApi::CookPDG(getSession(), top_node_id, 0, 0), false);
+
+    PdgRunner* pdg_runner = runner.get();
+    runner->drainThread = std::thread(&HoudiniEngineManager::drainPdgEvents, this, pdg_runner);
+    runner->dispatchThread = std::thread(&HoudiniEngineManager::dispatchPdgEvents, this, pdg_runner);
+    myPdgRunner = std::move(runner);
+
+    return true;
+}
+
+bool
+HoudiniEngineManager::waitForPdgCook()
+{
+    if (!myPdgRunner)
+        return false;
+
+    myPdgRunner->drainThread.join();
+    myPdgRunner->dispatchThread.join();
+
+    bool success = !myPdgRunner->failed && !myPdgRunner->cancelled;
+    myPdgRunner.reset();
+
+    std::cout << (success ? "PDG cook complete." : "PDG cook failed.") << std::endl;
+    return success;
+}
+
+void
+HoudiniEngineManager::cancelPdgCook()
+{
+    if (!myPdgRunner)
+        return;
+
+    {
+        std::lock_guard<std::mutex> lock(myPdgRunner->mutex);
+        myPdgRunner->cancelled = true;
+    }
+    myPdgRunner->queueChanged.notify_all();
+
+    HoudiniApi::CancelPDGCook(getSession(), myPdgRunner->graphContextId);
+    waitForPdgCook();
+}
+
+void
+HoudiniEngineManager::drainPdgEvents(PdgRunner* runner)
+{
+    std::vector<HAPI_PDG_EventInfo> events(64);
+    bool started = false;
+    bool complete = false;
+    auto start_deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(PDG_COOK_START_TIMEOUT_MS);
+    while (!complete)
+    {
+        {
+            std::lock_guard<std::mutex> lock(runner->mutex);
+            if (runner->cancelled)
+                break;
+        }
+
+        int event_count = 0;
+        int remaining_events = 0;
+        HAPI_Result result = HAPI_RESULT_SUCCESS;
+        HOUDINI_CHECK_ERROR_GET(&result,
+            HoudiniApi::GetPDGEvents(
+                getSession(), runner->graphContextId, events.data(), (int)events.size(),
+                &event_count, &remaining_events));
+        if (result != HAPI_RESULT_SUCCESS)
+        {
+            std::lock_guard<std::mutex> lock(runner->mutex);
+            runner->failed = true;
+            break;
+        }
+
+        for (int i = 0; i < event_count; ++i)
+        {
+            const HAPI_PDG_EventInfo& event = events[i];
+            started = true;
+
+            if (event.eventType == HAPI_PDG_EVENT_COOK_ERROR)
+            {
+                std::cout << "PDG cook error: " << HoudiniEngineUtility::getString(getSession(), event.msgSH) << std::endl;
+                std::lock_guard<std::mutex> lock(runner->mutex);
+                runner->failed = true;
+            }
+            else if (event.eventType == HAPI_PDG_EVENT_COOK_COMPLETE)
+            {
+                complete = true;
+            }
+            else if (event.eventType == HAPI_PDG_EVENT_WORKITEM_STATE_CHANGE &&
+                     (event.currentState == HAPI_PDG_WORKITEM_COOKED_SUCCESS ||
+                      event.currentState == HAPI_PDG_WORKITEM_COOKED_CACHE))
+            {
+                // Block while the queue is full, so a slow callback throttles the polling
+                std::unique_lock<std::mutex> lock(runner->mutex);
+                runner->queueChanged.wait(lock, [runner]()
+                {
+                    return runner->events.size() < PDG_EVENT_QUEUE_CAPACITY || runner->cancelled;
+                });
+                runner->events.push_back(event);
+                runner->queueChanged.notify_all();
+            }
+        }
+
+        if (event_count == 0 && remaining_events == 0)
+        {
+            // The graph stops cooking without a completion event when it has nothing to cook, and
+            // may then never report cooking at all: give up waiting for it to start at a deadline
+            int pdg_state = HAPI_PDG_STATE_READY;
+            HOUDINI_CHECK_ERROR_GET(&result, HoudiniApi::GetPDGState(getSession(), runner->graphContextId, &pdg_state));
+            if (result != HAPI_RESULT_SUCCESS)
+            {
+                std::lock_guard<std::mutex> lock(runner->mutex);
+                runner->failed = true;
+                break;
+            }
+
+            if (pdg_state == HAPI_PDG_STATE_COOKING)
+                started = true;
+            else if (started || std::chrono::steady_clock::now() >= start_deadline)
+                complete = true;
+
+            if (!complete)
+                std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(runner->mutex);
+    runner->draining = false;
+    runner->queueChanged.notify_all();
+}
+
+void
+HoudiniEngineManager::dispatchPdgEvents(PdgRunner* runner)
+{
+    while (true)
+    {
+        HAPI_PDG_EventInfo event;
+        {
+            std::unique_lock<std::mutex> lock(runner->mutex);
+            runner->queueChanged.wait(lock, [runner]()
+            {
+                return !runner->events.empty() || !runner->draining || runner->cancelled;
+            });
+
+            if (runner->cancelled || runner->events.empty())
+                break;
+
+            event = runner->events.front();
+            runner->events.pop_front();
+            runner->queueChanged.notify_all();
+        }
+
+        PdgWorkItem work_item;
+        work_item.nodeId = event.nodeId;
+        work_item.workItemId = event.workItemId;
+
+        // Skip the item rather than stop dispatching, which would stall the drain thread
+        HAPI_PDG_WorkItemInfo work_item_info;
+        HAPI_Result result = HAPI_RESULT_SUCCESS;
+        HOUDINI_CHECK_ERROR_GET(&result,
+            HoudiniApi::GetWorkItemInfo(getSession(), runner->graphContextId, event.workItemId, &work_item_info));
+        if (result != HAPI_RESULT_SUCCESS)
+            continue;
+        work_item.name = HoudiniEngineUtility::getString(getSession(), work_item_info.nameSH);
+
+        if (work_item_info.numResults > 0)
+        {
+            std::vector<HAPI_PDG_WorkItemOutputFile> output_files(work_item_info.numResults);
+            HOUDINI_CHECK_ERROR(
+                HoudiniApi::GetWorkItemOutputFiles(
+                    getSession(), event.nodeId, event.workItemId, output_files.data(), work_item_info.numResults));
+
+            std::vector<HAPI_StringHandle> file_paths;
+            for (const HAPI_PDG_WorkItemOutputFile& output_file : output_files)
+                file_paths.push_back(output_file.filePathSH);
+            HoudiniEngineUtility::getStrings(getSession(), file_paths, work_item.outputFiles);
+        }
+
+        if (runner->onWorkItem)
+            runner->onWorkItem(work_item);
+    }
+}
+
 bool 
 HoudiniEngineManager::loadAsset(const char* otl_path, HAPI_AssetLibraryId& asset_library_id, std::string& asset_name)
 {
+    HOUDINI_TRACE_SCOPE("loadAsset");
+
     if (!getSession())
         return false;
 
@@ -271,6 +942,10 @@ HoudiniEngineManager::loadAsset(const char* otl_path, HAPI_AssetLibraryId& asset
     std::cout << "Loading asset..." << std::endl;
     HOUDINI_CHECK_ERROR_RETURN(
         HoudiniApi::LoadAssetLibraryFromFile(getSession(), otl_path, false, &asset_library_id), false); 
+    {
+        std::lock_guard<std::mutex> lock(myAssetPathsMutex);
+        myAssetPaths.push_back(otl_path);
+    }
 
     int asset_count;
     HOUDINI_CHECK_ERROR_RETURN(HoudiniApi::GetAvailableAssetCount(getSession(), asset_library_id, &asset_count), false);
@@ -292,22 +967,137 @@ bool
 HoudiniEngineManager::createAndCookNode(const char* operator_name, HAPI_NodeId * node_id)
 {
     std::cout << "\nCreating and cooking node: " << operator_name << "..." << std::endl;
-    HOUDINI_CHECK_ERROR_RETURN(
-        HoudiniApi::CreateNode(getSession(), -1, operator_name, "hexagona_lite", false, node_id), false);
+    {
+        HOUDINI_TRACE_SCOPE("CreateNode");
+        HOUDINI_CHECK_ERROR_RETURN(
+            HoudiniApi::CreateNode(getSession(), -1, operator_name, "hexagona_lite", false, node_id), false);
+    }
 
-    HOUDINI_CHECK_ERROR_RETURN(
-        HoudiniApi::CookNode(getSession(), *node_id, getCookOptions()), false);
+    {
+        HOUDINI_TRACE_SCOPE("CookNode");
+        HOUDINI_CHECK_ERROR_RETURN(
+            HoudiniApi::CookNode(getSession(), *node_id, getCookOptions()), false);
+    }
     
+    myNodeRecords[*node_id] = NodeRecord{ operator_name, "hexagona_lite", {} };
+
     if(waitForCook())
     {
         std::cout << "Cook complete." << std::endl;
+        recordCook(*node_id, *getCookOptions());
     }
     return true;
 }
 
+bool
+HoudiniEngineManager::createNode(const char* operator_name, const char* label, HAPI_NodeId * node_id)
+{
+    HOUDINI_TRACE_SCOPE("CreateNode");
+    HOUDINI_CHECK_ERROR_RETURN(
+        HoudiniApi::CreateNode(getSession(), -1, operator_name, label, false, node_id), false);
+
+    myNodeRecords[*node_id] = NodeRecord{ operator_name, label, {} };
+    return true;
+}
+
+bool
+HoudiniEngineManager::deleteNode(HAPI_NodeId node_id)
+{
+    HoudiniEngineGeometry::clearNodeCaches(getSession(), node_id);
+    invalidateCook(node_id);
+    myNodeRecords.erase(node_id);
+
+    HOUDINI_CHECK_ERROR_RETURN(HoudiniApi::DeleteNode(getSession(), node_id), false);
+    return true;
+}
+
+bool
+HoudiniEngineManager::cookNodes(const std::vector<HAPI_NodeId>& node_ids, const std::string& profile)
+{
+    HAPI_CookOptions* cook_options = getCookOptions(profile);
+    if (!cook_options)
+    {
+        std::cout << "Unknown cook profile: " << profile << std::endl;
+        return false;
+    }
+
+    // With the cooking thread the cooks are queued, so submitting them all before
+    // waiting avoids a status polling round trip per node
+    std::cout << "\nCooking " << node_ids.size() << " nodes with the '" << profile << "' profile..." << std::endl;
+    for (HAPI_NodeId node_id : node_ids)
+    {
+        HOUDINI_TRACE_SCOPE("CookNode");
+        HOUDINI_CHECK_ERROR_RETURN(
+            HoudiniApi::CookNode(getSession(), node_id, cook_options), false);
+    }
+
+    if (!waitForCook())
+    {
+        for (HAPI_NodeId node_id : node_ids)
+            invalidateCook(node_id);
+        return false;
+    }
+
+    std::cout << "Cook complete." << std::endl;
+    for (HAPI_NodeId node_id : node_ids)
+        recordCook(node_id, *cook_options);
+    return true;
+}
+
+bool
+HoudiniEngineManager::setParameter(HAPI_NodeId node_id, const std::string& parm_name, const std::vector<std::string>& values)
+{
+    HAPI_ParmInfo parm_info;
+    HOUDINI_CHECK_ERROR_RETURN(
+        HoudiniApi::GetParmInfoFromName(getSession(), node_id, parm_name.c_str(), &parm_info), false);
+
+    if (HoudiniApi::ParmInfo_IsInt(&parm_info))
+    {
+        int count = std::min((int)values.size(), HoudiniApi::ParmInfo_GetIntValueCount(&parm_info));
+        std::vector<int> int_values(count);
+        for (int i = 0; i < count; ++i)
+            int_values[i] = std::stoi(values[i]);
+
+        HOUDINI_CHECK_ERROR_RETURN(
+            HoudiniApi::SetParmIntValues(getSession(), node_id, int_values.data(), parm_info.intValuesIndex, count), false);
+    }
+    else if (HoudiniApi::ParmInfo_IsFloat(&parm_info))
+    {
+        int count = std::min((int)values.size(), HoudiniApi::ParmInfo_GetFloatValueCount(&parm_info));
+        std::vector<float> float_values(count);
+        for (int i = 0; i < count; ++i)
+            float_values[i] = std::stof(values[i]);
+
+        HOUDINI_CHECK_ERROR_RETURN(
+            HoudiniApi::SetParmFloatValues(getSession(), node_id, float_values.data(), parm_info.floatValuesIndex, count), false);
+    }
+    else if (HoudiniApi::ParmInfo_IsString(&parm_info))
+    {
+        int count = std::min((int)values.size(), HoudiniApi::ParmInfo_GetStringValueCount(&parm_info));
+        for (int i = 0; i < count; ++i)
+        {
+            HOUDINI_CHECK_ERROR_RETURN(
+                HoudiniApi::SetParmStringValue(getSession(), node_id, values[i].c_str(), parm_info.id, i), false);
+        }
+    }
+    else
+    {
+        std::cout << "Unsupported parameter type: " << parm_name << std::endl;
+        return false;
+    }
+
+    invalidateCook(node_id);
+
+    // Replay the edit after a failover even if the node is not cooked again first
+    captureNodeState(node_id);
+    return true;
+}
+
 bool 
 HoudiniEngineManager::waitForCook()
 {
+    HOUDINI_TRACE_SCOPE("waitForCook");
+
     if (!getSession())
         return false;
 
@@ -460,6 +1250,7 @@ HoudiniEngineManager::getAttributes(HAPI_NodeId node_id, HAPI_PartId part_id)
         std::string attr_name = HoudiniEngineUtility::getString(getSession(), point_attr_nameSH[i]);
         std::cout << "  Name: " << attr_name << std::endl;
         
+        HOUDINI_TRACE_SCOPE("GetAttributeInfo");
         HAPI_AttributeInfo attr_info;
         HoudiniApi::AttributeInfo_Init(&attr_info);
         HOUDINI_CHECK_ERROR_RETURN(
@@ -494,6 +1285,7 @@ HoudiniEngineManager::getAttributes(HAPI_NodeId node_id, HAPI_PartId part_id)
         std::string attr_name = HoudiniEngineUtility::getString(getSession(), vertex_attr_nameSH[i]);
         std::cout << "  Name: " << attr_name << std::endl;
         
+        HOUDINI_TRACE_SCOPE("GetAttributeInfo");
         HAPI_AttributeInfo attr_info;
         HoudiniApi::AttributeInfo_Init(&attr_info);
         HOUDINI_CHECK_ERROR_RETURN(
@@ -527,6 +1319,7 @@ HoudiniEngineManager::getAttributes(HAPI_NodeId node_id, HAPI_PartId part_id)
         std::string attr_name = HoudiniEngineUtility::getString(getSession(), prim_attr_nameSH[i]);
         std::cout << "  Name: " << attr_name << std::endl;
 
+        HOUDINI_TRACE_SCOPE("GetAttributeInfo");
         HAPI_AttributeInfo attr_info;
         HoudiniApi::AttributeInfo_Init(&attr_info);
         HOUDINI_CHECK_ERROR_RETURN(
@@ -567,6 +1360,8 @@ HoudiniEngineManager::getAttributes(HAPI_NodeId node_id, HAPI_PartId part_id)
 bool 
 HoudiniEngineManager::exportDelight(HAPI_NodeId node_id, HAPI_PartId part_id)
 {
+    HOUDINI_TRACE_SCOPE("exportDelight");
+
     HAPI_PartInfo part_info;
     HoudiniApi::PartInfo_Init(&part_info);
     HOUDINI_CHECK_ERROR_RETURN(
@@ -599,6 +1394,7 @@ HoudiniEngineManager::exportDelight(HAPI_NodeId node_id, HAPI_PartId part_id)
         std::string attr_name = HoudiniEngineUtility::getString(getSession(), point_attr_nameSH[i]);
         std::cout << "  Name: " << attr_name << std::endl;
         
+        HOUDINI_TRACE_SCOPE("GetAttributeInfo");
         HAPI_AttributeInfo attr_info;
         HoudiniApi::AttributeInfo_Init(&attr_info);
         HOUDINI_CHECK_ERROR_RETURN(
@@ -633,6 +1429,7 @@ HoudiniEngineManager::exportDelight(HAPI_NodeId node_id, HAPI_PartId part_id)
         std::string attr_name = HoudiniEngineUtility::getString(getSession(), vertex_attr_nameSH[i]);
         std::cout << "  Name: " << attr_name << std::endl;
         
+        HOUDINI_TRACE_SCOPE("GetAttributeInfo");
         HAPI_AttributeInfo attr_info;
         HoudiniApi::AttributeInfo_Init(&attr_info);
         HOUDINI_CHECK_ERROR_RETURN(
@@ -666,6 +1463,7 @@ HoudiniEngineManager::exportDelight(HAPI_NodeId node_id, HAPI_PartId part_id)
         std::string attr_name = HoudiniEngineUtility::getString(getSession(), prim_attr_nameSH[i]);
         std::cout << "  Name: " << attr_name << std::endl;
 
+        HOUDINI_TRACE_SCOPE("GetAttributeInfo");
         HAPI_AttributeInfo attr_info;
         HoudiniApi::AttributeInfo_Init(&attr_info);
         HOUDINI_CHECK_ERROR_RETURN(
@@ -700,12 +1498,15 @@ HoudiniEngineManager::exportDelight(HAPI_NodeId node_id, HAPI_PartId part_id)
         std::cout << "  " << attr_name << std::endl;
     };
 
+    {
+        HOUDINI_TRACE_SCOPE("NSI emit");
 	NSI::Context nsi;
     NSI::ArgumentList args;
         args.Add(new NSI::StringArg("type","apistream"));
         args.Add(new NSI::StringArg("streamfilename","stdout"));
         nsi.Begin(args);
     nsi.End();
+    }
 	
     return true;
 }
@@ -27,11 +27,26 @@
 #pragma once
 
 #include <HAPI/HAPI.h>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <future>
+#include <map>
+#include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
+#include <vector>
 
 #define DEFAULT_NAMED_PIPE "hapi"
 #define DEFAULT_HOST_NAME "127.0.0.1"
 #define DEFAULT_TCP_PORT 9090
+#define DEFAULT_SHARED_MEMORY_NAME "hapi_shm"
+#define DEFAULT_SHARED_MEMORY_BUFFER_SIZE 100 // MB
+#define DEFAULT_COOK_PROFILE "default"
+#define PDG_EVENT_QUEUE_CAPACITY 1024
+#define PDG_COOK_START_TIMEOUT_MS 2000
 
 class HoudiniEngineManager
 {
@@ -43,10 +58,33 @@ public:
 		NewTCPSocket = 3,
 		ExistingNamedPipe = 4,
 		ExistingTCPSocket = 5,
-		ExistingSharedMemory = 6
+		ExistingSharedMemory = 6,
+		NewSharedMemory = 7
+	};
+
+	// A PDG work item that cooked successfully, with the paths of its output files
+	struct PdgWorkItem
+	{
+		HAPI_NodeId nodeId;
+		HAPI_PDG_WorkItemId workItemId;
+		std::string name;
+		std::vector<std::string> outputFiles;
+	};
+
+	typedef std::function<void(const PdgWorkItem&)> PdgWorkItemCallback;
+
+	// Host-side timings of a profiled cook, in milliseconds since the capture started
+	struct CookProfile
+	{
+		std::string hperfPath;
+		long long startTime;    // wall clock, milliseconds since the epoch
+		double cookSubmitted;
+		double cookCompleted;
+		double captureStopped;
 	};
 
 	HoudiniEngineManager();
+	~HoudiniEngineManager();
 
 	// Creates a new session
 	bool startSession(SessionType session_type,
@@ -54,8 +92,16 @@ public:
                       int tcp_port,
                       const std::string& shard_mem_name);
 	
-	// Stop the existing session if valid, and creates a new session
-	bool restartSession(SessionType session_type, bool use_cooking_thread);
+	// Set the buffer used by new shared memory sessions (size in MB)
+	void setSharedMemoryBuffer(HAPI_ThriftSharedMemoryBufferType buffer_type, HAPI_Int64 buffer_size);
+
+	// Parse a shared memory buffer type, "fixed" or "ring"
+	static bool parseSharedMemoryBufferType(const std::string& name, HAPI_ThriftSharedMemoryBufferType& buffer_type);
+
+	// Stop the existing session if valid, and creates a new session. When the warm standby takes
+	// over, the nodes replayed on it are reported as (old id -> new id); a cold restart replays none.
+	bool restartSession(SessionType session_type, bool use_cooking_thread,
+	                    std::map<HAPI_NodeId, HAPI_NodeId>* replayed_nodes = nullptr);
 	
 	// Cleanup and shutdown an existing session
 	bool stopSession();
@@ -63,18 +109,72 @@ public:
 	// Initializes the HAPI session, should be called after successfully creating a session
 	bool initializeHAPI(bool use_cooking_thread);
 
+	// Keep a pre-started, initialized spare session with the loaded HDAs, ready to take
+	// over from the current one. Only available for session types that start a server.
+	bool enableWarmStandby(bool enable);
+
+	// Check that the session is still valid, failing over to the warm standby if it is not.
+	// Nodes replayed on the new session are reported as (old id -> new id).
+	bool checkSessionHealth(std::map<HAPI_NodeId, HAPI_NodeId>* replayed_nodes = nullptr);
+
+	// Snapshot the parameters of a node created by the manager, replayed after a failover.
+	// Taken after every cook and parameter edit of the node
+	bool captureNodeState(HAPI_NodeId node_id);
+
 	// Get the HAPI session
 	HAPI_Session* getSession();
 
 	// Get the cook options used to initialize the HAPI session
 	HAPI_CookOptions* getCookOptions();
 
-	// Load a new HDA asset
+	// Register (or replace) a named cook options profile
+	void setCookProfile(const std::string& profile, const HAPI_CookOptions& cook_options);
+
+	// Get the cook options of a named profile, nullptr if the profile is unknown
+	HAPI_CookOptions* getCookOptions(const std::string& profile);
+
+	// Cook the given node with a named profile and wait for the result. Unless forced, the cook
+	// is skipped for a node created by the manager without inputs, when its last cook was ours,
+	// used equivalent options and its parameters have not changed since.
+	// Nodes with inputs always cook, as uploads to their inputs do not show in their own state.
+	bool cookNode(HAPI_NodeId node_id, const std::string& profile, bool force = false);
+
+	// Force a cook of the given node inside a performance monitor capture, written to
+	// hperf_path, with the host-side timings of the same cook written next to it (.json)
+	bool profileCook(HAPI_NodeId node_id, const std::string& profile, const std::string& hperf_path,
+	                 CookProfile* cook_profile = nullptr);
+
+	// Forget the last cook of the given node, e.g. after changing its parameters
+	void invalidateCook(HAPI_NodeId node_id);
+
+	// Start cooking the PDG graph of a TOP node without blocking. on_work_item is called
+	// from a background thread as soon as each work item has cooked.
+	bool startPdgCook(HAPI_NodeId top_node_id, const PdgWorkItemCallback& on_work_item);
+
+	// Wait for the PDG cook to finish, returns false if it failed or was cancelled
+	bool waitForPdgCook();
+
+	// Cancel the PDG cook in progress, if any, and stop its threads
+	void cancelPdgCook();
+
+	// Load a new HDA asset. Several assets can be loaded from different threads at once
 	bool loadAsset(const char* otl_path, HAPI_AssetLibraryId& asset_library_id, std::string& asset_name);
 
 	// Instantiate and asynchronously cook the given node
 	bool createAndCookNode(const char* operator_name, HAPI_NodeId * node_id);
 
+	// Instantiate the given node without cooking it
+	bool createNode(const char* operator_name, const char* label, HAPI_NodeId * node_id);
+
+	// Delete a node, forgetting its cook, its replay record and the geometry read from it
+	bool deleteNode(HAPI_NodeId node_id);
+
+	// Submit cooks of all the given nodes back to back with a named profile, then wait once
+	bool cookNodes(const std::vector<HAPI_NodeId>& node_ids, const std::string& profile);
+
+	// Set an int, float or string parameter of the given node from its text values
+	bool setParameter(HAPI_NodeId node_id, const std::string& parm_name, const std::vector<std::string>& values);
+
 	// Query and list the paramters of the given node
 	bool getParameters(HAPI_NodeId node_id);
 
@@ -85,13 +185,102 @@ public:
 	bool exportDelight(HAPI_NodeId node_id, HAPI_PartId part_id);
 
 private:
+	// Create a session of the given type, starting its server if needed
+	static bool createSession(HAPI_Session* session,
+	                          SessionType session_type,
+	                          const std::string& named_pipe,
+	                          int tcp_port,
+	                          const std::string& shared_mem_name,
+	                          HAPI_ThriftSharedMemoryBufferType shared_mem_buffer_type,
+	                          HAPI_Int64 shared_mem_buffer_size);
+
+	// The cook options every session is initialized with
+	static HAPI_CookOptions createDefaultCookOptions();
+
+	// Initialize HAPI on the given session
+	static HAPI_Result initializeSession(HAPI_Session* session, const HAPI_CookOptions& cook_options, bool use_cooking_thread);
+
+	// A spare session being warmed up in the background
+	struct StandbySession
+	{
+		HAPI_Session session;
+		bool valid;
+	};
+
+	// Start warming up a new standby session in the background
+	void startStandby();
+
+	// Wait for the standby session and close it
+	void stopStandby();
+
+	// Swap the standby in as the current session and replay the tracked nodes on it
+	bool failover(std::map<HAPI_NodeId, HAPI_NodeId>* replayed_nodes);
+
+	// A node created by the manager, with enough state to recreate it
+	struct NodeRecord
+	{
+		std::string operatorName;
+		std::string label;
+		std::vector<char> preset;
+	};
+
 	// Wait for a cook to complete while querying its status
 	bool waitForCook();
 
+	// Remember the options, cook count and parameters of a node's completed cook
+	void recordCook(HAPI_NodeId node_id, const HAPI_CookOptions& cook_options);
+
+	// True when a node's last cook can stand in for a new one with the given options
+	bool isCookCurrent(HAPI_NodeId node_id, const HAPI_CookOptions& cook_options);
+
+	struct CookRecord
+	{
+		HAPI_CookOptions cookOptions;
+		int totalCookCount;
+		// HoudiniEngineGeometry::getMeshCacheKey of the node, which covers its parameter values
+		uint64_t parmKey;
+	};
+
+	// A running PDG cook: one thread drains the graph's events into a bounded queue,
+	// another dispatches the cooked work items to the callback
+	struct PdgRunner
+	{
+		HAPI_PDG_GraphContextId graphContextId = -1;
+		PdgWorkItemCallback onWorkItem;
+		std::thread drainThread;
+		std::thread dispatchThread;
+		std::mutex mutex;
+		std::condition_variable queueChanged;
+		std::deque<HAPI_PDG_EventInfo> events;
+		bool draining = true;
+		bool cancelled = false;
+		bool failed = false;
+	};
+
+	// Poll the graph's events until its cook completes, queueing cooked work items
+	void drainPdgEvents(PdgRunner* runner);
+
+	// Fetch the outputs of each queued work item and pass it to the callback
+	void dispatchPdgEvents(PdgRunner* runner);
+
 	HAPI_Session mySession;
 	HAPI_CookOptions myCookOptions;
+	std::map<std::string, HAPI_CookOptions> myCookProfiles;
+	std::map<HAPI_NodeId, CookRecord> myCookRecords;
 	SessionType mySessionType = InProcess;
 	std::string myNamedPipe = DEFAULT_NAMED_PIPE;
 	int myTcpPort = DEFAULT_TCP_PORT;
         std::string mySharedMemoryName;
+	HAPI_ThriftSharedMemoryBufferType mySharedMemoryBufferType = HAPI_THRIFT_SHARED_MEMORY_FIXED_LENGTH_BUFFER;
+	HAPI_Int64 mySharedMemoryBufferSize = DEFAULT_SHARED_MEMORY_BUFFER_SIZE;
+	bool myUseCookingThread = true;
+
+	bool myWarmStandby = false;
+	int myStandbyCount = 0;
+	std::future<StandbySession> myStandby;
+	std::vector<std::string> myAssetPaths;
+	std::mutex myAssetPathsMutex;
+	std::map<HAPI_NodeId, NodeRecord> myNodeRecords;
+
+	std::unique_ptr<PdgRunner> myPdgRunner;
 };
@@ -0,0 +1,72 @@
+/*
+* Copyright (c) <2023> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#pragma once
+
+#include <HAPI/HAPI_Common.h>
+
+#include <string>
+#include <vector>
+
+// An attribute of a host-side mesh. Numeric attributes hold tupleSize values per element, in
+// intValues for 32 bit integer attributes and in values (as floats) otherwise; string
+// attributes hold their unique strings plus tupleSize indices per element.
+struct HoudiniEngineMeshAttribute
+{
+    std::string name;
+    HAPI_AttributeOwner owner = HAPI_ATTROWNER_INVALID;
+    int tupleSize = 1;
+    bool isString = false;
+    bool isInt = false;
+
+    std::vector<float> values;
+    std::vector<int> intValues;
+
+    std::vector<std::string> strings;
+    std::vector<int> indices;
+};
+
+// A polygon mesh part held on the host, as read from or sent to Houdini
+struct HoudiniEngineMesh
+{
+    int pointCount = 0;
+
+    // Vertices of each face, and the point of each vertex face after face
+    std::vector<int> faceCounts;
+    std::vector<int> vertexList;
+
+    std::vector<HoudiniEngineMeshAttribute> attributes;
+
+    const HoudiniEngineMeshAttribute* findAttribute(HAPI_AttributeOwner owner, const std::string& name) const
+    {
+        for (const HoudiniEngineMeshAttribute& attribute : attributes)
+        {
+            if (attribute.owner == owner && attribute.name == name)
+                return &attribute;
+        }
+        return nullptr;
+    }
+};
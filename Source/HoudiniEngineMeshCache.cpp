@@ -0,0 +1,697 @@
+/*
+* Copyright (c) <2023> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "HoudiniEngineMeshCache.h"
+#include "HoudiniEnginePlatform.h"
+#include "HoudiniEngineUtility.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+
+// Identifies a mesh cache file, and its layout version
+static const char MESH_CACHE_MAGIC[8] = { 'H', 'E', 'M', 'C', 'A', 'C', 'H', 'E' };
+static const uint32_t MESH_CACHE_VERSION = 2;
+
+// Alignment of every block in the file
+static const uint64_t MESH_CACHE_BLOCK_ALIGNMENT = 64;
+
+enum MeshCacheBlockKind : uint32_t
+{
+    MESH_CACHE_FACE_COUNTS = 0,
+    MESH_CACHE_VERTEX_LIST = 1,
+    MESH_CACHE_VALUES = 2,
+    MESH_CACHE_INDICES = 3,
+    MESH_CACHE_STRINGS = 4,
+    MESH_CACHE_INT_VALUES = 5
+};
+
+enum MeshCacheAttributeType : uint32_t
+{
+    MESH_CACHE_FLOAT_ATTRIBUTE = 0,
+    MESH_CACHE_STRING_ATTRIBUTE = 1,
+    MESH_CACHE_INT_ATTRIBUTE = 2
+};
+
+enum MeshCacheCompression : uint32_t
+{
+    MESH_CACHE_UNCOMPRESSED = 0,
+    MESH_CACHE_LZ4 = 1
+};
+
+struct MeshCacheHeader
+{
+    char magic[8];
+    uint32_t version;
+    uint32_t blockCount;
+    uint64_t key;
+    uint64_t fileSize;
+    int32_t pointCount;
+    uint32_t attributeCount;
+
+    // Offsets from the start of the file
+    uint64_t namesOffset;
+    uint64_t indexOffset;
+    uint64_t reserved;
+};
+
+struct MeshCacheAttribute
+{
+    // Name, in the names table
+    uint32_t nameOffset;
+    uint32_t nameLength;
+    int32_t owner;
+    int32_t tupleSize;
+    uint32_t type;
+};
+
+struct MeshCacheBlock
+{
+    uint32_t kind;
+    uint32_t compression;
+
+    // Attribute of a values, indices or strings block, -1 for the topology
+    int32_t attribute;
+    uint32_t reserved;
+
+    // Numbers of values, or of strings, in the block
+    uint64_t elementCount;
+
+    uint64_t offset;
+    uint64_t storedBytes;
+    uint64_t rawBytes;
+};
+
+static_assert(sizeof(MeshCacheHeader) == 64, "Unexpected mesh cache header size");
+static_assert(sizeof(MeshCacheAttribute) == 20, "Unexpected mesh cache attribute size");
+static_assert(sizeof(MeshCacheBlock) == 48, "Unexpected mesh cache block size");
+
+// LZ4 block format limits: matches are at least 4 bytes, the last match starts at least
+// 12 bytes before the end, and the last 5 bytes are always literals
+static const size_t LZ4_MIN_MATCH = 4;
+static const size_t LZ4_MATCH_FIND_LIMIT = 12;
+static const size_t LZ4_LAST_LITERALS = 5;
+static const size_t LZ4_MAX_OFFSET = 65535;
+static const int LZ4_HASH_BITS = 16;
+
+static uint32_t
+read32(const char* data)
+{
+    uint32_t value;
+    std::memcpy(&value, data, sizeof(value));
+    return value;
+}
+
+static void
+lz4WriteLength(std::vector<char>& out, size_t length)
+{
+    for (; length >= 255; length -= 255)
+        out.push_back((char)255);
+    out.push_back((char)length);
+}
+
+// Append a sequence: literals, then a match unless match_length is 0 (the last sequence)
+static void
+lz4WriteSequence(std::vector<char>& out, const char* literals, size_t literal_length, size_t offset, size_t match_length)
+{
+    const size_t token = out.size();
+    out.push_back(0);
+
+    unsigned char token_value = (unsigned char)(std::min<size_t>(literal_length, 15) << 4);
+    if (literal_length >= 15)
+        lz4WriteLength(out, literal_length - 15);
+    out.insert(out.end(), literals, literals + literal_length);
+
+    if (match_length > 0)
+    {
+        out.push_back((char)(offset & 0xff));
+        out.push_back((char)(offset >> 8));
+
+        const size_t length = match_length - LZ4_MIN_MATCH;
+        token_value |= (unsigned char)std::min<size_t>(length, 15);
+        if (length >= 15)
+            lz4WriteLength(out, length - 15);
+    }
+    out[token] = (char)token_value;
+}
+
+// Greedy LZ4 block compression with a single-entry hash table
+static void
+lz4Compress(const char* data, size_t size, std::vector<char>& out)
+{
+    out.clear();
+    out.reserve(size + size / 255 + 16);
+
+    std::vector<size_t> table((size_t)1 << LZ4_HASH_BITS, SIZE_MAX);
+    size_t anchor = 0;
+    size_t position = 0;
+    if (size > LZ4_MATCH_FIND_LIMIT)
+    {
+        const size_t match_start_limit = size - LZ4_MATCH_FIND_LIMIT;
+        const size_t match_end_limit = size - LZ4_LAST_LITERALS;
+        while (position <= match_start_limit)
+        {
+            const uint32_t sequence = read32(data + position);
+            const size_t hash = (sequence * 2654435761u) >> (32 - LZ4_HASH_BITS);
+            const size_t candidate = table[hash];
+            table[hash] = position;
+
+            if (candidate != SIZE_MAX && position - candidate <= LZ4_MAX_OFFSET && read32(data + candidate) == sequence)
+            {
+                size_t length = LZ4_MIN_MATCH;
+                while (position + length < match_end_limit && data[candidate + length] == data[position + length])
+                    ++length;
+
+                lz4WriteSequence(out, data + anchor, position - anchor, position - candidate, length);
+                position += length;
+                anchor = position;
+            }
+            else
+                ++position;
+        }
+    }
+    lz4WriteSequence(out, data + anchor, size - anchor, 0, 0);
+}
+
+// Decompress an LZ4 block of exactly raw_size bytes, rejecting malformed input
+static bool
+lz4Decompress(const char* data, size_t size, char* out, size_t raw_size)
+{
+    size_t input = 0;
+    size_t output = 0;
+    auto readLength = [&](size_t& length)
+    {
+        unsigned char next;
+        do
+        {
+            if (input >= size)
+                return false;
+            next = (unsigned char)data[input++];
+            length += next;
+        }
+        while (next == 255);
+        return true;
+    };
+
+    while (input < size)
+    {
+        const unsigned char token = (unsigned char)data[input++];
+
+        size_t literal_length = token >> 4;
+        if (literal_length == 15 && !readLength(literal_length))
+            return false;
+        if (literal_length > size - input || literal_length > raw_size - output)
+            return false;
+        std::memcpy(out + output, data + input, literal_length);
+        input += literal_length;
+        output += literal_length;
+
+        // The last sequence has no match
+        if (input == size)
+            break;
+
+        if (size - input < 2)
+            return false;
+        const size_t offset = (unsigned char)data[input] | ((size_t)(unsigned char)data[input + 1] << 8);
+        input += 2;
+
+        size_t match_length = token & 15;
+        if (match_length == 15 && !readLength(match_length))
+            return false;
+        match_length += LZ4_MIN_MATCH;
+        if (offset == 0 || offset > output || match_length > raw_size - output)
+            return false;
+
+        // Matches may overlap their own output
+        char* target = out + output;
+        const char* source = target - offset;
+        if (offset >= match_length)
+            std::memcpy(target, source, match_length);
+        else
+        {
+            for (size_t i = 0; i < match_length; ++i)
+                target[i] = source[i];
+        }
+        output += match_length;
+    }
+    return output == raw_size;
+}
+
+static uint64_t
+alignOffset(uint64_t offset)
+{
+    return (offset + MESH_CACHE_BLOCK_ALIGNMENT - 1) / MESH_CACHE_BLOCK_ALIGNMENT * MESH_CACHE_BLOCK_ALIGNMENT;
+}
+
+// Number of elements a point, vertex or primitive attribute has in the mesh
+static uint64_t
+getOwnerCount(int owner, uint64_t point_count, uint64_t face_count, uint64_t vertex_count)
+{
+    switch (owner)
+    {
+        case HAPI_ATTROWNER_POINT: return point_count;
+        case HAPI_ATTROWNER_VERTEX: return vertex_count;
+        default: return face_count;
+    }
+}
+
+bool
+HoudiniEngineMeshCache::write(const std::string& path, const HoudiniEngineMesh& mesh, uint64_t key, bool compress)
+{
+    // A block to write, pointing at the mesh's own array or at owned bytes
+    struct PendingBlock
+    {
+        MeshCacheBlock entry{};
+        const char* data = nullptr;
+        std::vector<char> owned;
+        std::vector<char> compressed;
+    };
+
+    std::vector<PendingBlock> blocks;
+    auto addBlock = [&](uint32_t kind, int attribute, uint64_t element_count, const void* data, size_t bytes)
+    {
+        blocks.emplace_back();
+        PendingBlock& block = blocks.back();
+        block.entry.kind = kind;
+        block.entry.attribute = attribute;
+        block.entry.elementCount = element_count;
+        block.entry.rawBytes = bytes;
+        block.data = (const char*)data;
+    };
+
+    addBlock(MESH_CACHE_FACE_COUNTS, -1, mesh.faceCounts.size(), mesh.faceCounts.data(), mesh.faceCounts.size() * sizeof(int));
+    addBlock(MESH_CACHE_VERTEX_LIST, -1, mesh.vertexList.size(), mesh.vertexList.data(), mesh.vertexList.size() * sizeof(int));
+
+    std::vector<MeshCacheAttribute> attributes;
+    std::string names;
+    for (size_t i = 0; i < mesh.attributes.size(); ++i)
+    {
+        const HoudiniEngineMeshAttribute& attribute = mesh.attributes[i];
+        MeshCacheAttribute entry{};
+        entry.nameOffset = (uint32_t)names.size();
+        entry.nameLength = (uint32_t)attribute.name.size();
+        entry.owner = attribute.owner;
+        entry.tupleSize = attribute.tupleSize;
+        entry.type =
+            attribute.isString ? MESH_CACHE_STRING_ATTRIBUTE :
+            attribute.isInt ? MESH_CACHE_INT_ATTRIBUTE : MESH_CACHE_FLOAT_ATTRIBUTE;
+        attributes.push_back(entry);
+        names += attribute.name;
+
+        if (attribute.isInt)
+        {
+            addBlock(MESH_CACHE_INT_VALUES, (int)i, attribute.intValues.size(), attribute.intValues.data(), attribute.intValues.size() * sizeof(int));
+            continue;
+        }
+
+        if (!attribute.isString)
+        {
+            addBlock(MESH_CACHE_VALUES, (int)i, attribute.values.size(), attribute.values.data(), attribute.values.size() * sizeof(float));
+            continue;
+        }
+
+        addBlock(MESH_CACHE_INDICES, (int)i, attribute.indices.size(), attribute.indices.data(), attribute.indices.size() * sizeof(int));
+
+        // Strings are stored as a 32 bit length followed by their characters
+        std::vector<char> strings;
+        for (const std::string& string : attribute.strings)
+        {
+            const uint32_t length = (uint32_t)string.size();
+            strings.insert(strings.end(), (const char*)&length, (const char*)&length + sizeof(length));
+            strings.insert(strings.end(), string.begin(), string.end());
+        }
+        addBlock(MESH_CACHE_STRINGS, (int)i, attribute.strings.size(), nullptr, strings.size());
+        blocks.back().owned = std::move(strings);
+        blocks.back().data = blocks.back().owned.data();
+    }
+
+    // Compress the blocks in parallel, keeping only those that shrink by at least an eighth
+    if (compress)
+    {
+        HoudiniEngineUtility::parallelFor((int64_t)blocks.size(), [&blocks](int64_t begin, int64_t end)
+        {
+            for (int64_t i = begin; i < end; ++i)
+            {
+                PendingBlock& block = blocks[i];
+                const size_t raw_bytes = (size_t)block.entry.rawBytes;
+                lz4Compress(block.data, raw_bytes, block.compressed);
+                if (block.compressed.size() > raw_bytes - raw_bytes / 8)
+                    block.compressed = std::vector<char>();
+            }
+        }, 1);
+    }
+
+    MeshCacheHeader header{};
+    std::memcpy(header.magic, MESH_CACHE_MAGIC, sizeof(header.magic));
+    header.version = MESH_CACHE_VERSION;
+    header.blockCount = (uint32_t)blocks.size();
+    header.key = key;
+    header.pointCount = mesh.pointCount;
+    header.attributeCount = (uint32_t)attributes.size();
+    header.namesOffset = sizeof(MeshCacheHeader) + attributes.size() * sizeof(MeshCacheAttribute);
+    header.indexOffset = alignOffset(header.namesOffset + names.size());
+
+    uint64_t offset = alignOffset(header.indexOffset + blocks.size() * sizeof(MeshCacheBlock));
+    for (PendingBlock& block : blocks)
+    {
+        const bool compressed = !block.compressed.empty();
+        block.entry.compression = compressed ? MESH_CACHE_LZ4 : MESH_CACHE_UNCOMPRESSED;
+        block.entry.storedBytes = compressed ? block.compressed.size() : block.entry.rawBytes;
+        block.entry.offset = offset;
+        offset = alignOffset(offset + block.entry.storedBytes);
+    }
+    header.fileSize = offset;
+
+    // Write next to the destination and swap it in, so readers never map a partial file
+    const std::string temporary_path = path + ".tmp";
+    {
+        std::ofstream file(temporary_path, std::ios::binary | std::ios::trunc);
+        if (!file)
+            return false;
+
+        uint64_t position = 0;
+        auto put = [&](const void* data, uint64_t bytes)
+        {
+            file.write((const char*)data, (std::streamsize)bytes);
+            position += bytes;
+        };
+        auto pad = [&](uint64_t target)
+        {
+            static const char zeros[MESH_CACHE_BLOCK_ALIGNMENT] = {};
+            while (position < target)
+                put(zeros, std::min<uint64_t>(target - position, MESH_CACHE_BLOCK_ALIGNMENT));
+        };
+
+        put(&header, sizeof(header));
+        if (!attributes.empty())
+            put(attributes.data(), attributes.size() * sizeof(MeshCacheAttribute));
+        put(names.data(), names.size());
+        pad(header.indexOffset);
+        for (const PendingBlock& block : blocks)
+            put(&block.entry, sizeof(block.entry));
+        for (const PendingBlock& block : blocks)
+        {
+            pad(block.entry.offset);
+            put(block.compressed.empty() ? block.data : block.compressed.data(), block.entry.storedBytes);
+        }
+        pad(header.fileSize);
+
+        if (!file.good())
+        {
+            file.close();
+            std::remove(temporary_path.c_str());
+            return false;
+        }
+    }
+
+    std::remove(path.c_str());
+    return std::rename(temporary_path.c_str(), path.c_str()) == 0;
+}
+
+HoudiniEngineMeshCache::~HoudiniEngineMeshCache()
+{
+    close();
+}
+
+bool
+HoudiniEngineMeshCache::open(const std::string& path)
+{
+    close();
+
+    myData = HoudiniEnginePlatform::MapFile(path, mySize);
+    if (!myData)
+        return false;
+
+    const char* data = (const char*)myData;
+    MeshCacheHeader header;
+    bool valid = mySize >= sizeof(header);
+    if (valid)
+    {
+        std::memcpy(&header, data, sizeof(header));
+        valid =
+            std::memcmp(header.magic, MESH_CACHE_MAGIC, sizeof(header.magic)) == 0 &&
+            header.version == MESH_CACHE_VERSION &&
+            header.fileSize == mySize &&
+            header.pointCount >= 0 &&
+            header.namesOffset == sizeof(MeshCacheHeader) + (uint64_t)header.attributeCount * sizeof(MeshCacheAttribute) &&
+            header.namesOffset <= header.indexOffset &&
+            header.indexOffset <= mySize &&
+            header.blockCount <= (mySize - header.indexOffset) / sizeof(MeshCacheBlock);
+    }
+
+    for (uint32_t i = 0; valid && i < header.attributeCount; ++i)
+    {
+        MeshCacheAttribute entry;
+        std::memcpy(&entry, data + sizeof(MeshCacheHeader) + i * sizeof(MeshCacheAttribute), sizeof(entry));
+        valid =
+            (entry.owner == HAPI_ATTROWNER_POINT || entry.owner == HAPI_ATTROWNER_VERTEX || entry.owner == HAPI_ATTROWNER_PRIM) &&
+            entry.tupleSize > 0 && entry.type <= MESH_CACHE_INT_ATTRIBUTE &&
+            (uint64_t)entry.nameOffset + entry.nameLength <= header.indexOffset - header.namesOffset;
+        if (valid)
+        {
+            HoudiniEngineMeshCacheAttribute attribute;
+            attribute.name.assign(data + header.namesOffset + entry.nameOffset, entry.nameLength);
+            attribute.owner = (HAPI_AttributeOwner)entry.owner;
+            attribute.tupleSize = entry.tupleSize;
+            attribute.isString = entry.type == MESH_CACHE_STRING_ATTRIBUTE;
+            attribute.isInt = entry.type == MESH_CACHE_INT_ATTRIBUTE;
+            myAttributes.push_back(attribute);
+        }
+    }
+    myAttributeDataBlocks.assign(myAttributes.size(), -1);
+    myAttributeStringBlocks.assign(myAttributes.size(), -1);
+
+    std::vector<MeshCacheBlock> entries(valid ? header.blockCount : 0);
+    if (!entries.empty())
+        std::memcpy(entries.data(), data + header.indexOffset, entries.size() * sizeof(MeshCacheBlock));
+
+    myBlocks.resize(entries.size());
+    myDecompressed.resize(entries.size());
+    for (size_t i = 0; valid && i < entries.size(); ++i)
+    {
+        const MeshCacheBlock& entry = entries[i];
+        valid =
+            entry.offset % MESH_CACHE_BLOCK_ALIGNMENT == 0 &&
+            entry.offset <= mySize && entry.storedBytes <= mySize - entry.offset &&
+            (entry.compression == MESH_CACHE_LZ4 || (entry.compression == MESH_CACHE_UNCOMPRESSED && entry.storedBytes == entry.rawBytes)) &&
+            (entry.attribute < 0 ? entry.kind <= MESH_CACHE_VERTEX_LIST
+                                 : entry.kind >= MESH_CACHE_VALUES && entry.kind <= MESH_CACHE_INT_VALUES &&
+                                   (size_t)entry.attribute < myAttributes.size()) &&
+            (entry.kind == MESH_CACHE_STRINGS || entry.rawBytes == entry.elementCount * 4);
+        if (!valid)
+            break;
+
+        int& slot =
+            entry.kind == MESH_CACHE_FACE_COUNTS ? myFaceCountsBlock :
+            entry.kind == MESH_CACHE_VERTEX_LIST ? myVertexListBlock :
+            entry.kind == MESH_CACHE_STRINGS ? myAttributeStringBlocks[entry.attribute] : myAttributeDataBlocks[entry.attribute];
+        valid = slot < 0;
+        slot = (int)i;
+
+        Block& block = myBlocks[i];
+        block.elementCount = (size_t)entry.elementCount;
+        block.bytes = (size_t)entry.rawBytes;
+        block.data = data + entry.offset;
+        if (valid && entry.compression == MESH_CACHE_LZ4)
+        {
+            // The size check bounds what a corrupt header can make us allocate
+            std::vector<char>& decompressed = myDecompressed[i];
+            valid = entry.rawBytes / 256 <= entry.storedBytes;
+            if (valid)
+            {
+                decompressed.resize(block.bytes);
+                valid = lz4Decompress(block.data, (size_t)entry.storedBytes, decompressed.data(), block.bytes);
+                block.data = decompressed.data();
+            }
+        }
+    }
+
+    // Every array must be present and sized for the mesh
+    valid = valid && myFaceCountsBlock >= 0 && myVertexListBlock >= 0;
+    if (valid)
+    {
+        myKey = header.key;
+        myPointCount = header.pointCount;
+
+        const uint64_t face_count = myBlocks[myFaceCountsBlock].elementCount;
+        const uint64_t vertex_count = myBlocks[myVertexListBlock].elementCount;
+        for (size_t i = 0; valid && i < myAttributes.size(); ++i)
+        {
+            const HoudiniEngineMeshCacheAttribute& attribute = myAttributes[i];
+            const uint64_t count = getOwnerCount(attribute.owner, header.pointCount, face_count, vertex_count);
+            const int data_block = myAttributeDataBlocks[i];
+            valid =
+                data_block >= 0 && (attribute.isString == (myAttributeStringBlocks[i] >= 0)) &&
+                entries[data_block].kind ==
+                    (attribute.isString ? MESH_CACHE_INDICES : attribute.isInt ? MESH_CACHE_INT_VALUES : MESH_CACHE_VALUES) &&
+                myBlocks[data_block].elementCount == count * attribute.tupleSize;
+
+            if (valid && attribute.isString)
+            {
+                // Check that the string lengths add up to the block
+                const Block& strings = myBlocks[myAttributeStringBlocks[i]];
+                size_t position = 0;
+                for (size_t string = 0; valid && string < strings.elementCount; ++string)
+                {
+                    valid = strings.bytes - position >= sizeof(uint32_t);
+                    if (valid)
+                    {
+                        const uint32_t length = read32(strings.data + position);
+                        position += sizeof(uint32_t);
+                        valid = length <= strings.bytes - position;
+                        position += valid ? length : 0;
+                    }
+                }
+                valid = valid && position == strings.bytes;
+            }
+        }
+    }
+
+    if (!valid)
+    {
+        close();
+        return false;
+    }
+    return true;
+}
+
+void
+HoudiniEngineMeshCache::close()
+{
+    HoudiniEnginePlatform::UnmapFile(myData, mySize);
+    myData = nullptr;
+    mySize = 0;
+    myKey = 0;
+    myPointCount = 0;
+    myFaceCountsBlock = -1;
+    myVertexListBlock = -1;
+    myAttributes.clear();
+    myAttributeDataBlocks.clear();
+    myAttributeStringBlocks.clear();
+    myBlocks.clear();
+    myDecompressed.clear();
+}
+
+HoudiniEngineSpan<int>
+HoudiniEngineMeshCache::getInts(int block) const
+{
+    HoudiniEngineSpan<int> span;
+    if (block >= 0)
+    {
+        span.data = (const int*)myBlocks[block].data;
+        span.size = myBlocks[block].elementCount;
+    }
+    return span;
+}
+
+HoudiniEngineSpan<float>
+HoudiniEngineMeshCache::getValues(size_t attribute) const
+{
+    HoudiniEngineSpan<float> span;
+    if (attribute < myAttributes.size() && !myAttributes[attribute].isString && !myAttributes[attribute].isInt)
+    {
+        const Block& block = myBlocks[myAttributeDataBlocks[attribute]];
+        span.data = (const float*)block.data;
+        span.size = block.elementCount;
+    }
+    return span;
+}
+
+HoudiniEngineSpan<int>
+HoudiniEngineMeshCache::getIntValues(size_t attribute) const
+{
+    if (attribute >= myAttributes.size() || !myAttributes[attribute].isInt)
+        return HoudiniEngineSpan<int>();
+    return getInts(myAttributeDataBlocks[attribute]);
+}
+
+HoudiniEngineSpan<int>
+HoudiniEngineMeshCache::getIndices(size_t attribute) const
+{
+    if (attribute >= myAttributes.size() || !myAttributes[attribute].isString)
+        return HoudiniEngineSpan<int>();
+    return getInts(myAttributeDataBlocks[attribute]);
+}
+
+std::vector<std::string>
+HoudiniEngineMeshCache::getStrings(size_t attribute) const
+{
+    std::vector<std::string> strings;
+    if (attribute >= myAttributes.size() || !myAttributes[attribute].isString)
+        return strings;
+
+    const Block& block = myBlocks[myAttributeStringBlocks[attribute]];
+    size_t position = 0;
+    for (size_t i = 0; i < block.elementCount; ++i)
+    {
+        const uint32_t length = read32(block.data + position);
+        position += sizeof(uint32_t);
+        strings.emplace_back(block.data + position, length);
+        position += length;
+    }
+    return strings;
+}
+
+void
+HoudiniEngineMeshCache::read(HoudiniEngineMesh& mesh) const
+{
+    mesh = HoudiniEngineMesh();
+    mesh.pointCount = myPointCount;
+
+    HoudiniEngineSpan<int> face_counts = getFaceCounts();
+    HoudiniEngineSpan<int> vertex_list = getVertexList();
+    mesh.faceCounts.assign(face_counts.begin(), face_counts.end());
+    mesh.vertexList.assign(vertex_list.begin(), vertex_list.end());
+
+    for (size_t i = 0; i < myAttributes.size(); ++i)
+    {
+        HoudiniEngineMeshAttribute attribute;
+        attribute.name = myAttributes[i].name;
+        attribute.owner = myAttributes[i].owner;
+        attribute.tupleSize = myAttributes[i].tupleSize;
+        attribute.isString = myAttributes[i].isString;
+        attribute.isInt = myAttributes[i].isInt;
+
+        if (attribute.isString)
+        {
+            HoudiniEngineSpan<int> indices = getIndices(i);
+            attribute.indices.assign(indices.begin(), indices.end());
+            attribute.strings = getStrings(i);
+        }
+        else if (attribute.isInt)
+        {
+            HoudiniEngineSpan<int> values = getIntValues(i);
+            attribute.intValues.assign(values.begin(), values.end());
+        }
+        else
+        {
+            HoudiniEngineSpan<float> values = getValues(i);
+            attribute.values.assign(values.begin(), values.end());
+        }
+        mesh.attributes.push_back(std::move(attribute));
+    }
+}
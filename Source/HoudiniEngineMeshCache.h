@@ -0,0 +1,140 @@
+/*
+* Copyright (c) <2023> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#pragma once
+
+#include "HoudiniEngineMesh.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// A read-only view of an array, valid while the cache that returned it stays open
+template <typename T>
+struct HoudiniEngineSpan
+{
+    const T* data = nullptr;
+    size_t size = 0;
+
+    const T* begin() const { return data; }
+    const T* end() const { return data + size; }
+    const T& operator[](size_t index) const { return data[index]; }
+    bool empty() const { return size == 0; }
+};
+
+// An attribute stored in a mesh cache file
+struct HoudiniEngineMeshCacheAttribute
+{
+    std::string name;
+    HAPI_AttributeOwner owner = HAPI_ATTROWNER_INVALID;
+    int tupleSize = 1;
+    bool isString = false;
+    bool isInt = false;
+};
+
+// A columnar on-disk cache of a mesh, opened by mapping the file rather than parsing it.
+//
+// The file starts with a header, the attribute table and an index of blocks. Each array (face
+// counts, vertex list, attribute values, string indices and strings) is a separate block
+// aligned to 64 bytes, stored as is or, when it shrinks, compressed in the LZ4 block format.
+// Uncompressed blocks are returned as spans straight into the mapping; compressed blocks are
+// decompressed once when the file is opened. Files are written in the host's byte order, and
+// their structure (not the values of the vertex list or string indices) is validated on open.
+class HoudiniEngineMeshCache
+{
+public:
+    HoudiniEngineMeshCache() = default;
+    ~HoudiniEngineMeshCache();
+
+    HoudiniEngineMeshCache(const HoudiniEngineMeshCache&) = delete;
+    HoudiniEngineMeshCache& operator=(const HoudiniEngineMeshCache&) = delete;
+
+    // Write a mesh, replacing the file once it is complete. The key identifies what the mesh
+    // was cooked from, so readers can tell whether the file is still current.
+    static bool write(const std::string& path, const HoudiniEngineMesh& mesh, uint64_t key, bool compress);
+
+    // Map a cache file, failing on a missing, truncated or foreign file
+    bool open(const std::string& path);
+
+    void close();
+
+    bool isOpen() const { return myData != nullptr; }
+
+    uint64_t getKey() const { return myKey; }
+
+    int getPointCount() const { return myPointCount; }
+
+    HoudiniEngineSpan<int> getFaceCounts() const { return getInts(myFaceCountsBlock); }
+
+    HoudiniEngineSpan<int> getVertexList() const { return getInts(myVertexListBlock); }
+
+    const std::vector<HoudiniEngineMeshCacheAttribute>& getAttributes() const { return myAttributes; }
+
+    // Values of a float attribute, tupleSize floats per element
+    HoudiniEngineSpan<float> getValues(size_t attribute) const;
+
+    // Values of an integer attribute, tupleSize ints per element
+    HoudiniEngineSpan<int> getIntValues(size_t attribute) const;
+
+    // String indices of a string attribute, tupleSize per element
+    HoudiniEngineSpan<int> getIndices(size_t attribute) const;
+
+    // Unique strings of a string attribute
+    std::vector<std::string> getStrings(size_t attribute) const;
+
+    // Copy the whole cache into a mesh
+    void read(HoudiniEngineMesh& mesh) const;
+
+private:
+    struct Block
+    {
+        const char* data = nullptr;
+        size_t bytes = 0;
+        size_t elementCount = 0;
+    };
+
+    HoudiniEngineSpan<int> getInts(int block) const;
+
+    const void* myData = nullptr;
+    size_t mySize = 0;
+
+    uint64_t myKey = 0;
+    int myPointCount = 0;
+    int myFaceCountsBlock = -1;
+    int myVertexListBlock = -1;
+
+    std::vector<HoudiniEngineMeshCacheAttribute> myAttributes;
+
+    // Values or indices block, and strings block, of each attribute
+    std::vector<int> myAttributeDataBlocks;
+    std::vector<int> myAttributeStringBlocks;
+
+    std::vector<Block> myBlocks;
+
+    // Decompressed contents of compressed blocks
+    std::vector<std::vector<char>> myDecompressed;
+};
@@ -0,0 +1,386 @@
+/*
+* Copyright (c) <2023> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "HoudiniEngineMeshProcessing.h"
+#include "HoudiniEngineUtility.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <mutex>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define HOUDINI_ENGINE_SSE2 1
+#include <emmintrin.h>
+#endif
+
+// Smallest number of points, faces or vertices worth handing to another thread
+static const int64_t MESH_PROCESSING_MIN_ITEMS_PER_TASK = 64 * 1024;
+
+// Split across threads with at least MESH_PROCESSING_MIN_ITEMS_PER_TASK items per task
+template <typename Func>
+static void
+parallelFor(int64_t count, const Func& func)
+{
+    HoudiniEngineUtility::parallelFor(count, func, MESH_PROCESSING_MIN_ITEMS_PER_TASK);
+}
+
+#if HOUDINI_ENGINE_SSE2
+
+// xyz in the low three lanes of a register, the fourth lane being zero
+struct Vec3
+{
+    __m128 v;
+};
+
+// x and y move as one 64 bit value, which compiles to a single unaligned load or store
+static inline Vec3 load3(const float* p)
+{
+    double xy;
+    std::memcpy(&xy, p, sizeof(xy));
+    return { _mm_movelh_ps(_mm_castpd_ps(_mm_set_sd(xy)), _mm_load_ss(p + 2)) };
+}
+
+static inline void store3(const Vec3& a, float* p)
+{
+    const double xy = _mm_cvtsd_f64(_mm_castps_pd(a.v));
+    std::memcpy(p, &xy, sizeof(xy));
+    _mm_store_ss(p + 2, _mm_movehl_ps(a.v, a.v));
+}
+
+static inline Vec3 zero3() { return { _mm_setzero_ps() }; }
+static inline Vec3 add(const Vec3& a, const Vec3& b) { return { _mm_add_ps(a.v, b.v) }; }
+static inline Vec3 sub(const Vec3& a, const Vec3& b) { return { _mm_sub_ps(a.v, b.v) }; }
+static inline Vec3 scale(const Vec3& a, float s) { return { _mm_mul_ps(a.v, _mm_set1_ps(s)) }; }
+static inline Vec3 min3(const Vec3& a, const Vec3& b) { return { _mm_min_ps(a.v, b.v) }; }
+static inline Vec3 max3(const Vec3& a, const Vec3& b) { return { _mm_max_ps(a.v, b.v) }; }
+
+static inline Vec3 cross(const Vec3& a, const Vec3& b)
+{
+    // (a.yzx * b.zxy) - (a.zxy * b.yzx)
+    const __m128 a_yzx = _mm_shuffle_ps(a.v, a.v, _MM_SHUFFLE(3, 0, 2, 1));
+    const __m128 b_yzx = _mm_shuffle_ps(b.v, b.v, _MM_SHUFFLE(3, 0, 2, 1));
+    const __m128 c = _mm_sub_ps(_mm_mul_ps(a.v, b_yzx), _mm_mul_ps(a_yzx, b.v));
+    return { _mm_shuffle_ps(c, c, _MM_SHUFFLE(3, 0, 2, 1)) };
+}
+
+static inline float dot(const Vec3& a, const Vec3& b)
+{
+    const __m128 m = _mm_mul_ps(a.v, b.v);
+    const __m128 s = _mm_add_ps(m, _mm_movehl_ps(m, m));
+    return _mm_cvtss_f32(_mm_add_ss(s, _mm_shuffle_ps(s, s, _MM_SHUFFLE(1, 1, 1, 1))));
+}
+
+#else
+
+struct Vec3
+{
+    float x, y, z;
+};
+
+static inline Vec3 load3(const float* p) { return { p[0], p[1], p[2] }; }
+
+static inline void store3(const Vec3& a, float* p)
+{
+    p[0] = a.x;
+    p[1] = a.y;
+    p[2] = a.z;
+}
+
+static inline Vec3 zero3() { return { 0.0f, 0.0f, 0.0f }; }
+static inline Vec3 add(const Vec3& a, const Vec3& b) { return { a.x + b.x, a.y + b.y, a.z + b.z }; }
+static inline Vec3 sub(const Vec3& a, const Vec3& b) { return { a.x - b.x, a.y - b.y, a.z - b.z }; }
+static inline Vec3 scale(const Vec3& a, float s) { return { a.x * s, a.y * s, a.z * s }; }
+static inline Vec3 min3(const Vec3& a, const Vec3& b) { return { std::min(a.x, b.x), std::min(a.y, b.y), std::min(a.z, b.z) }; }
+static inline Vec3 max3(const Vec3& a, const Vec3& b) { return { std::max(a.x, b.x), std::max(a.y, b.y), std::max(a.z, b.z) }; }
+
+static inline Vec3 cross(const Vec3& a, const Vec3& b)
+{
+    return { a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z, a.x * b.y - a.y * b.x };
+}
+
+static inline float dot(const Vec3& a, const Vec3& b) { return a.x * b.x + a.y * b.y + a.z * b.z; }
+
+#endif
+
+// Unit length a, or zero when a has no length
+static inline Vec3 normalize(const Vec3& a)
+{
+    const float length_squared = dot(a, a);
+    return length_squared > 0.0f ? scale(a, 1.0f / std::sqrt(length_squared)) : zero3();
+}
+
+// Offsets of each face's first vertex, checking that the faces use exactly the vertex list and
+// that it only refers to existing points
+static bool
+getFaceOffsets(const std::vector<int>& face_counts, const std::vector<int>& vertex_list, size_t point_count,
+               std::vector<int64_t>& offsets)
+{
+    offsets.resize(face_counts.size() + 1);
+    int64_t offset = 0;
+    for (size_t face = 0; face < face_counts.size(); ++face)
+    {
+        if (face_counts[face] < 0)
+            return false;
+        offsets[face] = offset;
+        offset += face_counts[face];
+    }
+    offsets[face_counts.size()] = offset;
+    if (offset != (int64_t)vertex_list.size())
+        return false;
+
+    for (int point : vertex_list)
+    {
+        if (point < 0 || (size_t)point >= point_count)
+            return false;
+    }
+    return true;
+}
+
+void
+HoudiniEngineMeshProcessing::expandBounds(HoudiniEngineBounds& bounds, const float* positions, int64_t point_count)
+{
+    if (point_count <= 0)
+        return;
+
+    Vec3 low = load3(positions);
+    Vec3 high = low;
+    for (int64_t point = 1; point < point_count; ++point)
+    {
+        const Vec3 position = load3(positions + point * 3);
+        low = min3(low, position);
+        high = max3(high, position);
+    }
+
+    if (!bounds.isEmpty())
+    {
+        low = min3(low, load3(bounds.min));
+        high = max3(high, load3(bounds.max));
+    }
+    store3(low, bounds.min);
+    store3(high, bounds.max);
+}
+
+HoudiniEngineBounds
+HoudiniEngineMeshProcessing::computeBounds(const std::vector<float>& positions)
+{
+    const int64_t point_count = (int64_t)(positions.size() / 3);
+
+    // Each task bounds a range of points, then the ranges are merged
+    HoudiniEngineBounds bounds;
+    std::mutex bounds_mutex;
+    parallelFor(point_count, [&](int64_t begin, int64_t end)
+    {
+        HoudiniEngineBounds partial;
+        expandBounds(partial, positions.data() + begin * 3, end - begin);
+        if (partial.isEmpty())
+            return;
+
+        std::lock_guard<std::mutex> lock(bounds_mutex);
+        expandBounds(bounds, partial.min, 1);
+        expandBounds(bounds, partial.max, 1);
+    });
+    return bounds;
+}
+
+bool
+HoudiniEngineMeshProcessing::computeNormals(const std::vector<float>& positions, const std::vector<int>& face_counts,
+                                            const std::vector<int>& vertex_list, std::vector<float>& normals)
+{
+    const size_t point_count = positions.size() / 3;
+    std::vector<int64_t> offsets;
+    if (!getFaceOffsets(face_counts, vertex_list, point_count, offsets))
+        return false;
+
+    // Sum of the triangle fan's cross products, twice the area of the face along its normal.
+    // Faces wind clockwise, so each cross product is taken from the later edge.
+    std::vector<float> face_normals(face_counts.size() * 3);
+    parallelFor((int64_t)face_counts.size(), [&](int64_t begin, int64_t end)
+    {
+        for (int64_t face = begin; face < end; ++face)
+        {
+            const int* vertices = vertex_list.data() + offsets[face];
+            Vec3 normal = zero3();
+            if (face_counts[face] >= 3)
+            {
+                const Vec3 origin = load3(&positions[vertices[0] * 3]);
+                Vec3 edge = sub(load3(&positions[vertices[1] * 3]), origin);
+                for (int vertex = 2; vertex < face_counts[face]; ++vertex)
+                {
+                    const Vec3 next_edge = sub(load3(&positions[vertices[vertex] * 3]), origin);
+                    normal = add(normal, cross(next_edge, edge));
+                    edge = next_edge;
+                }
+            }
+            store3(normal, &face_normals[face * 3]);
+        }
+    });
+
+    // Scattering into the points is a single pass over the vertex list, which is memory bound
+    normals.assign(point_count * 3, 0.0f);
+    for (size_t face = 0; face < face_counts.size(); ++face)
+    {
+        const Vec3 face_normal = load3(&face_normals[face * 3]);
+        for (int64_t vertex = offsets[face]; vertex < offsets[face + 1]; ++vertex)
+        {
+            float* normal = &normals[vertex_list[vertex] * 3];
+            store3(add(load3(normal), face_normal), normal);
+        }
+    }
+
+    parallelFor((int64_t)point_count, [&](int64_t begin, int64_t end)
+    {
+        for (int64_t point = begin; point < end; ++point)
+            store3(normalize(load3(&normals[point * 3])), &normals[point * 3]);
+    });
+    return true;
+}
+
+bool
+HoudiniEngineMeshProcessing::computeTangents(const std::vector<float>& positions, const std::vector<float>& normals,
+                                             const std::vector<float>& uvs, int uv_tuple_size, const std::vector<int>& face_counts,
+                                             const std::vector<int>& vertex_list, std::vector<float>& tangents)
+{
+    const size_t point_count = positions.size() / 3;
+    std::vector<int64_t> offsets;
+    if (uv_tuple_size < 2 || normals.size() != point_count * 3 || uvs.size() != vertex_list.size() * uv_tuple_size ||
+        !getFaceOffsets(face_counts, vertex_list, point_count, offsets))
+        return false;
+
+    // Tangent and bitangent of each face, from the uv gradients of its triangle fan. Each
+    // triangle counts in proportion to its area, and mirrored triangles keep their direction.
+    std::vector<float> face_tangents(face_counts.size() * 6);
+    parallelFor((int64_t)face_counts.size(), [&](int64_t begin, int64_t end)
+    {
+        for (int64_t face = begin; face < end; ++face)
+        {
+            const int64_t first = offsets[face];
+            Vec3 tangent = zero3();
+            Vec3 bitangent = zero3();
+            if (face_counts[face] >= 3)
+            {
+                const Vec3 origin = load3(&positions[vertex_list[first] * 3]);
+                const float* origin_uv = &uvs[first * uv_tuple_size];
+                for (int64_t vertex = first + 2; vertex < offsets[face + 1]; ++vertex)
+                {
+                    const Vec3 edge1 = sub(load3(&positions[vertex_list[vertex - 1] * 3]), origin);
+                    const Vec3 edge2 = sub(load3(&positions[vertex_list[vertex] * 3]), origin);
+                    const float du1 = uvs[(vertex - 1) * uv_tuple_size] - origin_uv[0];
+                    const float dv1 = uvs[(vertex - 1) * uv_tuple_size + 1] - origin_uv[1];
+                    const float du2 = uvs[vertex * uv_tuple_size] - origin_uv[0];
+                    const float dv2 = uvs[vertex * uv_tuple_size + 1] - origin_uv[1];
+
+                    const float determinant = du1 * dv2 - du2 * dv1;
+                    if (determinant == 0.0f)
+                        continue;
+
+                    const float sign = determinant > 0.0f ? 1.0f : -1.0f;
+                    tangent = add(tangent, scale(sub(scale(edge1, dv2), scale(edge2, dv1)), sign));
+                    bitangent = add(bitangent, scale(sub(scale(edge2, du1), scale(edge1, du2)), sign));
+                }
+            }
+            store3(tangent, &face_tangents[face * 6]);
+            store3(bitangent, &face_tangents[face * 6 + 3]);
+        }
+    });
+
+    // The vertices of each point, with the face of each vertex
+    std::vector<int> vertex_faces(vertex_list.size());
+    std::vector<int64_t> point_offsets(point_count + 1, 0);
+    for (size_t face = 0; face < face_counts.size(); ++face)
+    {
+        for (int64_t vertex = offsets[face]; vertex < offsets[face + 1]; ++vertex)
+        {
+            vertex_faces[vertex] = (int)face;
+            ++point_offsets[vertex_list[vertex] + 1];
+        }
+    }
+    for (size_t point = 0; point < point_count; ++point)
+        point_offsets[point + 1] += point_offsets[point];
+
+    std::vector<int64_t> point_vertices(vertex_list.size());
+    {
+        std::vector<int64_t> next(point_offsets.begin(), point_offsets.end() - 1);
+        for (size_t vertex = 0; vertex < vertex_list.size(); ++vertex)
+            point_vertices[next[vertex_list[vertex]]++] = (int64_t)vertex;
+    }
+
+    // Vertices of a point with the same uv share a tangent, vertices on either side of a uv
+    // seam do not
+    tangents.assign(vertex_list.size() * 4, 0.0f);
+    parallelFor((int64_t)point_count, [&](int64_t begin, int64_t end)
+    {
+        std::vector<int64_t> group;
+        for (int64_t point = begin; point < end; ++point)
+        {
+            const Vec3 normal = load3(&normals[point * 3]);
+            for (int64_t i = point_offsets[point]; i < point_offsets[point + 1]; ++i)
+            {
+                const int64_t vertex = point_vertices[i];
+
+                // Already written as part of an earlier vertex's group
+                if (tangents[vertex * 4 + 3] != 0.0f)
+                    continue;
+
+                const float* uv = &uvs[vertex * uv_tuple_size];
+                group.clear();
+                Vec3 tangent = zero3();
+                Vec3 bitangent = zero3();
+                for (int64_t j = i; j < point_offsets[point + 1]; ++j)
+                {
+                    const int64_t other = point_vertices[j];
+                    const float* other_uv = &uvs[other * uv_tuple_size];
+                    if (other_uv[0] != uv[0] || other_uv[1] != uv[1])
+                        continue;
+
+                    group.push_back(other);
+                    tangent = add(tangent, load3(&face_tangents[vertex_faces[other] * 6]));
+                    bitangent = add(bitangent, load3(&face_tangents[vertex_faces[other] * 6 + 3]));
+                }
+
+                // Gram-Schmidt against the normal, falling back to any perpendicular direction
+                // where the uvs are degenerate
+                Vec3 orthogonal = normalize(sub(tangent, scale(normal, dot(normal, tangent))));
+                if (dot(orthogonal, orthogonal) == 0.0f)
+                {
+                    const float axis[3] = { 1.0f, 0.0f, 0.0f };
+                    const float other_axis[3] = { 0.0f, 1.0f, 0.0f };
+                    Vec3 fallback = load3(std::fabs(dot(normal, load3(axis))) < 0.9f ? axis : other_axis);
+                    orthogonal = normalize(sub(fallback, scale(normal, dot(normal, fallback))));
+                }
+                const float handedness = dot(cross(normal, orthogonal), bitangent) < 0.0f ? -1.0f : 1.0f;
+
+                for (int64_t member : group)
+                {
+                    store3(orthogonal, &tangents[member * 4]);
+                    tangents[member * 4 + 3] = handedness;
+                }
+            }
+        }
+    });
+    return true;
+}
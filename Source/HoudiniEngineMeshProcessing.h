@@ -0,0 +1,67 @@
+/*
+* Copyright (c) <2023> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+// Axis-aligned bounding box, empty (min greater than max) when it holds no points
+struct HoudiniEngineBounds
+{
+    float min[3] = { 1.0f, 1.0f, 1.0f };
+    float max[3] = { -1.0f, -1.0f, -1.0f };
+
+    bool isEmpty() const { return min[0] > max[0]; }
+};
+
+// Host-side processing of fetched meshes, so that Houdini does not need to cook and transfer
+// the attributes it produces. Positions and normals are packed xyz point arrays, faces are
+// given as counts and a vertex list of point indices, and faces wind clockwise as in Houdini.
+//
+// The work is split across threads for large meshes, and uses SSE2 where the compiler targets
+// it, with a scalar fallback elsewhere.
+struct HoudiniEngineMeshProcessing
+{
+public:
+    static HoudiniEngineBounds computeBounds(const std::vector<float>& positions);
+
+    // Grow bounds to hold point_count more packed xyz positions, such as one fetched chunk
+    static void expandBounds(HoudiniEngineBounds& bounds, const float* positions, int64_t point_count);
+
+    // Unit point normals, averaged from the normals of the faces around each point weighted by
+    // face area. Points not used by any face get a zero normal. Fails on an invalid vertex list.
+    static bool computeNormals(const std::vector<float>& positions, const std::vector<int>& face_counts,
+                               const std::vector<int>& vertex_list, std::vector<float>& normals);
+
+    // Unit vertex tangents (xyzw, w being the bitangent sign) following the MikkTSpace
+    // conventions: face tangents are accumulated over the vertices that share a point and a uv,
+    // so that uv seams are kept, then made orthogonal to the point normal. uvs are vertex values
+    // of uv_tuple_size floats, of which the first two are used.
+    static bool computeTangents(const std::vector<float>& positions, const std::vector<float>& normals,
+                                const std::vector<float>& uvs, int uv_tuple_size, const std::vector<int>& face_counts,
+                                const std::vector<int>& vertex_list, std::vector<float>& tangents);
+};
@@ -0,0 +1,247 @@
+/*
+* Copyright (c) <2023> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "HoudiniApi.h"
+#include "HoudiniEngineNodeGraph.h"
+#include "HoudiniEngineTrace.h"
+#include "HoudiniEngineUtility.h"
+
+#include <iostream>
+
+void
+HoudiniEngineNodeGraph::addNode(const std::string& key, const std::string& operator_name, const std::string& label)
+{
+    Node node;
+    node.key = key;
+    node.operatorName = operator_name;
+    node.label = label;
+    myNodes.push_back(node);
+}
+
+void
+HoudiniEngineNodeGraph::addInputNode(const std::string& key, const std::string& label)
+{
+    Node node;
+    node.key = key;
+    node.label = label;
+    node.isInput = true;
+    myNodes.push_back(node);
+}
+
+void
+HoudiniEngineNodeGraph::connect(const std::string& from_key, const std::string& to_key, int input_index, int output_index)
+{
+    Connection connection;
+    connection.fromKey = from_key;
+    connection.toKey = to_key;
+    connection.inputIndex = input_index;
+    connection.outputIndex = output_index;
+    myConnections.push_back(connection);
+}
+
+void
+HoudiniEngineNodeGraph::setOutput(const std::string& key)
+{
+    myOutputKey = key;
+}
+
+bool
+HoudiniEngineNodeGraph::build(const HAPI_Session* session, HAPI_NodeId parent_id)
+{
+    HOUDINI_TRACE_SCOPE("buildNodeGraph");
+
+    if (isBuilt(session))
+        return true;
+
+    // Remove what is left of an earlier build in this session; ids from another session are stale
+    destroy(session);
+    mySessionType = session->type;
+    mySessionId = session->id;
+
+    auto fail = [&]()
+    {
+        destroy(session);
+        return false;
+    };
+
+    // Input nodes first, so the other nodes can go in the first input's network
+    for (Node& node : myNodes)
+    {
+        if (!node.isInput)
+            continue;
+
+        std::cout << "  Creating input node '" << node.label << "'" << std::endl;
+        HOUDINI_CHECK_ERROR_RETURN(
+            HoudiniApi::CreateInputNode(session, parent_id, &node.id, node.label.c_str()), fail());
+
+        // The first input node without a parent comes in an OBJ container of its own
+        if (parent_id < 0)
+        {
+            HAPI_NodeInfo node_info = HoudiniApi::NodeInfo_Create();
+            HOUDINI_CHECK_ERROR_RETURN(
+                HoudiniApi::GetNodeInfo(session, node.id, &node_info), fail());
+            parent_id = node_info.parentId;
+            myContainerId = parent_id;
+        }
+    }
+
+    // Nothing cooks until the whole network is wired
+    for (Node& node : myNodes)
+    {
+        if (node.isInput)
+            continue;
+
+        std::cout << "  Creating " << node.operatorName << " node '" << node.label << "'" << std::endl;
+        HOUDINI_CHECK_ERROR_RETURN(
+            HoudiniApi::CreateNode(session, parent_id, node.operatorName.c_str(), node.label.c_str(), false, &node.id), fail());
+    }
+
+    for (const Connection& connection : myConnections)
+    {
+        HAPI_NodeId from_node = getNodeId(connection.fromKey);
+        HAPI_NodeId to_node = getNodeId(connection.toKey);
+        if (from_node < 0 || to_node < 0)
+        {
+            std::cerr << "Invalid connection from '" << connection.fromKey << "' to '" << connection.toKey << "'." << std::endl;
+            return fail();
+        }
+
+        HOUDINI_CHECK_ERROR_RETURN(
+            HoudiniApi::ConnectNodeInput(session, to_node, connection.inputIndex, from_node, connection.outputIndex), fail());
+    }
+
+    HAPI_NodeId output_node = getNodeId(myOutputKey);
+    if (output_node >= 0)
+    {
+        HOUDINI_CHECK_ERROR_RETURN(
+            HoudiniApi::SetNodeDisplay(session, output_node, 1), fail());
+    }
+
+    for (Node& node : myNodes)
+    {
+        HAPI_NodeInfo node_info = HoudiniApi::NodeInfo_Create();
+        HOUDINI_CHECK_ERROR_RETURN(
+            HoudiniApi::GetNodeInfo(session, node.id, &node_info), fail());
+        node.uniqueId = node_info.uniqueHoudiniNodeId;
+    }
+
+    return true;
+}
+
+bool
+HoudiniEngineNodeGraph::isBuilt(const HAPI_Session* session) const
+{
+    if (!session || session->type != mySessionType || session->id != mySessionId)
+        return false;
+
+    if (getNodeId(myOutputKey) < 0)
+        return false;
+
+    // Any node deleted since, not just the output, breaks the network
+    for (const Node& node : myNodes)
+    {
+        HAPI_Bool is_valid = false;
+        if (node.id < 0 ||
+            HoudiniApi::IsNodeValid(session, node.id, node.uniqueId, &is_valid) != HAPI_RESULT_SUCCESS || !is_valid)
+            return false;
+    }
+    return true;
+}
+
+bool
+HoudiniEngineNodeGraph::cook(const HAPI_Session* session, const HAPI_CookOptions* cook_options) const
+{
+    HOUDINI_TRACE_SCOPE("cookNodeGraph");
+
+    HAPI_NodeId output_node = getNodeId(myOutputKey);
+    if (output_node < 0)
+    {
+        std::cerr << "The node graph has no built output node." << std::endl;
+        return false;
+    }
+
+    HOUDINI_CHECK_ERROR_RETURN(
+        HoudiniApi::CookNode(session, output_node, cook_options), false);
+
+    int cook_status = HAPI_STATE_MAX;
+    HAPI_Result result;
+    do
+    {
+        result = HoudiniApi::GetStatus(session, HAPI_STATUS_COOK_STATE, &cook_status);
+    }
+    while (cook_status > HAPI_STATE_MAX_READY_STATE && result == HAPI_RESULT_SUCCESS);
+
+    HOUDINI_CHECK_ERROR_RETURN(result, false);
+
+    if (cook_status != HAPI_STATE_READY)
+    {
+        std::cerr << "Cook failed: " << HoudiniEngineUtility::getLastCookError() << std::endl;
+        return false;
+    }
+
+    return true;
+}
+
+HAPI_NodeId
+HoudiniEngineNodeGraph::getNodeId(const std::string& key) const
+{
+    const Node* node = findNode(key);
+    return node ? node->id : -1;
+}
+
+void
+HoudiniEngineNodeGraph::destroy(const HAPI_Session* session)
+{
+    // Only the session the nodes were built in holds them
+    const bool built_in_session = session && session->type == mySessionType && session->id == mySessionId;
+
+    // Delete the downstream nodes before the inputs they read from
+    for (auto node = myNodes.rbegin(); node != myNodes.rend(); ++node)
+    {
+        if (built_in_session && node->id >= 0)
+            HoudiniApi::DeleteNode(session, node->id);
+        node->id = -1;
+        node->uniqueId = -1;
+    }
+
+    if (built_in_session && myContainerId >= 0)
+        HoudiniApi::DeleteNode(session, myContainerId);
+    myContainerId = -1;
+
+    mySessionType = HAPI_SESSION_MAX;
+    mySessionId = -1;
+}
+
+const HoudiniEngineNodeGraph::Node*
+HoudiniEngineNodeGraph::findNode(const std::string& key) const
+{
+    for (const Node& node : myNodes)
+    {
+        if (node.key == key)
+            return &node;
+    }
+    return nullptr;
+}
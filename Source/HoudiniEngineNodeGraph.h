@@ -0,0 +1,103 @@
+/*
+* Copyright (c) <2023> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#pragma once
+
+#include <HAPI/HAPI.h>
+
+#include <string>
+#include <vector>
+
+// A declarative node network: describe the nodes and their connections, then build
+// creates them all with cooking disabled, wires them, and cook() cooks the output once.
+// The created node ids are kept, so later builds for the same session reuse the network
+// instead of recreating it.
+class HoudiniEngineNodeGraph
+{
+public:
+    // Describe a node created with CreateNode from its operator name
+    void addNode(const std::string& key, const std::string& operator_name, const std::string& label);
+
+    // Describe an input node, created with CreateInputNode, whose geometry is set by the caller
+    void addInputNode(const std::string& key, const std::string& label);
+
+    // Connect output output_index of from_key to input input_index of to_key
+    void connect(const std::string& from_key, const std::string& to_key, int input_index = 0, int output_index = 0);
+
+    // The node given the display flag and cooked by cook()
+    void setOutput(const std::string& key);
+
+    // Create and wire every node under parent_id, or in the network of the first input node
+    // when parent_id is -1. Nothing is cooked. A network already built for this session that
+    // still exists is reused as is.
+    bool build(const HAPI_Session* session, HAPI_NodeId parent_id);
+
+    // True when the network was built for this session and every one of its nodes still exists
+    bool isBuilt(const HAPI_Session* session) const;
+
+    // Cook the output node, and through it everything upstream, waiting for the cook to finish
+    bool cook(const HAPI_Session* session, const HAPI_CookOptions* cook_options) const;
+
+    // Id of a built node, -1 if unknown or not built
+    HAPI_NodeId getNodeId(const std::string& key) const;
+
+    // Delete the built nodes, and the OBJ container created along with the first input node
+    // when build was given no parent, keeping the description for the next build
+    void destroy(const HAPI_Session* session);
+
+private:
+    struct Node
+    {
+        std::string key;
+        std::string operatorName;
+        std::string label;
+        bool isInput = false;
+        HAPI_NodeId id = -1;
+        // To check that the node still exists
+        int uniqueId = -1;
+    };
+
+    struct Connection
+    {
+        std::string fromKey;
+        std::string toKey;
+        int inputIndex = 0;
+        int outputIndex = 0;
+    };
+
+    const Node* findNode(const std::string& key) const;
+
+    std::vector<Node> myNodes;
+    std::vector<Connection> myConnections;
+    std::string myOutputKey;
+
+    // Session the nodes were built in
+    HAPI_SessionType mySessionType = HAPI_SESSION_MAX;
+    HAPI_SessionId mySessionId = -1;
+
+    // OBJ node created to hold the network when build was given no parent, -1 otherwise
+    HAPI_NodeId myContainerId = -1;
+};
@@ -30,8 +30,15 @@
     #include "Windows.h"
 #else
     #include <dlfcn.h>
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
 #endif
 
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
 #include <iostream>
 #include <string>
 
@@ -40,44 +47,99 @@ const char* HAPI_LIB_OBJECT_WINDOWS = "libHAPIL.dll";
 const char* HAPI_LIB_OBJECT_LINUX = "libHAPIL.so";
 const char* HAPI_LIB_OBJECT_MAC = "libHAPIL.dylib";
 
+// Environment variable holding the path of a library to load instead of libHAPIL,
+// such as the FakeHAPIL stand-in
+const char* HAPI_LIB_OVERRIDE_VARIABLE = "HOUDINI_ENGINE_LIBHAPIL";
+
+// Environment variable selecting immediate symbol binding when set to 1
+const char* HAPI_LIB_BIND_NOW_VARIABLE = "HOUDINI_ENGINE_LIBHAPIL_BIND_NOW";
+
+// Duration of the last LoadLibHAPIL call
+static std::atomic<double> theLoadMilliseconds(0.0);
+
+static void*
+openLibrary(const char* library_path, bool bind_now)
+{
+#if defined(WIN32) || defined(_WIN32)
+    // Windows always binds imports at load time; look for the library's own dependencies next to it
+    return LoadLibraryEx(library_path, nullptr, LOAD_WITH_ALTERED_SEARCH_PATH);
+#else
+    return dlopen(library_path, bind_now ? RTLD_NOW | RTLD_LOCAL : RTLD_LAZY);
+#endif
+}
+
 void*
-HoudiniEnginePlatform::LoadLibHAPIL()
+HoudiniEnginePlatform::LoadLibHAPIL(const HoudiniEngineLibraryOptions& options)
 {
+    auto start = std::chrono::steady_clock::now();
     void* libHAPIL = nullptr;
 
-#if defined(WIN32) || defined(_WIN32)
-    // Look up the HFS environment variable
-    char *buf;
-    size_t len;
-    if (_dupenv_s(&buf, &len, "HFS") == 0 && buf != nullptr)
+    const char* bind_now_value = std::getenv(HAPI_LIB_BIND_NOW_VARIABLE);
+    bool bind_now = options.bindNow || (bind_now_value && std::string(bind_now_value) == "1");
+
+    std::string library_path = options.path;
+    if (library_path.empty())
     {
-        std::string libHAPIL_dir(buf);
-        free(buf);
+        const char* override_path = std::getenv(HAPI_LIB_OVERRIDE_VARIABLE);
+        if (override_path)
+            library_path = override_path;
+    }
 
-        libHAPIL_dir.append("/bin/");
-        if (SetDllDirectory(libHAPIL_dir.c_str()))
-        {
-            libHAPIL = LoadLibrary(HAPI_LIB_OBJECT_WINDOWS);
-        }
+    if (!library_path.empty())
+    {
+        libHAPIL = openLibrary(library_path.c_str(), bind_now);
+        if (libHAPIL == nullptr)
+            std::cerr << "Failed to load " << library_path << " in place of libHAPIL." << std::endl;
     }
     else
     {
-        std::cerr << "Unable to retrieve the value of the HFS environment variable." << std::endl;
-        return nullptr;
-    }
+#if defined(WIN32) || defined(_WIN32)
+        // Look up the HFS environment variable
+        char *buf;
+        size_t len;
+        if (_dupenv_s(&buf, &len, "HFS") == 0 && buf != nullptr)
+        {
+            std::string libHAPIL_dir(buf);
+            free(buf);
+
+            libHAPIL_dir.append("/bin/");
+            if (SetDllDirectory(libHAPIL_dir.c_str()))
+            {
+                libHAPIL = LoadLibrary(HAPI_LIB_OBJECT_WINDOWS);
+            }
+        }
+        else
+        {
+            std::cerr << "Unable to retrieve the value of the HFS environment variable." << std::endl;
+            return nullptr;
+        }
 #elif __linux__
-    // Location of libHAPIL on Mac & Linux added to the application's RPATH
-    libHAPIL = dlopen(HAPI_LIB_OBJECT_LINUX, RTLD_LAZY); 
+        // Location of libHAPIL on Mac & Linux added to the application's RPATH
+        libHAPIL = openLibrary(HAPI_LIB_OBJECT_LINUX, bind_now);
 #else
-    libHAPIL = dlopen(HAPI_LIB_OBJECT_MAC, RTLD_LAZY); 
+        libHAPIL = openLibrary(HAPI_LIB_OBJECT_MAC, bind_now);
 #endif
 
-    if (libHAPIL == nullptr)
-        std::cerr << "Failed to load the libHAPIL module." << std::endl;
+        if (libHAPIL == nullptr)
+            std::cerr << "Failed to load the libHAPIL module." << std::endl;
+    }
 
+    theLoadMilliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
     return libHAPIL;
 }
 
+std::future<void*>
+HoudiniEnginePlatform::PreloadLibHAPIL(const HoudiniEngineLibraryOptions& options)
+{
+    return std::async(std::launch::async, [options]() { return LoadLibHAPIL(options); });
+}
+
+double
+HoudiniEnginePlatform::GetLibHAPILLoadMilliseconds()
+{
+    return theLoadMilliseconds;
+}
+
 bool
 HoudiniEnginePlatform::FreeLibHAPIL(void* libHAPIL)
 {
@@ -97,3 +159,62 @@ HoudiniEnginePlatform::GetDllExport(void* LibraryHandle, const char* ExportName)
     return dlsym(LibraryHandle, ExportName);
 #endif
 }
+
+const void*
+HoudiniEnginePlatform::MapFile(const std::string& path, size_t& size)
+{
+    size = 0;
+#if defined(WIN32) || defined(_WIN32)
+    HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+        return nullptr;
+
+    LARGE_INTEGER file_size;
+    void* data = nullptr;
+    if (GetFileSizeEx(file, &file_size) && file_size.QuadPart > 0)
+    {
+        HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (mapping)
+        {
+            // The view keeps the mapping, and the file, open
+            data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+            CloseHandle(mapping);
+        }
+    }
+    CloseHandle(file);
+
+    if (data)
+        size = (size_t)file_size.QuadPart;
+    return data;
+#else
+    int file = open(path.c_str(), O_RDONLY);
+    if (file < 0)
+        return nullptr;
+
+    struct stat file_stat;
+    void* data = nullptr;
+    if (fstat(file, &file_stat) == 0 && file_stat.st_size > 0)
+    {
+        data = mmap(nullptr, (size_t)file_stat.st_size, PROT_READ, MAP_PRIVATE, file, 0);
+        if (data == MAP_FAILED)
+            data = nullptr;
+    }
+    close(file);
+
+    if (data)
+        size = (size_t)file_stat.st_size;
+    return data;
+#endif
+}
+
+void
+HoudiniEnginePlatform::UnmapFile(const void* data, size_t size)
+{
+    if (!data)
+        return;
+#if defined(WIN32) || defined(_WIN32)
+    UnmapViewOfFile(data);
+#else
+    munmap(const_cast<void*>(data), size);
+#endif
+}
@@ -26,14 +26,42 @@
 
 #pragma once
 
+#include <cstddef>
+#include <future>
+#include <string>
+
+// How LoadLibHAPIL locates and binds the library
+struct HoudiniEngineLibraryOptions
+{
+    // Explicit library path. When empty, the HOUDINI_ENGINE_LIBHAPIL environment variable
+    // is used, then the default libHAPIL name found through the RPATH (or HFS on Windows).
+    std::string path;
+
+    // Resolve every symbol at load time (RTLD_NOW | RTLD_LOCAL) instead of on first call
+    // (RTLD_LAZY). Also enabled by HOUDINI_ENGINE_LIBHAPIL_BIND_NOW=1.
+    bool bindNow = false;
+};
+
 struct HoudiniEnginePlatform
 {
     // Dynamically load the libHAPIL shared library
-    static void* LoadLibHAPIL();
+    static void* LoadLibHAPIL(const HoudiniEngineLibraryOptions& options = HoudiniEngineLibraryOptions());
+
+    // Load libHAPIL on a background thread, so the load overlaps the rest of startup
+    static std::future<void*> PreloadLibHAPIL(const HoudiniEngineLibraryOptions& options);
+
+    // Duration of the last LoadLibHAPIL call, in milliseconds
+    static double GetLibHAPILLoadMilliseconds();
 
     // Decrement the reference count of the libHAPIL module, freed at 0
     static bool FreeLibHAPIL(void* libHAPIL);
 
     // Return the address of the symbol name 'ExportName' in the dynamically loaded library
     static void* GetDllExport(void* LibraryHandle, const char* ExportName);
+
+    // Map a whole file read-only into memory; the file can be closed and the view stays valid
+    // until UnmapFile. Returns nullptr for missing or empty files.
+    static const void* MapFile(const std::string& path, size_t& size);
+
+    static void UnmapFile(const void* data, size_t size);
 };
@@ -25,13 +25,22 @@
 */
 
 #include "HoudiniApi.h"
+#include "HoudiniEngineBatch.h"
 #include "HoudiniEngineGeometry.h"
 #include "HoudiniEngineManager.h"
 #include "HoudiniEnginePlatform.h"
+#include "HoudiniEngineTrace.h"
 #include "HoudiniEngineUtility.h"
 
+#include <chrono>
+#include <cmath>
+#include <future>
 #include <iostream>
+#include <limits>
+#include <map>
+#include <sstream>
 #include <string>
+#include <vector>
 
 void
 printCommandMenu()
@@ -40,15 +49,30 @@ printCommandMenu()
     std::cout << "------------------------------" << std::endl;
     std::cout << "Working with HDAs" << std::endl;
     std::cout << "  - cook: Create & cook the hexagona sample HDA" << std::endl;
+    std::cout << "  - cookwith: Recook the hexagona sample HDA with a named cook profile" << std::endl;
+    std::cout << "    (default, triangulated, quads, ngons, splitbygroup)" << std::endl;
+    std::cout << "  - profile: Recook the hexagona sample HDA inside a performance monitor capture (.hperf)" << std::endl;
     std::cout << "  - parms: Fetch and print node parameters" << std::endl;
     std::cout << "  - attribs: Fetch and print node attributes" << std::endl;
     std::cout << "  - delight: Fetch and print node attributes" << std::endl;
+    std::cout << "  - cookpdg: Cook the PDG graph of a TOP node, listing work item outputs as they cook" << std::endl;
     std::cout << "Working with Geometry" << std::endl;
     std::cout << "  - setgeo: Marshal mesh data to Houdini" << std::endl;
+    std::cout << "  - deformgeo: Animate the marshalled mesh for 100 frames, resending only positions" << std::endl;
     std::cout << "  - getgeo: Read mesh data from Houdini" << std::endl;
+    std::cout << "  - getgeoblob: Read the mesh attribute by attribute and as a single .bgeo blob, and compare timings" << std::endl;
+    std::cout << "  - cachegeo: Read the hexagona mesh through an on-disk cache, reopening it while its parameters are unchanged" << std::endl;
+    std::cout << "  - gettextures: Render and extract the hexagona material textures to memory" << std::endl;
+    std::cout << "  - setcurves: Marshal a batch of curves, and a single editable curve, to Houdini" << std::endl;
+    std::cout << "  - getcurves: Read curve data from Houdini" << std::endl;
+    std::cout << "  - setheightfield: Marshal a procedural heightfield to Houdini" << std::endl;
+    std::cout << "  - getheightfield: Read the hexagona heightfield and build terrain LODs" << std::endl;
     std::cout << "Working with Sessions" << std::endl;
-    std::cout << "  - checkvalid: Check if the session is valid" << std::endl;
+    std::cout << "  - checkvalid: Check if the session is valid, failing over to the standby if not" << std::endl;
+    std::cout << "  - standby: Keep a warm standby session ready for fast failover" << std::endl;
+    std::cout << "  - restart: Restart the session, through the warm standby if there is one" << std::endl;
     std::cout << "General Commands" << std::endl;
+    std::cout << "  - trace: Start tracing, or stop and write the trace as Chrome trace JSON" << std::endl;
     std::cout << "  - help: Print menu of commands"  << std::endl;
     std::cout << "  - save: Save the Houdini session to a hip file" << std::endl;
     std::cout << "  - quit: Cleanup and shutdown the Houdini session" << std::endl;
@@ -61,23 +85,91 @@ main(int argc, char ** argv)
     std::cout << " Houdini Engine Sample Application " << std::endl;
     std::cout << "===================================\n" << std::endl;
 
+    auto launch_time = std::chrono::steady_clock::now();
+
+    // Library options come first so a preload can start before the rest is parsed
+    //   --libhapil path   load this library instead of libHAPIL
+    //   --bind-now        resolve every symbol at load time instead of lazily
+    //   --preload         load the library on a background thread during startup
+    HoudiniEngineLibraryOptions library_options;
+    bool preload = false;
+    for (int i = 1; i < argc; ++i)
+    {
+        std::string arg = argv[i];
+        if (arg == "--libhapil" && i + 1 < argc)
+            library_options.path = argv[++i];
+        else if (arg == "--bind-now")
+            library_options.bindNow = true;
+        else if (arg == "--preload")
+            preload = true;
+    }
+
+    std::future<void*> preloaded_libHAPIL;
+    if (preload)
+        preloaded_libHAPIL = HoudiniEnginePlatform::PreloadLibHAPIL(library_options);
+
     // Dynamically load the libHAPIL and load the HAPI
-    // functions exported from the dll
-    void* libHAPIL = HoudiniEnginePlatform::LoadLibHAPIL();
-    if (libHAPIL != nullptr)
-        HoudiniApi::InitializeHAPI(libHAPIL);
+    // functions exported from the dll, reporting how long startup took
+    void* libHAPIL = nullptr;
+    double startup_milliseconds = 0.0;
+    auto loadHAPI = [&]()
+    {
+        libHAPIL = preload ? preloaded_libHAPIL.get() : HoudiniEnginePlatform::LoadLibHAPIL(library_options);
+
+        auto bind_start = std::chrono::steady_clock::now();
+        if (libHAPIL != nullptr)
+            HoudiniApi::InitializeHAPI(libHAPIL);
+
+        auto ready_time = std::chrono::steady_clock::now();
+        startup_milliseconds = std::chrono::duration<double, std::milli>(ready_time - launch_time).count();
 
-    if (!HoudiniApi::IsHAPIInitialized())
+        if (!HoudiniApi::IsHAPIInitialized())
+        {
+            std::cerr << "Failed to load and initialize the "
+                         "Houdini Engine API from libHAPIL." << std::endl;
+            return false;
+        }
+
+        std::cout << "libHAPIL ready in " << startup_milliseconds << " ms (load "
+                  << HoudiniEnginePlatform::GetLibHAPILLoadMilliseconds() << " ms, bind "
+                  << std::chrono::duration<double, std::milli>(ready_time - bind_start).count() << " ms"
+                  << (preload ? ", preloaded" : "") << ")\n" << std::endl;
+        return true;
+    };
+
+    // Run a job description without any interaction (--batch job.txt [--report report.json])
+    std::string batch_job;
+    std::string batch_report;
+    for (int i = 1; i + 1 < argc; ++i)
     {
-        std::cerr << "Failed to load and initialize the "
-                     "Houdini Engine API from libHAPIL." << std::endl;
+        if (std::string(argv[i]) == "--batch")
+            batch_job = argv[++i];
+        else if (std::string(argv[i]) == "--report")
+            batch_report = argv[++i];
+    }
+
+    if (!batch_job.empty())
+    {
+        if (!loadHAPI())
+            return 1;
+
+        if (batch_report.empty())
+            batch_report = batch_job + ".report.json";
+
+        int exit_code = HoudiniEngineBatch::run(batch_job, batch_report, startup_milliseconds);
+        HoudiniApi::FinalizeHAPI();
+        HoudiniEnginePlatform::FreeLibHAPIL(libHAPIL);
+        return exit_code;
+    }
+
+    if (!preload && !loadHAPI())
         return 1;
-    }  
 
     std::cout << "Start a new Houdini Engine Session via HARS:" << std::endl;
     std::cout << "  1: In-Process Session" << std::endl;
     std::cout << "  2: Named-Pipe Session" << std::endl;
-    std::cout << "  3: TCP Socket Session\n" << std::endl;
+    std::cout << "  3: TCP Socket Session" << std::endl;
+    std::cout << "  7: Shared Memory Session\n" << std::endl;
     std::cout << "Connect to an existing Houdini Engine Session via SessionSync:" << std::endl;
     std::cout << "  4: Existing Named-Pipe Session" << std::endl;
     std::cout << "  5: Existing TCP Socket Session" << std::endl;
@@ -91,6 +183,8 @@ main(int argc, char ** argv)
     std::string named_pipe = DEFAULT_NAMED_PIPE;
     int tcp_port = DEFAULT_TCP_PORT;
     std::string shared_mem_name;
+    HAPI_ThriftSharedMemoryBufferType shared_mem_buffer_type = HAPI_THRIFT_SHARED_MEMORY_FIXED_LENGTH_BUFFER;
+    HAPI_Int64 shared_mem_buffer_size = DEFAULT_SHARED_MEMORY_BUFFER_SIZE;
 
     if (session_type == HoudiniEngineManager::SessionType::ExistingNamedPipe)
     {
@@ -104,6 +198,25 @@ main(int argc, char ** argv)
         std::cout << ">> ";
         std::cin >> tcp_port;
     }
+    else if (session_type == HoudiniEngineManager::SessionType::NewSharedMemory)
+    {
+        shared_mem_name = DEFAULT_SHARED_MEMORY_NAME;
+
+        std::string buffer_type;
+        std::cout << "Please specify the shared memory buffer, fixed or ring, and its size in MB (e.g. fixed "
+                  << DEFAULT_SHARED_MEMORY_BUFFER_SIZE << "):" << std::endl;
+        std::cout << ">> ";
+        std::cin >> buffer_type >> shared_mem_buffer_size;
+        if (!HoudiniEngineManager::parseSharedMemoryBufferType(buffer_type, shared_mem_buffer_type) ||
+            shared_mem_buffer_size <= 0)
+        {
+            std::cout << "Invalid buffer, using a fixed " << DEFAULT_SHARED_MEMORY_BUFFER_SIZE << " MB buffer." << std::endl;
+            std::cin.clear();
+            std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+            shared_mem_buffer_type = HAPI_THRIFT_SHARED_MEMORY_FIXED_LENGTH_BUFFER;
+            shared_mem_buffer_size = DEFAULT_SHARED_MEMORY_BUFFER_SIZE;
+        }
+    }
     else if (session_type == HoudiniEngineManager::SessionType::ExistingSharedMemory)
     {
         std::cout << "Please specify the shared memory name:" << std::endl;
@@ -111,6 +224,10 @@ main(int argc, char ** argv)
         std::cin >> shared_mem_name;
     }
 
+    // A preloaded library has had the prompts above to finish loading
+    if (preload && !loadHAPI())
+        return 1;
+
     HoudiniEngineManager* he_manager = new HoudiniEngineManager();
     if (!he_manager)
     {
@@ -118,6 +235,7 @@ main(int argc, char ** argv)
         return 1;
     }
 
+    he_manager->setSharedMemoryBuffer(shared_mem_buffer_type, shared_mem_buffer_size);
     if (!he_manager->startSession(
         (HoudiniEngineManager::SessionType)session_type, named_pipe, tcp_port, shared_mem_name))
     {
@@ -151,6 +269,10 @@ main(int argc, char ** argv)
     bool mesh_data_generated = false;
     HAPI_NodeId input_mesh_node_id = 0;
 
+    bool curve_data_generated = false;
+    HAPI_NodeId input_curves_node_id = 0;
+    HAPI_NodeId input_curve_node_id = 0;
+
     printCommandMenu();
     while (user_cmd != "quit")
     {   
@@ -159,8 +281,40 @@ main(int argc, char ** argv)
 
         if (user_cmd == "cook")
         {
+            // Replace the node from an earlier cook rather than leaving it in the session
+            if (hexagona_cook)
+                he_manager->deleteNode(hexagona_node_id);
             hexagona_cook = he_manager->createAndCookNode(asset_name.c_str(), &hexagona_node_id);
         }
+        else if (user_cmd == "cookwith")
+        {
+            if (hexagona_cook)
+            {
+                std::string profile;
+                std::cout << "\nCook profile: ";
+                std::cin >> profile;
+                he_manager->cookNode(hexagona_node_id, profile);
+            }
+            else
+                std::cerr << "\nThe hexagona sample HDA must be cooked before "
+                             "it can be recooked with a profile (cmd cook)." << std::endl;
+        }
+        else if (user_cmd == "profile")
+        {
+            if (hexagona_cook)
+            {
+                std::string profile;
+                std::string hperf_path;
+                std::cout << "\nCook profile: ";
+                std::cin >> profile;
+                std::cout << "Performance monitor file (.hperf): ";
+                std::cin >> hperf_path;
+                he_manager->profileCook(hexagona_node_id, profile, hperf_path);
+            }
+            else
+                std::cerr << "\nThe hexagona sample HDA must be cooked before "
+                             "it can be profiled (cmd cook)." << std::endl;
+        }
         else if (user_cmd == "parms")
         {
             if (hexagona_cook)
@@ -185,11 +339,51 @@ main(int argc, char ** argv)
                 std::cerr << "\nThe hexagona sample HDA must be cooked before "
                              "you can query its attributes (cmd cook)." << std::endl;
         }
+        else if (user_cmd == "cookpdg")
+        {
+            std::string top_node_path;
+            std::cout << "\nTOP node path: ";
+            std::cin >> top_node_path;
+
+            HAPI_NodeId top_node_id = -1;
+            if (HoudiniApi::GetNodeFromPath(he_manager->getSession(), -1, top_node_path.c_str(), &top_node_id) != HAPI_RESULT_SUCCESS)
+            {
+                std::cerr << "\nCould not find the TOP node " << top_node_path << "." << std::endl;
+            }
+            else if (he_manager->startPdgCook(top_node_id, [](const HoudiniEngineManager::PdgWorkItem& work_item)
+                {
+                    std::cout << "  Work item " << work_item.name << " cooked" << std::endl;
+                    for (const std::string& output_file : work_item.outputFiles)
+                        std::cout << "    " << output_file << std::endl;
+                }))
+            {
+                he_manager->waitForPdgCook();
+            }
+        }
         else if (user_cmd == "setgeo")
         {
             mesh_data_generated = HoudiniEngineGeometry::sendGeometryToHoudini(
                 he_manager->getSession(), he_manager->getCookOptions(), &input_mesh_node_id);
         }
+        else if (user_cmd == "deformgeo")
+        {
+            // Each frame reuses the input node and only rewrites P
+            const int frame_count = 100;
+            auto start = std::chrono::steady_clock::now();
+            for (int frame = 1; frame <= frame_count && mesh_data_generated; ++frame)
+            {
+                mesh_data_generated = HoudiniEngineGeometry::sendGeometryToHoudini(
+                    he_manager->getSession(), he_manager->getCookOptions(), &input_mesh_node_id, frame * 0.05f);
+            }
+            double milliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+            if (mesh_data_generated)
+                std::cout << "\nDeformed the mesh for " << frame_count << " frames in " << milliseconds << " ms ("
+                          << milliseconds / frame_count << " ms per frame)" << std::endl;
+            else
+                std::cerr << "\nMesh data must be set and sent to Houdini "
+                             "before it can be deformed (cmd setgeo)." << std::endl;
+        }
         else if (user_cmd == "getgeo")
         {
             if (mesh_data_generated)
@@ -202,6 +396,185 @@ main(int argc, char ** argv)
                 std::cerr << "\nMesh data must be set and sent to Houdini to "
                              "cook before it can be queried (cmd setgeo)." << std::endl;
         }
+        else if (user_cmd == "getgeoblob")
+        {
+            if (mesh_data_generated)
+            {
+                // Same mesh through both transports: many small calls against one blob decoded on the host
+                HoudiniEngineMesh attribute_mesh;
+                auto start = std::chrono::steady_clock::now();
+                bool read = HoudiniEngineGeometry::readMeshFromHoudini(he_manager->getSession(), input_mesh_node_id, attribute_mesh);
+                double attribute_milliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+                HoudiniEngineMesh blob_mesh;
+                start = std::chrono::steady_clock::now();
+                read = read && HoudiniEngineGeometry::readMeshBgeoFromHoudini(he_manager->getSession(), input_mesh_node_id, blob_mesh);
+                double blob_milliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+                if (read)
+                {
+                    std::cout << "\nRead " << blob_mesh.pointCount << " points, " << blob_mesh.faceCounts.size() << " faces and "
+                              << blob_mesh.attributes.size() << " attributes" << std::endl;
+                    std::cout << "  Attribute by attribute: " << attribute_milliseconds << " ms" << std::endl;
+                    std::cout << "  Single .bgeo blob: " << blob_milliseconds << " ms" << std::endl;
+                }
+            }
+            else
+                std::cerr << "\nMesh data must be set and sent to Houdini to "
+                             "cook before it can be queried (cmd setgeo)." << std::endl;
+        }
+        else if (user_cmd == "cachegeo")
+        {
+            if (hexagona_cook)
+            {
+                // The first read fetches the mesh and writes the cache, later reads only map the file
+                const std::string cache_path = "hexagona.hemc";
+                auto start = std::chrono::steady_clock::now();
+                uint64_t key = 0;
+                HoudiniEngineMeshCache cache;
+                if (HoudiniEngineGeometry::getMeshCacheKey(he_manager->getSession(), hexagona_node_id, key) &&
+                    HoudiniEngineGeometry::readMeshCached(he_manager->getSession(), hexagona_node_id, cache_path, key, true, cache))
+                {
+                    double milliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+                    std::cout << "\nRead " << cache.getPointCount() << " points, " << cache.getFaceCounts().size << " faces and "
+                              << cache.getAttributes().size() << " attributes through " << cache_path << " in "
+                              << milliseconds << " ms" << std::endl;
+                }
+            }
+            else
+                std::cerr << "\nThe hexagona sample HDA must be cooked before "
+                             "its mesh can be cached (cmd cook)." << std::endl;
+        }
+        else if (user_cmd == "gettextures")
+        {
+            if (hexagona_cook)
+            {
+                // e.g. PNG and ogl_tex1,basecolor_texture
+                std::string image_format;
+                std::string parm_list;
+                std::cout << "\nImage format (PNG, JPEG, ...): ";
+                std::cin >> image_format;
+                std::cout << "Texture parameters (comma separated): ";
+                std::cin >> parm_list;
+
+                std::vector<std::string> texture_parms;
+                std::stringstream parm_stream(parm_list);
+                std::string parm_name;
+                while (std::getline(parm_stream, parm_name, ','))
+                {
+                    if (!parm_name.empty())
+                        texture_parms.push_back(parm_name);
+                }
+
+                HoudiniEngineTextures textures;
+                if (HoudiniEngineGeometry::readTexturesFromHoudini(
+                        he_manager->getSession(), hexagona_node_id, texture_parms, image_format.c_str(), textures))
+                {
+                    std::cout << "\nTexture count: " << textures.textures.size()
+                              << " (" << textures.images.size() << " unique)" << std::endl;
+                    for (const HoudiniEngineTexture& texture : textures.textures)
+                    {
+                        std::cout << "  " << texture.parmName << " of material " << texture.materialNode << ": "
+                                  << texture.xRes << "x" << texture.yRes << ", "
+                                  << textures.images[texture.imageIndex].size() << " bytes" << std::endl;
+                    }
+                }
+            }
+            else
+                std::cerr << "\nThe hexagona sample HDA must be cooked before "
+                             "its textures can be extracted (cmd cook)." << std::endl;
+        }
+        else if (user_cmd == "setcurves")
+        {
+            // A fan of helical curves with varying vertex counts
+            HoudiniEngineCurves curves;
+            curves.curveType = HAPI_CURVETYPE_LINEAR;
+            for (int c = 0; c < 1000; ++c)
+            {
+                int vertex_count = 8 + c % 24;
+                curves.counts.push_back(vertex_count);
+                curves.orders.push_back(2);
+                for (int v = 0; v < vertex_count; ++v)
+                {
+                    float t = v * 0.25f;
+                    curves.positions.push_back(c + std::cos(t));
+                    curves.positions.push_back(t);
+                    curves.positions.push_back(std::sin(t));
+                }
+            }
+
+            curve_data_generated = HoudiniEngineGeometry::sendCurvesToHoudini(
+                he_manager->getSession(), he_manager->getCookOptions(), curves, &input_curves_node_id);
+
+            // A single editable NURBS helix, oriented and scaled per point
+            const int point_count = 32;
+            std::vector<float> positions, rotations, scales;
+            for (int p = 0; p < point_count; ++p)
+            {
+                float t = p * 0.25f;
+                positions.insert(positions.end(), { std::cos(t), t, std::sin(t) });
+                rotations.insert(rotations.end(), { 0.0f, std::sin(-t * 0.5f), 0.0f, std::cos(-t * 0.5f) });
+                float scale = 1.0f + 0.5f * std::sin(t);
+                scales.insert(scales.end(), { scale, scale, scale });
+            }
+
+            HoudiniEngineGeometry::sendCurveToHoudini(
+                he_manager->getSession(), he_manager->getCookOptions(),
+                positions.data(), rotations.data(), scales.data(), point_count,
+                HAPI_CURVETYPE_NURBS, 4, false, &input_curve_node_id);
+        }
+        else if (user_cmd == "getcurves")
+        {
+            std::vector<HoudiniEngineCurves> curve_parts;
+            if (curve_data_generated)
+                HoudiniEngineGeometry::readCurvesFromHoudini(
+                    he_manager->getSession(), input_curves_node_id, he_manager->getCookOptions(), curve_parts);
+            else
+                std::cerr << "\nCurve data must be set and sent to Houdini to "
+                             "cook before it can be queried (cmd setcurves)." << std::endl;
+        }
+        else if (user_cmd == "setheightfield")
+        {
+            // Rolling procedural terrain, with a mask on the upper slopes
+            const int hf_size = 512;
+            std::vector<float> heights(hf_size * hf_size);
+            std::vector<float> mask(hf_size * hf_size);
+            for (int y = 0; y < hf_size; ++y)
+            {
+                for (int x = 0; x < hf_size; ++x)
+                {
+                    float h = 10.0f * std::sin(x * 0.02f) * std::cos(y * 0.03f);
+                    heights[y * hf_size + x] = h;
+                    mask[y * hf_size + x] = h > 5.0f ? 1.0f : 0.0f;
+                }
+            }
+
+            HAPI_NodeId heightfield_node_id = -1;
+            HoudiniEngineGeometry::sendHeightFieldToHoudini(
+                he_manager->getSession(), he_manager->getCookOptions(),
+                "Terrain", hf_size, hf_size, 1.0f,
+                heights.data(), mask.data(), {}, &heightfield_node_id);
+        }
+        else if (user_cmd == "getheightfield")
+        {
+            if (hexagona_cook)
+            {
+                std::vector<HoudiniEngineHeightField> layers;
+                if (HoudiniEngineGeometry::readHeightFieldFromHoudini(
+                    he_manager->getSession(), hexagona_node_id, he_manager->getCookOptions(), layers))
+                {
+                    for (const HoudiniEngineHeightField& layer : layers)
+                    {
+                        std::vector<HoudiniEngineHeightFieldTile> tiles;
+                        HoudiniEngineGeometry::buildHeightFieldLODs(layer, 64, 4, tiles);
+                        std::cout << "  Layer '" << layer.name << "' LOD tiles: " << tiles.size() << std::endl;
+                    }
+                }
+            }
+            else
+                std::cerr << "\nThe hexagona sample HDA must be cooked before "
+                             "you can query its heightfield (cmd cook)." << std::endl;
+        }
         else if (user_cmd == "checkvalid")
         {
             HAPI_Session* session = he_manager->getSession();
@@ -220,6 +593,19 @@ main(int argc, char ** argv)
             else if (result == HAPI_RESULT_INVALID_SESSION)
             {
                 std::cout << "The session is INVALID." << std::endl;
+
+                // Input nodes are not replayed, only nodes created by the manager
+                std::map<HAPI_NodeId, HAPI_NodeId> replayed_nodes;
+                if (he_manager->checkSessionHealth(&replayed_nodes))
+                {
+                    if (replayed_nodes.count(hexagona_node_id))
+                        hexagona_node_id = replayed_nodes[hexagona_node_id];
+                    else
+                        hexagona_cook = false;
+
+                    mesh_data_generated = false;
+                    curve_data_generated = false;
+                }
             }
             else
             {
@@ -227,6 +613,42 @@ main(int argc, char ** argv)
                     << "Something went wrong." << std::endl;
             }
         }
+        else if (user_cmd == "restart")
+        {
+            // Only a warm standby replays the nodes created by the manager; input nodes are never replayed
+            std::map<HAPI_NodeId, HAPI_NodeId> replayed_nodes;
+            he_manager->restartSession((HoudiniEngineManager::SessionType)session_type, use_cooking_thread, &replayed_nodes);
+
+            if (hexagona_cook && replayed_nodes.count(hexagona_node_id))
+                hexagona_node_id = replayed_nodes[hexagona_node_id];
+            else
+                hexagona_cook = false;
+
+            mesh_data_generated = false;
+            curve_data_generated = false;
+        }
+        else if (user_cmd == "standby")
+        {
+            if (he_manager->enableWarmStandby(true))
+                std::cout << "Warm standby enabled." << std::endl;
+        }
+        else if (user_cmd == "trace")
+        {
+            if (!HoudiniEngineTrace::isEnabled())
+            {
+                HoudiniEngineTrace::clear();
+                HoudiniEngineTrace::setEnabled(true);
+                std::cout << "Tracing started." << std::endl;
+            }
+            else
+            {
+                std::string filename;
+                std::cout << "\nFilename (.json) to write the trace to: ";
+                std::cin >> filename;
+                HoudiniEngineTrace::setEnabled(false);
+                HoudiniEngineTrace::exportChromeTrace(filename);
+            }
+        }
         else if(user_cmd == "help")
         {
             printCommandMenu();
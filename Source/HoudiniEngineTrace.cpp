@@ -0,0 +1,193 @@
+/*
+* Copyright (c) <2023> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "HoudiniEngineTrace.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+// Spans kept per thread, the oldest ones are overwritten
+static const size_t TRACE_BUFFER_CAPACITY = 64 * 1024;
+
+struct TraceSpan
+{
+    const char* name;
+    long long start;    // nanoseconds since the trace epoch
+    long long duration;
+};
+
+// A ring of spans written by one thread at a time. The per-buffer mutex is uncontended
+// except while the exporter or clear() reads it.
+struct TraceBuffer
+{
+    int threadIndex = 0;
+    std::mutex mutex;
+    std::vector<TraceSpan> spans = std::vector<TraceSpan>(TRACE_BUFFER_CAPACITY);
+    uint64_t count = 0;
+
+    // Spans before this one were cleared
+    uint64_t firstSpan = 0;
+};
+
+static std::atomic<bool> theTraceEnabled{ false };
+static const std::chrono::steady_clock::time_point theTraceEpoch = std::chrono::steady_clock::now();
+
+// Every buffer ever handed out, and those whose thread has exited. A new thread reuses a
+// released buffer, so there are only as many buffers as threads that were alive at once,
+// and the spans of finished threads stay exportable until the buffer is reused.
+static std::mutex theTraceBuffersMutex;
+static std::vector<std::shared_ptr<TraceBuffer>> theTraceBuffers;
+static std::vector<std::shared_ptr<TraceBuffer>> theFreeTraceBuffers;
+
+// Releases the calling thread's buffer back to the pool when the thread exits
+struct TraceBufferOwner
+{
+    std::shared_ptr<TraceBuffer> buffer;
+
+    ~TraceBufferOwner()
+    {
+        if (!buffer)
+            return;
+
+        std::lock_guard<std::mutex> lock(theTraceBuffersMutex);
+        theFreeTraceBuffers.push_back(buffer);
+    }
+};
+
+static TraceBuffer*
+getThreadTraceBuffer()
+{
+    thread_local TraceBufferOwner owner;
+    if (!owner.buffer)
+    {
+        std::lock_guard<std::mutex> lock(theTraceBuffersMutex);
+        if (!theFreeTraceBuffers.empty())
+        {
+            owner.buffer = theFreeTraceBuffers.back();
+            theFreeTraceBuffers.pop_back();
+        }
+        else
+        {
+            owner.buffer = std::make_shared<TraceBuffer>();
+            owner.buffer->threadIndex = (int)theTraceBuffers.size() + 1;
+            theTraceBuffers.push_back(owner.buffer);
+        }
+    }
+    return owner.buffer.get();
+}
+
+void
+HoudiniEngineTrace::setEnabled(bool enabled)
+{
+    theTraceEnabled.store(enabled, std::memory_order_relaxed);
+}
+
+bool
+HoudiniEngineTrace::isEnabled()
+{
+    return theTraceEnabled.load(std::memory_order_relaxed);
+}
+
+void
+HoudiniEngineTrace::record(const char* name, std::chrono::steady_clock::time_point start, std::chrono::steady_clock::time_point end)
+{
+    TraceBuffer* buffer = getThreadTraceBuffer();
+    std::lock_guard<std::mutex> lock(buffer->mutex);
+
+    TraceSpan& span = buffer->spans[buffer->count % TRACE_BUFFER_CAPACITY];
+    span.name = name;
+    span.start = std::chrono::duration_cast<std::chrono::nanoseconds>(start - theTraceEpoch).count();
+    span.duration = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+    ++buffer->count;
+}
+
+bool
+HoudiniEngineTrace::exportChromeTrace(const std::string& filename)
+{
+    std::ofstream trace_file(filename);
+    if (!trace_file)
+    {
+        std::cout << "Failed to open " << filename << " for writing." << std::endl;
+        return false;
+    }
+
+    std::vector<std::shared_ptr<TraceBuffer>> buffers;
+    {
+        std::lock_guard<std::mutex> lock(theTraceBuffersMutex);
+        buffers = theTraceBuffers;
+    }
+
+    // Complete ("X") events, with timestamps and durations in microseconds. Fixed notation keeps
+    // the nanoseconds of timestamps far from the epoch.
+    trace_file << std::fixed << std::setprecision(3);
+    trace_file << "{\"traceEvents\":[";
+    bool first = true;
+    size_t span_count = 0;
+    std::vector<TraceSpan> spans;
+    for (const std::shared_ptr<TraceBuffer>& buffer : buffers)
+    {
+        // Copy the live spans under the buffer lock so the file is written without holding it
+        spans.clear();
+        {
+            std::lock_guard<std::mutex> lock(buffer->mutex);
+            uint64_t begin = buffer->count > TRACE_BUFFER_CAPACITY ? buffer->count - TRACE_BUFFER_CAPACITY : 0;
+            begin = std::max(begin, buffer->firstSpan);
+            for (uint64_t i = begin; i < buffer->count; ++i)
+                spans.push_back(buffer->spans[i % TRACE_BUFFER_CAPACITY]);
+        }
+
+        for (const TraceSpan& span : spans)
+        {
+            trace_file << (first ? "\n" : ",\n")
+                       << "{\"name\":\"" << span.name << "\",\"ph\":\"X\",\"pid\":1,\"tid\":" << buffer->threadIndex
+                       << ",\"ts\":" << span.start / 1000.0 << ",\"dur\":" << span.duration / 1000.0 << "}";
+            first = false;
+            ++span_count;
+        }
+    }
+    trace_file << "\n],\"displayTimeUnit\":\"ms\"}" << std::endl;
+
+    std::cout << "Wrote " << span_count << " trace spans to " << filename << std::endl;
+    return true;
+}
+
+void
+HoudiniEngineTrace::clear()
+{
+    std::lock_guard<std::mutex> lock(theTraceBuffersMutex);
+    for (const std::shared_ptr<TraceBuffer>& buffer : theTraceBuffers)
+    {
+        std::lock_guard<std::mutex> buffer_lock(buffer->mutex);
+        buffer->firstSpan = buffer->count;
+    }
+}
@@ -0,0 +1,81 @@
+/*
+* Copyright (c) <2023> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#pragma once
+
+#include <chrono>
+#include <string>
+
+#define HOUDINI_TRACE_CONCAT_IMPL( A, B ) A##B
+#define HOUDINI_TRACE_CONCAT( A, B ) HOUDINI_TRACE_CONCAT_IMPL( A, B )
+
+// Tracing - this macro records a span named HAPI_TRACE_NAME (a string literal) covering
+// the rest of the enclosing scope, when tracing is enabled.
+#define HOUDINI_TRACE_SCOPE( HAPI_TRACE_NAME ) \
+    HoudiniEngineTraceScope HOUDINI_TRACE_CONCAT( houdini_trace_scope_, __LINE__ )( HAPI_TRACE_NAME )
+
+struct HoudiniEngineTrace
+{
+public:
+    // Start or stop recording spans; spans already recorded are kept
+    static void setEnabled(bool enabled);
+
+    static bool isEnabled();
+
+    // Record a completed span on the calling thread's ring buffer. The name must outlive the trace.
+    static void record(const char* name, std::chrono::steady_clock::time_point start, std::chrono::steady_clock::time_point end);
+
+    // Write the recorded spans of every thread as Chrome trace JSON (chrome://tracing, Perfetto)
+    static bool exportChromeTrace(const std::string& filename);
+
+    // Drop the recorded spans of every thread
+    static void clear();
+};
+
+// Records a span from its construction to its destruction
+class HoudiniEngineTraceScope
+{
+public:
+    explicit HoudiniEngineTraceScope(const char* name)
+        : myName(HoudiniEngineTrace::isEnabled() ? name : nullptr)
+    {
+        if (myName)
+            myStart = std::chrono::steady_clock::now();
+    }
+
+    ~HoudiniEngineTraceScope()
+    {
+        if (myName)
+            HoudiniEngineTrace::record(myName, myStart, std::chrono::steady_clock::now());
+    }
+
+    HoudiniEngineTraceScope(const HoudiniEngineTraceScope&) = delete;
+    HoudiniEngineTraceScope& operator=(const HoudiniEngineTraceScope&) = delete;
+
+private:
+    const char* myName;
+    std::chrono::steady_clock::time_point myStart;
+};
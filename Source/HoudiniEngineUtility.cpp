@@ -27,9 +27,15 @@
 #include "HoudiniApi.h"
 #include "HoudiniEngineUtility.h"
 
+#include <cstdio>
 #include <iostream>
+#include <mutex>
 #include <string>
+#include <vector>
 
+// The length and the contents of strings are fetched in two calls, and a batch is staged per
+// session, so fetches from different threads must not interleave
+static std::mutex theStringMutex;
 
 std::string 
 HoudiniEngineUtility::getLastError(HAPI_Session* session)
@@ -95,6 +101,8 @@ HoudiniEngineUtility::getConnectionError()
 std::string 
 HoudiniEngineUtility::getString(const HAPI_Session * session, HAPI_StringHandle string_handle)
 {
+    std::lock_guard<std::mutex> lock(theStringMutex);
+
     int length = 0;
     HoudiniApi::GetStringBufLength(session, string_handle, &length);
 
@@ -106,10 +114,74 @@ HoudiniEngineUtility::getString(const HAPI_Session * session, HAPI_StringHandle
     return result;
 }
 
+bool
+HoudiniEngineUtility::getStrings(const HAPI_Session * session, const std::vector<HAPI_StringHandle>& string_handles,
+                                 std::vector<std::string>& strings)
+{
+    strings.clear();
+    if (string_handles.empty())
+        return true;
+
+    std::lock_guard<std::mutex> lock(theStringMutex);
+
+    int buffer_size = 0;
+    HOUDINI_CHECK_ERROR_RETURN(
+        HoudiniApi::GetStringBatchSize(session, string_handles.data(), (int)string_handles.size(), &buffer_size), false);
+
+    // The batch holds every string back to back, each null-terminated
+    std::vector<char> buffer(buffer_size + 1, '\0');
+    if (buffer_size > 0)
+    {
+        HOUDINI_CHECK_ERROR_RETURN(
+            HoudiniApi::GetStringBatch(session, buffer.data(), buffer_size), false);
+    }
+
+    strings.reserve(string_handles.size());
+    const char* next = buffer.data();
+    for (size_t i = 0; i < string_handles.size(); ++i)
+    {
+        strings.emplace_back(next);
+        next += strings.back().size() + 1;
+        if (next > buffer.data() + buffer_size)
+            next = buffer.data() + buffer_size;
+    }
+
+    return true;
+}
 
 bool
 HoudiniEngineUtility::saveToHip(const HAPI_Session * session, const std::string& filename)
 {
     HAPI_Result result = HoudiniApi::SaveHIPFile(session, filename.c_str(), /*lock_nodes=*/false);
     return result == HAPI_RESULT_SUCCESS;
-}
\ No newline at end of file
+}
+
+std::string
+HoudiniEngineUtility::escapeJson(const std::string& value)
+{
+    std::string escaped;
+    for (char c : value)
+    {
+        if (c == '"' || c == '\\')
+        {
+            escaped += '\\';
+            escaped += c;
+        }
+        else if (c == '\n')
+            escaped += "\\n";
+        else if (c == '\r')
+            escaped += "\\r";
+        else if (c == '\t')
+            escaped += "\\t";
+        else if ((unsigned char)c < 0x20)
+        {
+            // Other control characters have no short escape
+            char code[8];
+            std::snprintf(code, sizeof(code), "\\u%04x", (unsigned char)c);
+            escaped += code;
+        }
+        else
+            escaped += c;
+    }
+    return escaped;
+}
@@ -28,7 +28,12 @@
 
 #include <HAPI/HAPI.h>
 
+#include <algorithm>
+#include <cstdint>
+#include <future>
 #include <string>
+#include <thread>
+#include <vector>
 
 // Error checking - this macro will check the status and return specified parameter in case of failure.
 #define HOUDINI_CHECK_ERROR_RETURN( HAPI_PARAM_CALL, HAPI_PARAM_RETURN ) \
@@ -80,12 +85,51 @@ public:
     // Helper method to retrieve the last connection error message
     static std::string getConnectionError();
 
-	// Helper method to retrieve a string from a HAPI_StringHandle
+	// Helper method to retrieve a string from a HAPI_StringHandle. String fetches are serialized,
+	// so this and getStrings can be called from several threads.
 	static std::string getString(const HAPI_Session* session, HAPI_StringHandle string_handle);
 
+	// Helper method to retrieve many strings from their handles in two round trips
+	static bool getStrings(const HAPI_Session* session, const std::vector<HAPI_StringHandle>& string_handles,
+	                       std::vector<std::string>& strings);
+
 	// Helper for handling exceptions on a failed result
 	static void ensureSuccess(HAPI_Result result);
 
 	// Save the session to a .hip file in the application directory
 	static bool saveToHip(const HAPI_Session* session, const std::string& filename);
-};
\ No newline at end of file
+
+	// Escape a value for use inside a JSON string literal
+	static std::string escapeJson(const std::string& value);
+
+	// Run func(begin, end) over [0, count), split across up to hardware_concurrency() threads
+	// when there are at least two tasks of min_per_task items
+	template <typename Func>
+	static void parallelFor(int64_t count, const Func& func, int64_t min_per_task);
+};
+
+template <typename Func>
+void
+HoudiniEngineUtility::parallelFor(int64_t count, const Func& func, int64_t min_per_task)
+{
+    const int64_t task_count = std::max<int64_t>(1, std::min<int64_t>(
+        (int64_t)std::max(1u, std::thread::hardware_concurrency()),
+        count / std::max<int64_t>(1, min_per_task)));
+    if (task_count == 1)
+    {
+        func((int64_t)0, count);
+        return;
+    }
+
+    const int64_t per_task = (count + task_count - 1) / task_count;
+    std::vector<std::future<void>> jobs;
+    for (int64_t task = 1; task < task_count; ++task)
+    {
+        const int64_t begin = task * per_task;
+        const int64_t end = std::min(count, begin + per_task);
+        jobs.push_back(std::async(std::launch::async, [&func, begin, end]() { func(begin, end); }));
+    }
+    func((int64_t)0, std::min(count, per_task));
+    for (std::future<void>& job : jobs)
+        job.get();
+}